@@ -101,6 +101,7 @@ pub extern "C" fn rs_ssh_tx_get_hassh(
     let tx = cast_pointer!(tx, SSHTransaction);
     match direction {
         STREAM_TOSERVER => {
+            tx.cli_hdr.generate_hassh(false);
             let m = &tx.cli_hdr.hassh;
             if m.len() > 0 {
                 unsafe {
@@ -111,6 +112,7 @@ pub extern "C" fn rs_ssh_tx_get_hassh(
             }
         }
         STREAM_TOCLIENT => {
+            tx.srv_hdr.generate_hassh(true);
             let m = &tx.srv_hdr.hassh;
             if m.len() > 0 {
                 unsafe {
@@ -140,6 +142,7 @@ pub extern "C" fn rs_ssh_tx_get_hassh_string(
     let tx = cast_pointer!(tx, SSHTransaction);
     match direction {
         STREAM_TOSERVER => {
+            tx.cli_hdr.generate_hassh(false);
             let m = &tx.cli_hdr.hassh_string;
             if m.len() > 0 {
                 unsafe {
@@ -150,6 +153,7 @@ pub extern "C" fn rs_ssh_tx_get_hassh_string(
             }
         }
         STREAM_TOCLIENT => {
+            tx.srv_hdr.generate_hassh(true);
             let m = &tx.srv_hdr.hassh_string;
             if m.len() > 0 {
                 unsafe {
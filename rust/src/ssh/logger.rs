@@ -64,6 +64,8 @@ fn log_ssh(tx: &SSHTransaction, js: &mut JsonBuilder) -> Result<bool, JsonError>
 #[no_mangle]
 pub extern "C" fn rs_ssh_log_json(tx: *mut std::os::raw::c_void, js: &mut JsonBuilder) -> bool {
     let tx = cast_pointer!(tx, SSHTransaction);
+    tx.cli_hdr.generate_hassh(false);
+    tx.srv_hdr.generate_hassh(true);
     if let Ok(x) = log_ssh(tx, js) {
         return x;
     }
@@ -21,10 +21,14 @@ use crate::core::STREAM_TOSERVER;
 use crate::core::{self, AppProto, Flow, ALPROTO_UNKNOWN, IPPROTO_TCP};
 use std::ffi::{CStr, CString};
 use std::mem::transmute;
-use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
 
 static mut ALPROTO_SSH: AppProto = ALPROTO_UNKNOWN;
 static HASSH_ENABLED: AtomicBool = AtomicBool::new(false);
+/// hassh computed on request of detection or logging
+static HASSH_COMPUTED: AtomicU64 = AtomicU64::new(0);
+/// retained KEXINIT records freed without the hassh being requested
+static HASSH_SKIPPED: AtomicU64 = AtomicU64::new(0);
 
 fn hassh_is_enabled() -> bool {
     HASSH_ENABLED.load(Ordering::Relaxed)
@@ -73,6 +77,8 @@ pub struct SshHeader {
 
     pub hassh: Vec<u8>,
     pub hassh_string: Vec<u8>,
+    /// raw KEXINIT payload, the hassh is computed from it on first use
+    kexinit: Vec<u8>,
 }
 
 impl SshHeader {
@@ -87,6 +93,34 @@ impl SshHeader {
 
             hassh: Vec::new(),
             hassh_string: Vec::new(),
+            kexinit: Vec::new(),
+        }
+    }
+
+    fn set_kexinit(&mut self, kexinit: &[u8]) {
+        if self.kexinit.len() == 0 && self.hassh.len() == 0 {
+            self.kexinit.extend_from_slice(kexinit);
+        }
+    }
+
+    /// Compute hassh and hassh string from the retained KEXINIT, if any.
+    /// Called by detection and logging before they use the fields.
+    pub fn generate_hassh(&mut self, resp: bool) {
+        if self.kexinit.len() == 0 {
+            return;
+        }
+        if let Ok((_, key_exchange)) = parser::ssh_parse_key_exchange(&self.kexinit) {
+            key_exchange.generate_hassh(&mut self.hassh_string, &mut self.hassh, &resp);
+            HASSH_COMPUTED.fetch_add(1, Ordering::Relaxed);
+        }
+        self.kexinit = Vec::new();
+    }
+}
+
+impl Drop for SshHeader {
+    fn drop(&mut self) {
+        if self.kexinit.len() > 0 {
+            HASSH_SKIPPED.fetch_add(1, Ordering::Relaxed);
         }
     }
 }
@@ -164,15 +198,7 @@ impl SSHState {
                 match hdr.record_left_msg {
                     // parse reassembled tcp segments
                     parser::MessageCode::SshMsgKexinit if hassh_is_enabled() => {
-                        if let Ok((_rem, key_exchange)) =
-                            parser::ssh_parse_key_exchange(&input[..start])
-                        {
-                            key_exchange.generate_hassh(
-                                &mut hdr.hassh_string,
-                                &mut hdr.hassh,
-                                &resp,
-                            );
-                        }
+                        hdr.set_kexinit(&input[..start]);
                         hdr.record_left_msg = parser::MessageCode::SshMsgUndefined(0);
                     }
                     _ => {}
@@ -190,9 +216,7 @@ impl SSHState {
                         parser::MessageCode::SshMsgKexinit if hassh_is_enabled() => {
                             //let endkex = SSH_RECORD_HEADER_LEN + head.pkt_len - 2;
                             let endkex = input.len() - rem.len();
-                            if let Ok((_, key_exchange)) = parser::ssh_parse_key_exchange(&input[SSH_RECORD_HEADER_LEN..endkex]) {
-                                key_exchange.generate_hassh(&mut hdr.hassh_string, &mut hdr.hassh, &resp);
-                            }
+                            hdr.set_kexinit(&input[SSH_RECORD_HEADER_LEN..endkex]);
                         }
                         parser::MessageCode::SshMsgNewKeys => {
                             hdr.flags = SSHConnectionState::SshStateFinished;
@@ -593,6 +617,16 @@ pub extern "C" fn rs_ssh_hassh_is_enabled() -> bool {
     hassh_is_enabled()
 }
 
+#[no_mangle]
+pub extern "C" fn rs_ssh_hassh_computed() -> u64 {
+    HASSH_COMPUTED.load(Ordering::Relaxed)
+}
+
+#[no_mangle]
+pub extern "C" fn rs_ssh_hassh_skipped() -> u64 {
+    HASSH_SKIPPED.load(Ordering::Relaxed)
+}
+
 #[no_mangle]
 pub extern "C" fn rs_ssh_tx_get_log_condition( tx: *mut std::os::raw::c_void) -> bool {
     let tx = cast_pointer!(tx, SSHTransaction);
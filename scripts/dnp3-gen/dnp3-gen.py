@@ -210,15 +210,6 @@ void OutputJsonDNP3SetItem(JsonBuilder *js, DNP3Object *object,
 
 """
 
-def has_freeable_types(fields):
-    freeable_types = [
-        "bytearray",
-    ]
-    for field in fields:
-        if field["type"] in freeable_types:
-            return True
-    return False
-
 def is_integer_type(datatype):
     integer_types = [
         "uint64",
@@ -351,7 +342,7 @@ def gen_object_decoders(context):
 {% if object.packed %}
 static int DNP3DecodeObjectG{{object.group}}V{{object.variation}}(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG{{object.group}}V{{object.variation}} *object = NULL;
     int bytes = (count / 8) + 1;
@@ -372,7 +363,7 @@ static int DNP3DecodeObjectG{{object.group}}V{{object.variation}}(const uint8_t
 
         for (int j = 0; j < 8 && count; j = j + {{object.fields[0].width}}) {
 
-            object = SCCalloc(1, sizeof(*object));
+            object = DNP3ArenaAlloc(arena, sizeof(*object));
             if (unlikely(object == NULL)) {
                 goto error;
             }
@@ -385,7 +376,7 @@ static int DNP3DecodeObjectG{{object.group}}V{{object.variation}}(const uint8_t
 #error "Unhandled field width: {{object.fields[0].width}}"
 {% endif %}
 
-            if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+            if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
                 goto error;
             }
 
@@ -398,16 +389,13 @@ static int DNP3DecodeObjectG{{object.group}}V{{object.variation}}(const uint8_t
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
     return 0;
 }
 
 {% else %}
 static int DNP3DecodeObjectG{{object.group}}V{{object.variation}}(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG{{object.group}}V{{object.variation}} *object = NULL;
     uint32_t prefix = 0;
@@ -434,7 +422,7 @@ static int DNP3DecodeObjectG{{object.group}}V{{object.variation}}(const uint8_t
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -505,7 +493,7 @@ static int DNP3DecodeObjectG{{object.group}}V{{object.variation}}(const uint8_t
                 /* Not enough data. */
                 goto error;
             }
-            object->{{field.name}} = SCCalloc(1, object->{{field.len_field}});
+            object->{{field.name}} = DNP3ArenaAlloc(arena, object->{{field.len_field}});
             if (unlikely(object->{{field.name}} == NULL)) {
                 goto error;
             }
@@ -555,7 +543,7 @@ static int DNP3DecodeObjectG{{object.group}}V{{object.variation}}(const uint8_t
 {% endif %}
 {% endfor %}
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -565,40 +553,12 @@ static int DNP3DecodeObjectG{{object.group}}V{{object.variation}}(const uint8_t
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 {% endif %}
 {% endfor %}
 
-void DNP3FreeObjectPoint(int group, int variation, void *point)
-{
-    switch(DNP3_OBJECT_CODE(group, variation)) {
-{% for object in objects %}
-{% if f_has_freeable_types(object.fields) %}
-        case DNP3_OBJECT_CODE({{object.group}}, {{object.variation}}): {
-            DNP3ObjectG{{object.group}}V{{object.variation}} *object = (DNP3ObjectG{{object.group}}V{{object.variation}} *) point;
-{% for field in object.fields %}
-{% if field.type == "bytearray" %}
-            if (object->{{field.name}} != NULL) {
-                SCFree(object->{{field.name}});
-            }
-{% endif %}
-{% endfor %}
-            break;
-        }
-{% endif %}
-{% endfor %}
-        default:
-            break;
-    }
-    SCFree(point);
-}
-
 /**
  * \\\\brief Decode a DNP3 object.
  *
@@ -607,7 +567,7 @@ void DNP3FreeObjectPoint(int group, int variation, void *point)
  */
 int DNP3DecodeObject(int group, int variation, const uint8_t **buf,
     uint32_t *len, uint8_t prefix_code, uint32_t start,
-    uint32_t count, DNP3PointList *points)
+    uint32_t count, DNP3PointList *points, DNP3Arena *arena)
 {
     int rc = 0;
 
@@ -615,7 +575,7 @@ int DNP3DecodeObject(int group, int variation, const uint8_t **buf,
 {% for object in objects %}
         case DNP3_OBJECT_CODE({{object.group}}, {{object.variation}}):
             rc = DNP3DecodeObjectG{{object.group}}V{{object.variation}}(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
 {% endfor %}
         default:
@@ -702,7 +662,7 @@ def main():
         print("error: jinja2 v2.10 or great required")
         return 1
 
-    definitions = yaml.load(open("scripts/dnp3-gen/dnp3-objects.yaml"))
+    definitions = yaml.load(open("scripts/dnp3-gen/dnp3-objects.yaml"), Loader=yaml.SafeLoader)
     print("Loaded %s objects." % (len(definitions["objects"])))
     definitions["objects"] = map(preprocess_object, definitions["objects"])
 
@@ -715,7 +675,6 @@ def main():
         "objects": definitions["objects"],
         "is_integer_type": is_integer_type,
         "f_to_type": to_type,
-        "f_has_freeable_types": has_freeable_types,
         "command_line": " ".join(sys.argv),
     }
 
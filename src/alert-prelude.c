@@ -1162,7 +1162,7 @@ static OutputInitResult AlertPreludeInitCtx(ConfNode *conf)
     if (log_packet_header && ConfValIsFalse(log_packet_header))
         ctx->log_packet_header = 0;
 
-    output_ctx = SCMalloc(sizeof(OutputCtx));
+    output_ctx = SCCalloc(1, sizeof(OutputCtx));
     if (unlikely(output_ctx == NULL)) {
         SCFree(ctx);
         prelude_perror(ret, "Unable to allocate memory");
@@ -28,8 +28,6 @@
 #include "app-layer-dnp3.h"
 #include "app-layer-dnp3-objects.h"
 
-void DNP3FreeObjectPoint(int group, int variation, void *point);
-
 #if 0
 static void DNP3HexDump(uint8_t *data, int len)
 {
@@ -39,33 +37,92 @@ static void DNP3HexDump(uint8_t *data, int len)
 }
 #endif
 
+/* size of the arena chunks, larger allocations get a chunk of their own */
+#define DNP3_ARENA_CHUNK_SIZE 4096
+
 /**
- * \brief Allocate a list for DNP3 points.
+ * \brief Allocate zeroed memory from an arena.
+ *
+ * \retval pointer to memory or NULL on allocation failure.
  */
-DNP3PointList *DNP3PointListAlloc(void)
+void *DNP3ArenaAlloc(DNP3Arena *arena, size_t size)
 {
-    DNP3PointList *items = SCCalloc(1, sizeof(*items));
-    if (unlikely(items == NULL)) {
-        return NULL;
+    DNP3ArenaChunk *chunk = arena->head;
+
+    size = (size + 7) & ~(size_t)7;
+
+    if (chunk == NULL || chunk->size - chunk->used < size) {
+        uint32_t chunk_size = (uint32_t)MAX(size, DNP3_ARENA_CHUNK_SIZE);
+        DNP3ArenaChunk *new_chunk = SCMalloc(sizeof(*new_chunk) + chunk_size);
+        if (unlikely(new_chunk == NULL)) {
+            return NULL;
+        }
+        new_chunk->size = chunk_size;
+        new_chunk->used = 0;
+        if (chunk != NULL && size > DNP3_ARENA_CHUNK_SIZE / 2) {
+            /* keep using the current chunk for the small allocations */
+            new_chunk->next = chunk->next;
+            chunk->next = new_chunk;
+        } else {
+            new_chunk->next = chunk;
+            arena->head = new_chunk;
+        }
+        chunk = new_chunk;
     }
-    TAILQ_INIT(items);
-    return items;
+
+    void *ptr = chunk->data + chunk->used;
+    chunk->used += (uint32_t)size;
+    memset(ptr, 0, size);
+    return ptr;
 }
 
 /**
- * \brief Free a DNP3PointList.
+ * \brief Release all allocations of an arena, keeping one chunk for
+ *     reuse.
  */
-void DNP3FreeObjectPointList(int group, int variation, DNP3PointList *list)
+void DNP3ArenaReset(DNP3Arena *arena)
 {
-    DNP3Point *point;
-    while ((point = TAILQ_FIRST(list)) != NULL) {
-        TAILQ_REMOVE(list, point, next);
-        if (point->data != NULL) {
-            DNP3FreeObjectPoint(group, variation, point->data);
+    DNP3ArenaChunk *keep = NULL;
+    DNP3ArenaChunk *chunk = arena->head;
+    while (chunk != NULL) {
+        DNP3ArenaChunk *next = chunk->next;
+        if (keep == NULL && chunk->size == DNP3_ARENA_CHUNK_SIZE) {
+            keep = chunk;
+            keep->used = 0;
+            keep->next = NULL;
+        } else {
+            SCFree(chunk);
         }
-        SCFree(point);
+        chunk = next;
+    }
+    arena->head = keep;
+}
+
+/**
+ * \brief Free all memory of an arena.
+ */
+void DNP3ArenaFree(DNP3Arena *arena)
+{
+    DNP3ArenaChunk *chunk = arena->head;
+    while (chunk != NULL) {
+        DNP3ArenaChunk *next = chunk->next;
+        SCFree(chunk);
+        chunk = next;
     }
-    SCFree(list);
+    arena->head = NULL;
+}
+
+/**
+ * \brief Allocate a list for DNP3 points.
+ */
+DNP3PointList *DNP3PointListAlloc(DNP3Arena *arena)
+{
+    DNP3PointList *items = DNP3ArenaAlloc(arena, sizeof(*items));
+    if (unlikely(items == NULL)) {
+        return NULL;
+    }
+    TAILQ_INIT(items);
+    return items;
 }
 
 /**
@@ -353,10 +410,10 @@ static int DNP3ReadPrefix(
  *
  * \retval 1 if successfull, 0 on failure.
  */
-static int DNP3AddPoint(DNP3PointList *list, void *object, uint32_t point_index,
-    uint8_t prefix_code, uint32_t prefix)
+static int DNP3AddPoint(DNP3Arena *arena, DNP3PointList *list, void *object,
+    uint32_t point_index, uint8_t prefix_code, uint32_t prefix)
 {
-    DNP3Point *point = SCCalloc(1, sizeof(*point));
+    DNP3Point *point = DNP3ArenaAlloc(arena, sizeof(*point));
     if (unlikely(point == NULL)) {
         return 0;
     }
@@ -392,7 +449,7 @@ static int DNP3AddPoint(DNP3PointList *list, void *object, uint32_t point_index,
 
 static int DNP3DecodeObjectG1V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG1V1 *object = NULL;
     int bytes = (count / 8) + 1;
@@ -413,14 +470,14 @@ static int DNP3DecodeObjectG1V1(const uint8_t **buf, uint32_t *len,
 
         for (int j = 0; j < 8 && count; j = j + 1) {
 
-            object = SCCalloc(1, sizeof(*object));
+            object = DNP3ArenaAlloc(arena, sizeof(*object));
             if (unlikely(object == NULL)) {
                 goto error;
             }
 
             object->state = (octet >> j) & 0x1;
 
-            if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+            if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
                 goto error;
             }
 
@@ -433,15 +490,12 @@ static int DNP3DecodeObjectG1V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
     return 0;
 }
 
 static int DNP3DecodeObjectG1V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG1V2 *object = NULL;
     uint32_t prefix = 0;
@@ -449,7 +503,7 @@ static int DNP3DecodeObjectG1V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -473,7 +527,7 @@ static int DNP3DecodeObjectG1V2(const uint8_t **buf, uint32_t *len,
             object->state = (octet >> 7) & 0x1;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -483,16 +537,12 @@ static int DNP3DecodeObjectG1V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG2V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG2V1 *object = NULL;
     uint32_t prefix = 0;
@@ -500,7 +550,7 @@ static int DNP3DecodeObjectG2V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -513,7 +563,7 @@ static int DNP3DecodeObjectG2V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -523,16 +573,12 @@ static int DNP3DecodeObjectG2V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG2V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG2V2 *object = NULL;
     uint32_t prefix = 0;
@@ -540,7 +586,7 @@ static int DNP3DecodeObjectG2V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -567,7 +613,7 @@ static int DNP3DecodeObjectG2V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -577,16 +623,12 @@ static int DNP3DecodeObjectG2V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG2V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG2V3 *object = NULL;
     uint32_t prefix = 0;
@@ -594,7 +636,7 @@ static int DNP3DecodeObjectG2V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -621,7 +663,7 @@ static int DNP3DecodeObjectG2V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -631,16 +673,12 @@ static int DNP3DecodeObjectG2V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG3V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG3V1 *object = NULL;
     int bytes = (count / 8) + 1;
@@ -661,14 +699,14 @@ static int DNP3DecodeObjectG3V1(const uint8_t **buf, uint32_t *len,
 
         for (int j = 0; j < 8 && count; j = j + 2) {
 
-            object = SCCalloc(1, sizeof(*object));
+            object = DNP3ArenaAlloc(arena, sizeof(*object));
             if (unlikely(object == NULL)) {
                 goto error;
             }
 
             object->state = (octet >> j) & 0x3;
 
-            if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+            if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
                 goto error;
             }
 
@@ -681,15 +719,12 @@ static int DNP3DecodeObjectG3V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
     return 0;
 }
 
 static int DNP3DecodeObjectG3V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG3V2 *object = NULL;
     uint32_t prefix = 0;
@@ -697,7 +732,7 @@ static int DNP3DecodeObjectG3V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -720,7 +755,7 @@ static int DNP3DecodeObjectG3V2(const uint8_t **buf, uint32_t *len,
             object->state = (octet >> 6) & 0x3;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -730,16 +765,12 @@ static int DNP3DecodeObjectG3V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG4V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG4V1 *object = NULL;
     uint32_t prefix = 0;
@@ -747,7 +778,7 @@ static int DNP3DecodeObjectG4V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -770,7 +801,7 @@ static int DNP3DecodeObjectG4V1(const uint8_t **buf, uint32_t *len,
             object->state = (octet >> 6) & 0x3;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -780,16 +811,12 @@ static int DNP3DecodeObjectG4V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG4V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG4V2 *object = NULL;
     uint32_t prefix = 0;
@@ -797,7 +824,7 @@ static int DNP3DecodeObjectG4V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -823,7 +850,7 @@ static int DNP3DecodeObjectG4V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -833,16 +860,12 @@ static int DNP3DecodeObjectG4V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG4V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG4V3 *object = NULL;
     uint32_t prefix = 0;
@@ -850,7 +873,7 @@ static int DNP3DecodeObjectG4V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -876,7 +899,7 @@ static int DNP3DecodeObjectG4V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -886,16 +909,12 @@ static int DNP3DecodeObjectG4V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG10V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG10V1 *object = NULL;
     int bytes = (count / 8) + 1;
@@ -916,14 +935,14 @@ static int DNP3DecodeObjectG10V1(const uint8_t **buf, uint32_t *len,
 
         for (int j = 0; j < 8 && count; j = j + 1) {
 
-            object = SCCalloc(1, sizeof(*object));
+            object = DNP3ArenaAlloc(arena, sizeof(*object));
             if (unlikely(object == NULL)) {
                 goto error;
             }
 
             object->state = (octet >> j) & 0x1;
 
-            if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+            if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
                 goto error;
             }
 
@@ -936,15 +955,12 @@ static int DNP3DecodeObjectG10V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
     return 0;
 }
 
 static int DNP3DecodeObjectG10V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG10V2 *object = NULL;
     uint32_t prefix = 0;
@@ -952,7 +968,7 @@ static int DNP3DecodeObjectG10V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -976,7 +992,7 @@ static int DNP3DecodeObjectG10V2(const uint8_t **buf, uint32_t *len,
             object->state = (octet >> 7) & 0x1;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -986,16 +1002,12 @@ static int DNP3DecodeObjectG10V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG11V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG11V1 *object = NULL;
     uint32_t prefix = 0;
@@ -1003,7 +1015,7 @@ static int DNP3DecodeObjectG11V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1027,7 +1039,7 @@ static int DNP3DecodeObjectG11V1(const uint8_t **buf, uint32_t *len,
             object->state = (octet >> 7) & 0x1;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1037,16 +1049,12 @@ static int DNP3DecodeObjectG11V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG11V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG11V2 *object = NULL;
     uint32_t prefix = 0;
@@ -1054,7 +1062,7 @@ static int DNP3DecodeObjectG11V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1081,7 +1089,7 @@ static int DNP3DecodeObjectG11V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1091,16 +1099,12 @@ static int DNP3DecodeObjectG11V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG12V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG12V1 *object = NULL;
     uint32_t prefix = 0;
@@ -1108,7 +1112,7 @@ static int DNP3DecodeObjectG12V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1145,7 +1149,7 @@ static int DNP3DecodeObjectG12V1(const uint8_t **buf, uint32_t *len,
             object->reserved = (octet >> 7) & 0x1;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1155,16 +1159,12 @@ static int DNP3DecodeObjectG12V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG12V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG12V2 *object = NULL;
     uint32_t prefix = 0;
@@ -1172,7 +1172,7 @@ static int DNP3DecodeObjectG12V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1209,7 +1209,7 @@ static int DNP3DecodeObjectG12V2(const uint8_t **buf, uint32_t *len,
             object->reserved = (octet >> 7) & 0x1;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1219,16 +1219,12 @@ static int DNP3DecodeObjectG12V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG12V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG12V3 *object = NULL;
     int bytes = (count / 8) + 1;
@@ -1249,14 +1245,14 @@ static int DNP3DecodeObjectG12V3(const uint8_t **buf, uint32_t *len,
 
         for (int j = 0; j < 8 && count; j = j + 1) {
 
-            object = SCCalloc(1, sizeof(*object));
+            object = DNP3ArenaAlloc(arena, sizeof(*object));
             if (unlikely(object == NULL)) {
                 goto error;
             }
 
             object->point = (octet >> j) & 0x1;
 
-            if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+            if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
                 goto error;
             }
 
@@ -1269,15 +1265,12 @@ static int DNP3DecodeObjectG12V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
     return 0;
 }
 
 static int DNP3DecodeObjectG13V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG13V1 *object = NULL;
     uint32_t prefix = 0;
@@ -1285,7 +1278,7 @@ static int DNP3DecodeObjectG13V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1303,7 +1296,7 @@ static int DNP3DecodeObjectG13V1(const uint8_t **buf, uint32_t *len,
             object->commanded_state = (octet >> 7) & 0x1;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1313,16 +1306,12 @@ static int DNP3DecodeObjectG13V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG13V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG13V2 *object = NULL;
     uint32_t prefix = 0;
@@ -1330,7 +1319,7 @@ static int DNP3DecodeObjectG13V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1351,7 +1340,7 @@ static int DNP3DecodeObjectG13V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1361,16 +1350,12 @@ static int DNP3DecodeObjectG13V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG20V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG20V1 *object = NULL;
     uint32_t prefix = 0;
@@ -1378,7 +1363,7 @@ static int DNP3DecodeObjectG20V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1405,7 +1390,7 @@ static int DNP3DecodeObjectG20V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1415,16 +1400,12 @@ static int DNP3DecodeObjectG20V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG20V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG20V2 *object = NULL;
     uint32_t prefix = 0;
@@ -1432,7 +1413,7 @@ static int DNP3DecodeObjectG20V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1459,7 +1440,7 @@ static int DNP3DecodeObjectG20V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1469,16 +1450,12 @@ static int DNP3DecodeObjectG20V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG20V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG20V3 *object = NULL;
     uint32_t prefix = 0;
@@ -1486,7 +1463,7 @@ static int DNP3DecodeObjectG20V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1513,7 +1490,7 @@ static int DNP3DecodeObjectG20V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1523,16 +1500,12 @@ static int DNP3DecodeObjectG20V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG20V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG20V4 *object = NULL;
     uint32_t prefix = 0;
@@ -1540,7 +1513,7 @@ static int DNP3DecodeObjectG20V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1567,7 +1540,7 @@ static int DNP3DecodeObjectG20V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1577,16 +1550,12 @@ static int DNP3DecodeObjectG20V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG20V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG20V5 *object = NULL;
     uint32_t prefix = 0;
@@ -1594,7 +1563,7 @@ static int DNP3DecodeObjectG20V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1607,7 +1576,7 @@ static int DNP3DecodeObjectG20V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1617,16 +1586,12 @@ static int DNP3DecodeObjectG20V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG20V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG20V6 *object = NULL;
     uint32_t prefix = 0;
@@ -1634,7 +1599,7 @@ static int DNP3DecodeObjectG20V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1647,7 +1612,7 @@ static int DNP3DecodeObjectG20V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1657,16 +1622,12 @@ static int DNP3DecodeObjectG20V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG20V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG20V7 *object = NULL;
     uint32_t prefix = 0;
@@ -1674,7 +1635,7 @@ static int DNP3DecodeObjectG20V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1687,7 +1648,7 @@ static int DNP3DecodeObjectG20V7(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1697,16 +1658,12 @@ static int DNP3DecodeObjectG20V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG20V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG20V8 *object = NULL;
     uint32_t prefix = 0;
@@ -1714,7 +1671,7 @@ static int DNP3DecodeObjectG20V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1727,7 +1684,7 @@ static int DNP3DecodeObjectG20V8(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1737,16 +1694,12 @@ static int DNP3DecodeObjectG20V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V1 *object = NULL;
     uint32_t prefix = 0;
@@ -1754,7 +1707,7 @@ static int DNP3DecodeObjectG21V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1781,7 +1734,7 @@ static int DNP3DecodeObjectG21V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1791,16 +1744,12 @@ static int DNP3DecodeObjectG21V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V2 *object = NULL;
     uint32_t prefix = 0;
@@ -1808,7 +1757,7 @@ static int DNP3DecodeObjectG21V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1835,7 +1784,7 @@ static int DNP3DecodeObjectG21V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1845,16 +1794,12 @@ static int DNP3DecodeObjectG21V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V3 *object = NULL;
     uint32_t prefix = 0;
@@ -1862,7 +1807,7 @@ static int DNP3DecodeObjectG21V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1889,7 +1834,7 @@ static int DNP3DecodeObjectG21V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1899,16 +1844,12 @@ static int DNP3DecodeObjectG21V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V4 *object = NULL;
     uint32_t prefix = 0;
@@ -1916,7 +1857,7 @@ static int DNP3DecodeObjectG21V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -1943,7 +1884,7 @@ static int DNP3DecodeObjectG21V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -1953,16 +1894,12 @@ static int DNP3DecodeObjectG21V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V5 *object = NULL;
     uint32_t prefix = 0;
@@ -1970,7 +1907,7 @@ static int DNP3DecodeObjectG21V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2000,7 +1937,7 @@ static int DNP3DecodeObjectG21V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2010,16 +1947,12 @@ static int DNP3DecodeObjectG21V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V6 *object = NULL;
     uint32_t prefix = 0;
@@ -2027,7 +1960,7 @@ static int DNP3DecodeObjectG21V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2057,7 +1990,7 @@ static int DNP3DecodeObjectG21V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2067,16 +2000,12 @@ static int DNP3DecodeObjectG21V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V7 *object = NULL;
     uint32_t prefix = 0;
@@ -2084,7 +2013,7 @@ static int DNP3DecodeObjectG21V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2114,7 +2043,7 @@ static int DNP3DecodeObjectG21V7(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2124,16 +2053,12 @@ static int DNP3DecodeObjectG21V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V8 *object = NULL;
     uint32_t prefix = 0;
@@ -2141,7 +2066,7 @@ static int DNP3DecodeObjectG21V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2171,7 +2096,7 @@ static int DNP3DecodeObjectG21V8(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2181,16 +2106,12 @@ static int DNP3DecodeObjectG21V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V9(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V9 *object = NULL;
     uint32_t prefix = 0;
@@ -2198,7 +2119,7 @@ static int DNP3DecodeObjectG21V9(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2211,7 +2132,7 @@ static int DNP3DecodeObjectG21V9(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2221,16 +2142,12 @@ static int DNP3DecodeObjectG21V9(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V10(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V10 *object = NULL;
     uint32_t prefix = 0;
@@ -2238,7 +2155,7 @@ static int DNP3DecodeObjectG21V10(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2251,7 +2168,7 @@ static int DNP3DecodeObjectG21V10(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2261,16 +2178,12 @@ static int DNP3DecodeObjectG21V10(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V11(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V11 *object = NULL;
     uint32_t prefix = 0;
@@ -2278,7 +2191,7 @@ static int DNP3DecodeObjectG21V11(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2291,7 +2204,7 @@ static int DNP3DecodeObjectG21V11(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2301,16 +2214,12 @@ static int DNP3DecodeObjectG21V11(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG21V12(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG21V12 *object = NULL;
     uint32_t prefix = 0;
@@ -2318,7 +2227,7 @@ static int DNP3DecodeObjectG21V12(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2331,7 +2240,7 @@ static int DNP3DecodeObjectG21V12(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2341,16 +2250,12 @@ static int DNP3DecodeObjectG21V12(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG22V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG22V1 *object = NULL;
     uint32_t prefix = 0;
@@ -2358,7 +2263,7 @@ static int DNP3DecodeObjectG22V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2385,7 +2290,7 @@ static int DNP3DecodeObjectG22V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2395,16 +2300,12 @@ static int DNP3DecodeObjectG22V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG22V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG22V2 *object = NULL;
     uint32_t prefix = 0;
@@ -2412,7 +2313,7 @@ static int DNP3DecodeObjectG22V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2439,7 +2340,7 @@ static int DNP3DecodeObjectG22V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2449,16 +2350,12 @@ static int DNP3DecodeObjectG22V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG22V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG22V3 *object = NULL;
     uint32_t prefix = 0;
@@ -2466,7 +2363,7 @@ static int DNP3DecodeObjectG22V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2493,7 +2390,7 @@ static int DNP3DecodeObjectG22V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2503,16 +2400,12 @@ static int DNP3DecodeObjectG22V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG22V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG22V4 *object = NULL;
     uint32_t prefix = 0;
@@ -2520,7 +2413,7 @@ static int DNP3DecodeObjectG22V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2547,7 +2440,7 @@ static int DNP3DecodeObjectG22V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2557,16 +2450,12 @@ static int DNP3DecodeObjectG22V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG22V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG22V5 *object = NULL;
     uint32_t prefix = 0;
@@ -2574,7 +2463,7 @@ static int DNP3DecodeObjectG22V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2604,7 +2493,7 @@ static int DNP3DecodeObjectG22V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2614,16 +2503,12 @@ static int DNP3DecodeObjectG22V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG22V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG22V6 *object = NULL;
     uint32_t prefix = 0;
@@ -2631,7 +2516,7 @@ static int DNP3DecodeObjectG22V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2661,7 +2546,7 @@ static int DNP3DecodeObjectG22V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2671,16 +2556,12 @@ static int DNP3DecodeObjectG22V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG22V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG22V7 *object = NULL;
     uint32_t prefix = 0;
@@ -2688,7 +2569,7 @@ static int DNP3DecodeObjectG22V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2718,7 +2599,7 @@ static int DNP3DecodeObjectG22V7(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2728,16 +2609,12 @@ static int DNP3DecodeObjectG22V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG22V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG22V8 *object = NULL;
     uint32_t prefix = 0;
@@ -2745,7 +2622,7 @@ static int DNP3DecodeObjectG22V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2775,7 +2652,7 @@ static int DNP3DecodeObjectG22V8(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2785,16 +2662,12 @@ static int DNP3DecodeObjectG22V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG23V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG23V1 *object = NULL;
     uint32_t prefix = 0;
@@ -2802,7 +2675,7 @@ static int DNP3DecodeObjectG23V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2829,7 +2702,7 @@ static int DNP3DecodeObjectG23V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2839,16 +2712,12 @@ static int DNP3DecodeObjectG23V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG23V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG23V2 *object = NULL;
     uint32_t prefix = 0;
@@ -2856,7 +2725,7 @@ static int DNP3DecodeObjectG23V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2883,7 +2752,7 @@ static int DNP3DecodeObjectG23V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2893,16 +2762,12 @@ static int DNP3DecodeObjectG23V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG23V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG23V3 *object = NULL;
     uint32_t prefix = 0;
@@ -2910,7 +2775,7 @@ static int DNP3DecodeObjectG23V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2937,7 +2802,7 @@ static int DNP3DecodeObjectG23V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -2947,16 +2812,12 @@ static int DNP3DecodeObjectG23V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG23V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG23V4 *object = NULL;
     uint32_t prefix = 0;
@@ -2964,7 +2825,7 @@ static int DNP3DecodeObjectG23V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -2991,7 +2852,7 @@ static int DNP3DecodeObjectG23V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3001,16 +2862,12 @@ static int DNP3DecodeObjectG23V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG23V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG23V5 *object = NULL;
     uint32_t prefix = 0;
@@ -3018,7 +2875,7 @@ static int DNP3DecodeObjectG23V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3048,7 +2905,7 @@ static int DNP3DecodeObjectG23V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3058,16 +2915,12 @@ static int DNP3DecodeObjectG23V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG23V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG23V6 *object = NULL;
     uint32_t prefix = 0;
@@ -3075,7 +2928,7 @@ static int DNP3DecodeObjectG23V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3105,7 +2958,7 @@ static int DNP3DecodeObjectG23V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3115,16 +2968,12 @@ static int DNP3DecodeObjectG23V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG23V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG23V7 *object = NULL;
     uint32_t prefix = 0;
@@ -3132,7 +2981,7 @@ static int DNP3DecodeObjectG23V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3162,7 +3011,7 @@ static int DNP3DecodeObjectG23V7(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3172,16 +3021,12 @@ static int DNP3DecodeObjectG23V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG23V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG23V8 *object = NULL;
     uint32_t prefix = 0;
@@ -3189,7 +3034,7 @@ static int DNP3DecodeObjectG23V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3219,7 +3064,7 @@ static int DNP3DecodeObjectG23V8(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3229,16 +3074,12 @@ static int DNP3DecodeObjectG23V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG30V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG30V1 *object = NULL;
     uint32_t prefix = 0;
@@ -3246,7 +3087,7 @@ static int DNP3DecodeObjectG30V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3273,7 +3114,7 @@ static int DNP3DecodeObjectG30V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3283,16 +3124,12 @@ static int DNP3DecodeObjectG30V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG30V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG30V2 *object = NULL;
     uint32_t prefix = 0;
@@ -3300,7 +3137,7 @@ static int DNP3DecodeObjectG30V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3327,7 +3164,7 @@ static int DNP3DecodeObjectG30V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3337,16 +3174,12 @@ static int DNP3DecodeObjectG30V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG30V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG30V3 *object = NULL;
     uint32_t prefix = 0;
@@ -3354,7 +3187,7 @@ static int DNP3DecodeObjectG30V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3367,7 +3200,7 @@ static int DNP3DecodeObjectG30V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3377,16 +3210,12 @@ static int DNP3DecodeObjectG30V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG30V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG30V4 *object = NULL;
     uint32_t prefix = 0;
@@ -3394,7 +3223,7 @@ static int DNP3DecodeObjectG30V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3407,7 +3236,7 @@ static int DNP3DecodeObjectG30V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3417,16 +3246,12 @@ static int DNP3DecodeObjectG30V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG30V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG30V5 *object = NULL;
     uint32_t prefix = 0;
@@ -3434,7 +3259,7 @@ static int DNP3DecodeObjectG30V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3461,7 +3286,7 @@ static int DNP3DecodeObjectG30V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3471,16 +3296,12 @@ static int DNP3DecodeObjectG30V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG30V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG30V6 *object = NULL;
     uint32_t prefix = 0;
@@ -3488,7 +3309,7 @@ static int DNP3DecodeObjectG30V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3515,7 +3336,7 @@ static int DNP3DecodeObjectG30V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3525,16 +3346,12 @@ static int DNP3DecodeObjectG30V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG31V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG31V1 *object = NULL;
     uint32_t prefix = 0;
@@ -3542,7 +3359,7 @@ static int DNP3DecodeObjectG31V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3569,7 +3386,7 @@ static int DNP3DecodeObjectG31V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3579,16 +3396,12 @@ static int DNP3DecodeObjectG31V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG31V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG31V2 *object = NULL;
     uint32_t prefix = 0;
@@ -3596,7 +3409,7 @@ static int DNP3DecodeObjectG31V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3623,7 +3436,7 @@ static int DNP3DecodeObjectG31V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3633,16 +3446,12 @@ static int DNP3DecodeObjectG31V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG31V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG31V3 *object = NULL;
     uint32_t prefix = 0;
@@ -3650,7 +3459,7 @@ static int DNP3DecodeObjectG31V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3680,7 +3489,7 @@ static int DNP3DecodeObjectG31V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3690,16 +3499,12 @@ static int DNP3DecodeObjectG31V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG31V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG31V4 *object = NULL;
     uint32_t prefix = 0;
@@ -3707,7 +3512,7 @@ static int DNP3DecodeObjectG31V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3737,7 +3542,7 @@ static int DNP3DecodeObjectG31V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3747,16 +3552,12 @@ static int DNP3DecodeObjectG31V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG31V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG31V5 *object = NULL;
     uint32_t prefix = 0;
@@ -3764,7 +3565,7 @@ static int DNP3DecodeObjectG31V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3777,7 +3578,7 @@ static int DNP3DecodeObjectG31V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3787,16 +3588,12 @@ static int DNP3DecodeObjectG31V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG31V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG31V6 *object = NULL;
     uint32_t prefix = 0;
@@ -3804,7 +3601,7 @@ static int DNP3DecodeObjectG31V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3817,7 +3614,7 @@ static int DNP3DecodeObjectG31V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3827,16 +3624,12 @@ static int DNP3DecodeObjectG31V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG31V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG31V7 *object = NULL;
     uint32_t prefix = 0;
@@ -3844,7 +3637,7 @@ static int DNP3DecodeObjectG31V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3871,7 +3664,7 @@ static int DNP3DecodeObjectG31V7(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3881,16 +3674,12 @@ static int DNP3DecodeObjectG31V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG31V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG31V8 *object = NULL;
     uint32_t prefix = 0;
@@ -3898,7 +3687,7 @@ static int DNP3DecodeObjectG31V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3925,7 +3714,7 @@ static int DNP3DecodeObjectG31V8(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3935,16 +3724,12 @@ static int DNP3DecodeObjectG31V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG32V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG32V1 *object = NULL;
     uint32_t prefix = 0;
@@ -3952,7 +3737,7 @@ static int DNP3DecodeObjectG32V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -3979,7 +3764,7 @@ static int DNP3DecodeObjectG32V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -3989,16 +3774,12 @@ static int DNP3DecodeObjectG32V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG32V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG32V2 *object = NULL;
     uint32_t prefix = 0;
@@ -4006,7 +3787,7 @@ static int DNP3DecodeObjectG32V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4033,7 +3814,7 @@ static int DNP3DecodeObjectG32V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4043,16 +3824,12 @@ static int DNP3DecodeObjectG32V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG32V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG32V3 *object = NULL;
     uint32_t prefix = 0;
@@ -4060,7 +3837,7 @@ static int DNP3DecodeObjectG32V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4090,7 +3867,7 @@ static int DNP3DecodeObjectG32V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4100,16 +3877,12 @@ static int DNP3DecodeObjectG32V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG32V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG32V4 *object = NULL;
     uint32_t prefix = 0;
@@ -4117,7 +3890,7 @@ static int DNP3DecodeObjectG32V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4147,7 +3920,7 @@ static int DNP3DecodeObjectG32V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4157,16 +3930,12 @@ static int DNP3DecodeObjectG32V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG32V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG32V5 *object = NULL;
     uint32_t prefix = 0;
@@ -4174,7 +3943,7 @@ static int DNP3DecodeObjectG32V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4201,7 +3970,7 @@ static int DNP3DecodeObjectG32V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4211,16 +3980,12 @@ static int DNP3DecodeObjectG32V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG32V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG32V6 *object = NULL;
     uint32_t prefix = 0;
@@ -4228,7 +3993,7 @@ static int DNP3DecodeObjectG32V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4255,7 +4020,7 @@ static int DNP3DecodeObjectG32V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4265,16 +4030,12 @@ static int DNP3DecodeObjectG32V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG32V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG32V7 *object = NULL;
     uint32_t prefix = 0;
@@ -4282,7 +4043,7 @@ static int DNP3DecodeObjectG32V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4312,7 +4073,7 @@ static int DNP3DecodeObjectG32V7(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4322,16 +4083,12 @@ static int DNP3DecodeObjectG32V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG32V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG32V8 *object = NULL;
     uint32_t prefix = 0;
@@ -4339,7 +4096,7 @@ static int DNP3DecodeObjectG32V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4369,7 +4126,7 @@ static int DNP3DecodeObjectG32V8(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4379,16 +4136,12 @@ static int DNP3DecodeObjectG32V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG33V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG33V1 *object = NULL;
     uint32_t prefix = 0;
@@ -4396,7 +4149,7 @@ static int DNP3DecodeObjectG33V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4423,7 +4176,7 @@ static int DNP3DecodeObjectG33V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4433,16 +4186,12 @@ static int DNP3DecodeObjectG33V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG33V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG33V2 *object = NULL;
     uint32_t prefix = 0;
@@ -4450,7 +4199,7 @@ static int DNP3DecodeObjectG33V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4477,7 +4226,7 @@ static int DNP3DecodeObjectG33V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4487,16 +4236,12 @@ static int DNP3DecodeObjectG33V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG33V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG33V3 *object = NULL;
     uint32_t prefix = 0;
@@ -4504,7 +4249,7 @@ static int DNP3DecodeObjectG33V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4534,7 +4279,7 @@ static int DNP3DecodeObjectG33V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4544,16 +4289,12 @@ static int DNP3DecodeObjectG33V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG33V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG33V4 *object = NULL;
     uint32_t prefix = 0;
@@ -4561,7 +4302,7 @@ static int DNP3DecodeObjectG33V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4591,7 +4332,7 @@ static int DNP3DecodeObjectG33V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4601,16 +4342,12 @@ static int DNP3DecodeObjectG33V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG33V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG33V5 *object = NULL;
     uint32_t prefix = 0;
@@ -4618,7 +4355,7 @@ static int DNP3DecodeObjectG33V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4645,7 +4382,7 @@ static int DNP3DecodeObjectG33V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4655,16 +4392,12 @@ static int DNP3DecodeObjectG33V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG33V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG33V6 *object = NULL;
     uint32_t prefix = 0;
@@ -4672,7 +4405,7 @@ static int DNP3DecodeObjectG33V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4699,7 +4432,7 @@ static int DNP3DecodeObjectG33V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4709,16 +4442,12 @@ static int DNP3DecodeObjectG33V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG33V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG33V7 *object = NULL;
     uint32_t prefix = 0;
@@ -4726,7 +4455,7 @@ static int DNP3DecodeObjectG33V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4756,7 +4485,7 @@ static int DNP3DecodeObjectG33V7(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4766,16 +4495,12 @@ static int DNP3DecodeObjectG33V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG33V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG33V8 *object = NULL;
     uint32_t prefix = 0;
@@ -4783,7 +4508,7 @@ static int DNP3DecodeObjectG33V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4813,7 +4538,7 @@ static int DNP3DecodeObjectG33V8(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4823,16 +4548,12 @@ static int DNP3DecodeObjectG33V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG34V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG34V1 *object = NULL;
     uint32_t prefix = 0;
@@ -4840,7 +4561,7 @@ static int DNP3DecodeObjectG34V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4853,7 +4574,7 @@ static int DNP3DecodeObjectG34V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4863,16 +4584,12 @@ static int DNP3DecodeObjectG34V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG34V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG34V2 *object = NULL;
     uint32_t prefix = 0;
@@ -4880,7 +4597,7 @@ static int DNP3DecodeObjectG34V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4893,7 +4610,7 @@ static int DNP3DecodeObjectG34V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4903,16 +4620,12 @@ static int DNP3DecodeObjectG34V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG34V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG34V3 *object = NULL;
     uint32_t prefix = 0;
@@ -4920,7 +4633,7 @@ static int DNP3DecodeObjectG34V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4933,7 +4646,7 @@ static int DNP3DecodeObjectG34V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4943,16 +4656,12 @@ static int DNP3DecodeObjectG34V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG40V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG40V1 *object = NULL;
     uint32_t prefix = 0;
@@ -4960,7 +4669,7 @@ static int DNP3DecodeObjectG40V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -4987,7 +4696,7 @@ static int DNP3DecodeObjectG40V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -4997,16 +4706,12 @@ static int DNP3DecodeObjectG40V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG40V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG40V2 *object = NULL;
     uint32_t prefix = 0;
@@ -5014,7 +4719,7 @@ static int DNP3DecodeObjectG40V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5041,7 +4746,7 @@ static int DNP3DecodeObjectG40V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5051,16 +4756,12 @@ static int DNP3DecodeObjectG40V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG40V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG40V3 *object = NULL;
     uint32_t prefix = 0;
@@ -5068,7 +4769,7 @@ static int DNP3DecodeObjectG40V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5095,7 +4796,7 @@ static int DNP3DecodeObjectG40V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5105,16 +4806,12 @@ static int DNP3DecodeObjectG40V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG40V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG40V4 *object = NULL;
     uint32_t prefix = 0;
@@ -5122,7 +4819,7 @@ static int DNP3DecodeObjectG40V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5149,7 +4846,7 @@ static int DNP3DecodeObjectG40V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5159,16 +4856,12 @@ static int DNP3DecodeObjectG40V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG41V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG41V1 *object = NULL;
     uint32_t prefix = 0;
@@ -5176,7 +4869,7 @@ static int DNP3DecodeObjectG41V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5192,7 +4885,7 @@ static int DNP3DecodeObjectG41V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5202,16 +4895,12 @@ static int DNP3DecodeObjectG41V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG41V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG41V2 *object = NULL;
     uint32_t prefix = 0;
@@ -5219,7 +4908,7 @@ static int DNP3DecodeObjectG41V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5235,7 +4924,7 @@ static int DNP3DecodeObjectG41V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5245,16 +4934,12 @@ static int DNP3DecodeObjectG41V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG41V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG41V3 *object = NULL;
     uint32_t prefix = 0;
@@ -5262,7 +4947,7 @@ static int DNP3DecodeObjectG41V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5278,7 +4963,7 @@ static int DNP3DecodeObjectG41V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5288,16 +4973,12 @@ static int DNP3DecodeObjectG41V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG41V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG41V4 *object = NULL;
     uint32_t prefix = 0;
@@ -5305,7 +4986,7 @@ static int DNP3DecodeObjectG41V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5321,7 +5002,7 @@ static int DNP3DecodeObjectG41V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5331,16 +5012,12 @@ static int DNP3DecodeObjectG41V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG42V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG42V1 *object = NULL;
     uint32_t prefix = 0;
@@ -5348,7 +5025,7 @@ static int DNP3DecodeObjectG42V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5375,7 +5052,7 @@ static int DNP3DecodeObjectG42V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5385,16 +5062,12 @@ static int DNP3DecodeObjectG42V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG42V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG42V2 *object = NULL;
     uint32_t prefix = 0;
@@ -5402,7 +5075,7 @@ static int DNP3DecodeObjectG42V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5429,7 +5102,7 @@ static int DNP3DecodeObjectG42V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5439,16 +5112,12 @@ static int DNP3DecodeObjectG42V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG42V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG42V3 *object = NULL;
     uint32_t prefix = 0;
@@ -5456,7 +5125,7 @@ static int DNP3DecodeObjectG42V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5486,7 +5155,7 @@ static int DNP3DecodeObjectG42V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5496,16 +5165,12 @@ static int DNP3DecodeObjectG42V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG42V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG42V4 *object = NULL;
     uint32_t prefix = 0;
@@ -5513,7 +5178,7 @@ static int DNP3DecodeObjectG42V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5543,7 +5208,7 @@ static int DNP3DecodeObjectG42V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5553,16 +5218,12 @@ static int DNP3DecodeObjectG42V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG42V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG42V5 *object = NULL;
     uint32_t prefix = 0;
@@ -5570,7 +5231,7 @@ static int DNP3DecodeObjectG42V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5597,7 +5258,7 @@ static int DNP3DecodeObjectG42V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5607,16 +5268,12 @@ static int DNP3DecodeObjectG42V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG42V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG42V6 *object = NULL;
     uint32_t prefix = 0;
@@ -5624,7 +5281,7 @@ static int DNP3DecodeObjectG42V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5651,7 +5308,7 @@ static int DNP3DecodeObjectG42V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5661,16 +5318,12 @@ static int DNP3DecodeObjectG42V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG42V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG42V7 *object = NULL;
     uint32_t prefix = 0;
@@ -5678,7 +5331,7 @@ static int DNP3DecodeObjectG42V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5708,7 +5361,7 @@ static int DNP3DecodeObjectG42V7(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5718,16 +5371,12 @@ static int DNP3DecodeObjectG42V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG42V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG42V8 *object = NULL;
     uint32_t prefix = 0;
@@ -5735,7 +5384,7 @@ static int DNP3DecodeObjectG42V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5765,7 +5414,7 @@ static int DNP3DecodeObjectG42V8(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5775,16 +5424,12 @@ static int DNP3DecodeObjectG42V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG43V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG43V1 *object = NULL;
     uint32_t prefix = 0;
@@ -5792,7 +5437,7 @@ static int DNP3DecodeObjectG43V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5813,7 +5458,7 @@ static int DNP3DecodeObjectG43V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5823,16 +5468,12 @@ static int DNP3DecodeObjectG43V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG43V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG43V2 *object = NULL;
     uint32_t prefix = 0;
@@ -5840,7 +5481,7 @@ static int DNP3DecodeObjectG43V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5861,7 +5502,7 @@ static int DNP3DecodeObjectG43V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5871,16 +5512,12 @@ static int DNP3DecodeObjectG43V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG43V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG43V3 *object = NULL;
     uint32_t prefix = 0;
@@ -5888,7 +5525,7 @@ static int DNP3DecodeObjectG43V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5912,7 +5549,7 @@ static int DNP3DecodeObjectG43V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5922,16 +5559,12 @@ static int DNP3DecodeObjectG43V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG43V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG43V4 *object = NULL;
     uint32_t prefix = 0;
@@ -5939,7 +5572,7 @@ static int DNP3DecodeObjectG43V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -5963,7 +5596,7 @@ static int DNP3DecodeObjectG43V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -5973,16 +5606,12 @@ static int DNP3DecodeObjectG43V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG43V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG43V5 *object = NULL;
     uint32_t prefix = 0;
@@ -5990,7 +5619,7 @@ static int DNP3DecodeObjectG43V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6011,7 +5640,7 @@ static int DNP3DecodeObjectG43V5(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6021,16 +5650,12 @@ static int DNP3DecodeObjectG43V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG43V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG43V6 *object = NULL;
     uint32_t prefix = 0;
@@ -6038,7 +5663,7 @@ static int DNP3DecodeObjectG43V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6059,7 +5684,7 @@ static int DNP3DecodeObjectG43V6(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6069,16 +5694,12 @@ static int DNP3DecodeObjectG43V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG43V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG43V7 *object = NULL;
     uint32_t prefix = 0;
@@ -6086,7 +5707,7 @@ static int DNP3DecodeObjectG43V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6110,7 +5731,7 @@ static int DNP3DecodeObjectG43V7(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6120,16 +5741,12 @@ static int DNP3DecodeObjectG43V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG43V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG43V8 *object = NULL;
     uint32_t prefix = 0;
@@ -6137,7 +5754,7 @@ static int DNP3DecodeObjectG43V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6161,7 +5778,7 @@ static int DNP3DecodeObjectG43V8(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6171,16 +5788,12 @@ static int DNP3DecodeObjectG43V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG50V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG50V1 *object = NULL;
     uint32_t prefix = 0;
@@ -6188,7 +5801,7 @@ static int DNP3DecodeObjectG50V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6201,7 +5814,7 @@ static int DNP3DecodeObjectG50V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6211,16 +5824,12 @@ static int DNP3DecodeObjectG50V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG50V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG50V2 *object = NULL;
     uint32_t prefix = 0;
@@ -6228,7 +5837,7 @@ static int DNP3DecodeObjectG50V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6244,7 +5853,7 @@ static int DNP3DecodeObjectG50V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6254,16 +5863,12 @@ static int DNP3DecodeObjectG50V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG50V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG50V3 *object = NULL;
     uint32_t prefix = 0;
@@ -6271,7 +5876,7 @@ static int DNP3DecodeObjectG50V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6284,7 +5889,7 @@ static int DNP3DecodeObjectG50V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6294,16 +5899,12 @@ static int DNP3DecodeObjectG50V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG50V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG50V4 *object = NULL;
     uint32_t prefix = 0;
@@ -6311,7 +5912,7 @@ static int DNP3DecodeObjectG50V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6330,7 +5931,7 @@ static int DNP3DecodeObjectG50V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6340,16 +5941,12 @@ static int DNP3DecodeObjectG50V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG51V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG51V1 *object = NULL;
     uint32_t prefix = 0;
@@ -6357,7 +5954,7 @@ static int DNP3DecodeObjectG51V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6370,7 +5967,7 @@ static int DNP3DecodeObjectG51V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6380,16 +5977,12 @@ static int DNP3DecodeObjectG51V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG51V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG51V2 *object = NULL;
     uint32_t prefix = 0;
@@ -6397,7 +5990,7 @@ static int DNP3DecodeObjectG51V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6410,7 +6003,7 @@ static int DNP3DecodeObjectG51V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6420,16 +6013,12 @@ static int DNP3DecodeObjectG51V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG52V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG52V1 *object = NULL;
     uint32_t prefix = 0;
@@ -6437,7 +6026,7 @@ static int DNP3DecodeObjectG52V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6450,7 +6039,7 @@ static int DNP3DecodeObjectG52V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6460,16 +6049,12 @@ static int DNP3DecodeObjectG52V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG52V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG52V2 *object = NULL;
     uint32_t prefix = 0;
@@ -6477,7 +6062,7 @@ static int DNP3DecodeObjectG52V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6490,7 +6075,7 @@ static int DNP3DecodeObjectG52V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6500,16 +6085,12 @@ static int DNP3DecodeObjectG52V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG70V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG70V1 *object = NULL;
     uint32_t prefix = 0;
@@ -6517,7 +6098,7 @@ static int DNP3DecodeObjectG70V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6589,7 +6170,7 @@ static int DNP3DecodeObjectG70V1(const uint8_t **buf, uint32_t *len,
         }
         object->data[object->data_size] = '\0';
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6599,16 +6180,12 @@ static int DNP3DecodeObjectG70V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG70V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG70V2 *object = NULL;
     uint32_t prefix = 0;
@@ -6616,7 +6193,7 @@ static int DNP3DecodeObjectG70V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6661,7 +6238,7 @@ static int DNP3DecodeObjectG70V2(const uint8_t **buf, uint32_t *len,
         }
         object->password[object->password_size] = '\0';
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6671,16 +6248,12 @@ static int DNP3DecodeObjectG70V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG70V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG70V3 *object = NULL;
     uint32_t prefix = 0;
@@ -6688,7 +6261,7 @@ static int DNP3DecodeObjectG70V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6735,7 +6308,7 @@ static int DNP3DecodeObjectG70V3(const uint8_t **buf, uint32_t *len,
         }
         object->filename[object->filename_size] = '\0';
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6745,16 +6318,12 @@ static int DNP3DecodeObjectG70V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG70V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG70V4 *object = NULL;
     uint32_t prefix = 0;
@@ -6767,7 +6336,7 @@ static int DNP3DecodeObjectG70V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6805,7 +6374,7 @@ static int DNP3DecodeObjectG70V4(const uint8_t **buf, uint32_t *len,
         }
         object->optional_text[object->optional_text_len] = '\0';
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6815,16 +6384,12 @@ static int DNP3DecodeObjectG70V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG70V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG70V5 *object = NULL;
     uint32_t prefix = 0;
@@ -6837,7 +6402,7 @@ static int DNP3DecodeObjectG70V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6866,7 +6431,7 @@ static int DNP3DecodeObjectG70V5(const uint8_t **buf, uint32_t *len,
         }
         object->file_data[object->file_data_len] = '\0';
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6876,16 +6441,12 @@ static int DNP3DecodeObjectG70V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG70V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG70V6 *object = NULL;
     uint32_t prefix = 0;
@@ -6898,7 +6459,7 @@ static int DNP3DecodeObjectG70V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6930,7 +6491,7 @@ static int DNP3DecodeObjectG70V6(const uint8_t **buf, uint32_t *len,
         }
         object->optional_text[object->optional_text_len] = '\0';
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -6940,16 +6501,12 @@ static int DNP3DecodeObjectG70V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG70V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG70V7 *object = NULL;
     uint32_t prefix = 0;
@@ -6957,7 +6514,7 @@ static int DNP3DecodeObjectG70V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -6998,7 +6555,7 @@ static int DNP3DecodeObjectG70V7(const uint8_t **buf, uint32_t *len,
         }
         object->filename[object->filename_size] = '\0';
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7008,16 +6565,12 @@ static int DNP3DecodeObjectG70V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG70V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG70V8 *object = NULL;
     uint32_t prefix = 0;
@@ -7030,7 +6583,7 @@ static int DNP3DecodeObjectG70V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7053,7 +6606,7 @@ static int DNP3DecodeObjectG70V8(const uint8_t **buf, uint32_t *len,
         }
         object->file_specification[object->file_specification_len] = '\0';
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7063,16 +6616,12 @@ static int DNP3DecodeObjectG70V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG80V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG80V1 *object = NULL;
     int bytes = (count / 8) + 1;
@@ -7093,14 +6642,14 @@ static int DNP3DecodeObjectG80V1(const uint8_t **buf, uint32_t *len,
 
         for (int j = 0; j < 8 && count; j = j + 1) {
 
-            object = SCCalloc(1, sizeof(*object));
+            object = DNP3ArenaAlloc(arena, sizeof(*object));
             if (unlikely(object == NULL)) {
                 goto error;
             }
 
             object->state = (octet >> j) & 0x1;
 
-            if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+            if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
                 goto error;
             }
 
@@ -7113,15 +6662,12 @@ static int DNP3DecodeObjectG80V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
     return 0;
 }
 
 static int DNP3DecodeObjectG81V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG81V1 *object = NULL;
     uint32_t prefix = 0;
@@ -7129,7 +6675,7 @@ static int DNP3DecodeObjectG81V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7153,7 +6699,7 @@ static int DNP3DecodeObjectG81V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7163,16 +6709,12 @@ static int DNP3DecodeObjectG81V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG83V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG83V1 *object = NULL;
     uint32_t prefix = 0;
@@ -7180,7 +6722,7 @@ static int DNP3DecodeObjectG83V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7207,7 +6749,7 @@ static int DNP3DecodeObjectG83V1(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->data_objects = SCCalloc(1, object->length);
+            object->data_objects = DNP3ArenaAlloc(arena, object->length);
             if (unlikely(object->data_objects == NULL)) {
                 goto error;
             }
@@ -7216,7 +6758,7 @@ static int DNP3DecodeObjectG83V1(const uint8_t **buf, uint32_t *len,
             *len -= object->length;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7226,16 +6768,12 @@ static int DNP3DecodeObjectG83V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG86V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG86V2 *object = NULL;
     uint32_t prefix = 0;
@@ -7243,7 +6781,7 @@ static int DNP3DecodeObjectG86V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7267,7 +6805,7 @@ static int DNP3DecodeObjectG86V2(const uint8_t **buf, uint32_t *len,
             object->padding2 = (octet >> 7) & 0x1;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7277,16 +6815,12 @@ static int DNP3DecodeObjectG86V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG102V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG102V1 *object = NULL;
     uint32_t prefix = 0;
@@ -7294,7 +6828,7 @@ static int DNP3DecodeObjectG102V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7307,7 +6841,7 @@ static int DNP3DecodeObjectG102V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7317,16 +6851,12 @@ static int DNP3DecodeObjectG102V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V1 *object = NULL;
     uint32_t prefix = 0;
@@ -7339,7 +6869,7 @@ static int DNP3DecodeObjectG120V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7368,7 +6898,7 @@ static int DNP3DecodeObjectG120V1(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->challenge_data = SCCalloc(1, object->challenge_data_len);
+            object->challenge_data = DNP3ArenaAlloc(arena, object->challenge_data_len);
             if (unlikely(object->challenge_data == NULL)) {
                 goto error;
             }
@@ -7377,7 +6907,7 @@ static int DNP3DecodeObjectG120V1(const uint8_t **buf, uint32_t *len,
             *len -= object->challenge_data_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7387,16 +6917,12 @@ static int DNP3DecodeObjectG120V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V2 *object = NULL;
     uint32_t prefix = 0;
@@ -7409,7 +6935,7 @@ static int DNP3DecodeObjectG120V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7432,7 +6958,7 @@ static int DNP3DecodeObjectG120V2(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->mac_value = SCCalloc(1, object->mac_value_len);
+            object->mac_value = DNP3ArenaAlloc(arena, object->mac_value_len);
             if (unlikely(object->mac_value == NULL)) {
                 goto error;
             }
@@ -7441,7 +6967,7 @@ static int DNP3DecodeObjectG120V2(const uint8_t **buf, uint32_t *len,
             *len -= object->mac_value_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7451,16 +6977,12 @@ static int DNP3DecodeObjectG120V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V3(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V3 *object = NULL;
     uint32_t prefix = 0;
@@ -7468,7 +6990,7 @@ static int DNP3DecodeObjectG120V3(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7484,7 +7006,7 @@ static int DNP3DecodeObjectG120V3(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7494,16 +7016,12 @@ static int DNP3DecodeObjectG120V3(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V4(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V4 *object = NULL;
     uint32_t prefix = 0;
@@ -7511,7 +7029,7 @@ static int DNP3DecodeObjectG120V4(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7524,7 +7042,7 @@ static int DNP3DecodeObjectG120V4(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7534,16 +7052,12 @@ static int DNP3DecodeObjectG120V4(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V5(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V5 *object = NULL;
     uint32_t prefix = 0;
@@ -7556,7 +7070,7 @@ static int DNP3DecodeObjectG120V5(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7590,7 +7104,7 @@ static int DNP3DecodeObjectG120V5(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->challenge_data = SCCalloc(1, object->challenge_data_len);
+            object->challenge_data = DNP3ArenaAlloc(arena, object->challenge_data_len);
             if (unlikely(object->challenge_data == NULL)) {
                 goto error;
             }
@@ -7604,7 +7118,7 @@ static int DNP3DecodeObjectG120V5(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->mac_value = SCCalloc(1, object->mac_value_len);
+            object->mac_value = DNP3ArenaAlloc(arena, object->mac_value_len);
             if (unlikely(object->mac_value == NULL)) {
                 goto error;
             }
@@ -7613,7 +7127,7 @@ static int DNP3DecodeObjectG120V5(const uint8_t **buf, uint32_t *len,
             *len -= object->mac_value_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7623,16 +7137,12 @@ static int DNP3DecodeObjectG120V5(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V6(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V6 *object = NULL;
     uint32_t prefix = 0;
@@ -7645,7 +7155,7 @@ static int DNP3DecodeObjectG120V6(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7668,7 +7178,7 @@ static int DNP3DecodeObjectG120V6(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->wrapped_key_data = SCCalloc(1, object->wrapped_key_data_len);
+            object->wrapped_key_data = DNP3ArenaAlloc(arena, object->wrapped_key_data_len);
             if (unlikely(object->wrapped_key_data == NULL)) {
                 goto error;
             }
@@ -7677,7 +7187,7 @@ static int DNP3DecodeObjectG120V6(const uint8_t **buf, uint32_t *len,
             *len -= object->wrapped_key_data_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7687,16 +7197,12 @@ static int DNP3DecodeObjectG120V6(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V7(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V7 *object = NULL;
     uint32_t prefix = 0;
@@ -7709,7 +7215,7 @@ static int DNP3DecodeObjectG120V7(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7747,7 +7253,7 @@ static int DNP3DecodeObjectG120V7(const uint8_t **buf, uint32_t *len,
         }
         object->error_text[object->error_text_len] = '\0';
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7757,16 +7263,12 @@ static int DNP3DecodeObjectG120V7(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V8(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V8 *object = NULL;
     uint32_t prefix = 0;
@@ -7779,7 +7281,7 @@ static int DNP3DecodeObjectG120V8(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7802,7 +7304,7 @@ static int DNP3DecodeObjectG120V8(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->certificate = SCCalloc(1, object->certificate_len);
+            object->certificate = DNP3ArenaAlloc(arena, object->certificate_len);
             if (unlikely(object->certificate == NULL)) {
                 goto error;
             }
@@ -7811,7 +7313,7 @@ static int DNP3DecodeObjectG120V8(const uint8_t **buf, uint32_t *len,
             *len -= object->certificate_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7821,16 +7323,12 @@ static int DNP3DecodeObjectG120V8(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V9(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V9 *object = NULL;
     uint32_t prefix = 0;
@@ -7839,7 +7337,7 @@ static int DNP3DecodeObjectG120V9(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7856,7 +7354,7 @@ static int DNP3DecodeObjectG120V9(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->mac_value = SCCalloc(1, object->mac_value_len);
+            object->mac_value = DNP3ArenaAlloc(arena, object->mac_value_len);
             if (unlikely(object->mac_value == NULL)) {
                 goto error;
             }
@@ -7865,7 +7363,7 @@ static int DNP3DecodeObjectG120V9(const uint8_t **buf, uint32_t *len,
             *len -= object->mac_value_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7875,16 +7373,12 @@ static int DNP3DecodeObjectG120V9(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V10(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V10 *object = NULL;
     uint32_t prefix = 0;
@@ -7896,7 +7390,7 @@ static int DNP3DecodeObjectG120V10(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -7944,7 +7438,7 @@ static int DNP3DecodeObjectG120V10(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->user_public_key = SCCalloc(1, object->user_public_key_len);
+            object->user_public_key = DNP3ArenaAlloc(arena, object->user_public_key_len);
             if (unlikely(object->user_public_key == NULL)) {
                 goto error;
             }
@@ -7957,7 +7451,7 @@ static int DNP3DecodeObjectG120V10(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->certification_data = SCCalloc(1, object->certification_data_len);
+            object->certification_data = DNP3ArenaAlloc(arena, object->certification_data_len);
             if (unlikely(object->certification_data == NULL)) {
                 goto error;
             }
@@ -7966,7 +7460,7 @@ static int DNP3DecodeObjectG120V10(const uint8_t **buf, uint32_t *len,
             *len -= object->certification_data_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -7976,16 +7470,12 @@ static int DNP3DecodeObjectG120V10(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V11(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V11 *object = NULL;
     uint32_t prefix = 0;
@@ -7997,7 +7487,7 @@ static int DNP3DecodeObjectG120V11(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -8030,7 +7520,7 @@ static int DNP3DecodeObjectG120V11(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->master_challenge_data = SCCalloc(1, object->master_challenge_data_len);
+            object->master_challenge_data = DNP3ArenaAlloc(arena, object->master_challenge_data_len);
             if (unlikely(object->master_challenge_data == NULL)) {
                 goto error;
             }
@@ -8039,7 +7529,7 @@ static int DNP3DecodeObjectG120V11(const uint8_t **buf, uint32_t *len,
             *len -= object->master_challenge_data_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -8049,16 +7539,12 @@ static int DNP3DecodeObjectG120V11(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V12(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V12 *object = NULL;
     uint32_t prefix = 0;
@@ -8070,7 +7556,7 @@ static int DNP3DecodeObjectG120V12(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -8093,7 +7579,7 @@ static int DNP3DecodeObjectG120V12(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->challenge_data = SCCalloc(1, object->challenge_data_len);
+            object->challenge_data = DNP3ArenaAlloc(arena, object->challenge_data_len);
             if (unlikely(object->challenge_data == NULL)) {
                 goto error;
             }
@@ -8102,7 +7588,7 @@ static int DNP3DecodeObjectG120V12(const uint8_t **buf, uint32_t *len,
             *len -= object->challenge_data_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -8112,16 +7598,12 @@ static int DNP3DecodeObjectG120V12(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V13(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V13 *object = NULL;
     uint32_t prefix = 0;
@@ -8133,7 +7615,7 @@ static int DNP3DecodeObjectG120V13(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -8156,7 +7638,7 @@ static int DNP3DecodeObjectG120V13(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->encrypted_update_key_data = SCCalloc(1, object->encrypted_update_key_len);
+            object->encrypted_update_key_data = DNP3ArenaAlloc(arena, object->encrypted_update_key_len);
             if (unlikely(object->encrypted_update_key_data == NULL)) {
                 goto error;
             }
@@ -8165,7 +7647,7 @@ static int DNP3DecodeObjectG120V13(const uint8_t **buf, uint32_t *len,
             *len -= object->encrypted_update_key_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -8175,16 +7657,12 @@ static int DNP3DecodeObjectG120V13(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V14(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V14 *object = NULL;
     uint32_t prefix = 0;
@@ -8197,7 +7675,7 @@ static int DNP3DecodeObjectG120V14(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -8214,7 +7692,7 @@ static int DNP3DecodeObjectG120V14(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->digital_signature = SCCalloc(1, object->digital_signature_len);
+            object->digital_signature = DNP3ArenaAlloc(arena, object->digital_signature_len);
             if (unlikely(object->digital_signature == NULL)) {
                 goto error;
             }
@@ -8223,7 +7701,7 @@ static int DNP3DecodeObjectG120V14(const uint8_t **buf, uint32_t *len,
             *len -= object->digital_signature_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -8233,16 +7711,12 @@ static int DNP3DecodeObjectG120V14(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG120V15(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG120V15 *object = NULL;
     uint32_t prefix = 0;
@@ -8255,7 +7729,7 @@ static int DNP3DecodeObjectG120V15(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -8272,7 +7746,7 @@ static int DNP3DecodeObjectG120V15(const uint8_t **buf, uint32_t *len,
                 /* Not enough data. */
                 goto error;
             }
-            object->mac = SCCalloc(1, object->mac_len);
+            object->mac = DNP3ArenaAlloc(arena, object->mac_len);
             if (unlikely(object->mac == NULL)) {
                 goto error;
             }
@@ -8281,7 +7755,7 @@ static int DNP3DecodeObjectG120V15(const uint8_t **buf, uint32_t *len,
             *len -= object->mac_len;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -8291,16 +7765,12 @@ static int DNP3DecodeObjectG120V15(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG121V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG121V1 *object = NULL;
     uint32_t prefix = 0;
@@ -8308,7 +7778,7 @@ static int DNP3DecodeObjectG121V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -8338,7 +7808,7 @@ static int DNP3DecodeObjectG121V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -8348,16 +7818,12 @@ static int DNP3DecodeObjectG121V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG122V1(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG122V1 *object = NULL;
     uint32_t prefix = 0;
@@ -8365,7 +7831,7 @@ static int DNP3DecodeObjectG122V1(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -8395,7 +7861,7 @@ static int DNP3DecodeObjectG122V1(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -8405,16 +7871,12 @@ static int DNP3DecodeObjectG122V1(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 static int DNP3DecodeObjectG122V2(const uint8_t **buf, uint32_t *len,
     uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *points)
+    DNP3PointList *points, DNP3Arena *arena)
 {
     DNP3ObjectG122V2 *object = NULL;
     uint32_t prefix = 0;
@@ -8422,7 +7884,7 @@ static int DNP3DecodeObjectG122V2(const uint8_t **buf, uint32_t *len,
 
     while (count--) {
 
-        object = SCCalloc(1, sizeof(*object));
+        object = DNP3ArenaAlloc(arena, sizeof(*object));
         if (unlikely(object == NULL)) {
             goto error;
         }
@@ -8455,7 +7917,7 @@ static int DNP3DecodeObjectG122V2(const uint8_t **buf, uint32_t *len,
             goto error;
         }
 
-        if (!DNP3AddPoint(points, object, point_index, prefix_code, prefix)) {
+        if (!DNP3AddPoint(arena, points, object, point_index, prefix_code, prefix)) {
             goto error;
         }
 
@@ -8465,120 +7927,10 @@ static int DNP3DecodeObjectG122V2(const uint8_t **buf, uint32_t *len,
 
     return 1;
 error:
-    if (object != NULL) {
-        SCFree(object);
-    }
-
     return 0;
 }
 
 
-void DNP3FreeObjectPoint(int group, int variation, void *point)
-{
-    switch(DNP3_OBJECT_CODE(group, variation)) {
-        case DNP3_OBJECT_CODE(83, 1): {
-            DNP3ObjectG83V1 *object = (DNP3ObjectG83V1 *) point;
-            if (object->data_objects != NULL) {
-                SCFree(object->data_objects);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 1): {
-            DNP3ObjectG120V1 *object = (DNP3ObjectG120V1 *) point;
-            if (object->challenge_data != NULL) {
-                SCFree(object->challenge_data);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 2): {
-            DNP3ObjectG120V2 *object = (DNP3ObjectG120V2 *) point;
-            if (object->mac_value != NULL) {
-                SCFree(object->mac_value);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 5): {
-            DNP3ObjectG120V5 *object = (DNP3ObjectG120V5 *) point;
-            if (object->challenge_data != NULL) {
-                SCFree(object->challenge_data);
-            }
-            if (object->mac_value != NULL) {
-                SCFree(object->mac_value);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 6): {
-            DNP3ObjectG120V6 *object = (DNP3ObjectG120V6 *) point;
-            if (object->wrapped_key_data != NULL) {
-                SCFree(object->wrapped_key_data);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 8): {
-            DNP3ObjectG120V8 *object = (DNP3ObjectG120V8 *) point;
-            if (object->certificate != NULL) {
-                SCFree(object->certificate);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 9): {
-            DNP3ObjectG120V9 *object = (DNP3ObjectG120V9 *) point;
-            if (object->mac_value != NULL) {
-                SCFree(object->mac_value);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 10): {
-            DNP3ObjectG120V10 *object = (DNP3ObjectG120V10 *) point;
-            if (object->user_public_key != NULL) {
-                SCFree(object->user_public_key);
-            }
-            if (object->certification_data != NULL) {
-                SCFree(object->certification_data);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 11): {
-            DNP3ObjectG120V11 *object = (DNP3ObjectG120V11 *) point;
-            if (object->master_challenge_data != NULL) {
-                SCFree(object->master_challenge_data);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 12): {
-            DNP3ObjectG120V12 *object = (DNP3ObjectG120V12 *) point;
-            if (object->challenge_data != NULL) {
-                SCFree(object->challenge_data);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 13): {
-            DNP3ObjectG120V13 *object = (DNP3ObjectG120V13 *) point;
-            if (object->encrypted_update_key_data != NULL) {
-                SCFree(object->encrypted_update_key_data);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 14): {
-            DNP3ObjectG120V14 *object = (DNP3ObjectG120V14 *) point;
-            if (object->digital_signature != NULL) {
-                SCFree(object->digital_signature);
-            }
-            break;
-        }
-        case DNP3_OBJECT_CODE(120, 15): {
-            DNP3ObjectG120V15 *object = (DNP3ObjectG120V15 *) point;
-            if (object->mac != NULL) {
-                SCFree(object->mac);
-            }
-            break;
-        }
-        default:
-            break;
-    }
-    SCFree(point);
-}
-
 /**
  * \brief Decode a DNP3 object.
  *
@@ -8587,614 +7939,614 @@ void DNP3FreeObjectPoint(int group, int variation, void *point)
  */
 int DNP3DecodeObject(int group, int variation, const uint8_t **buf,
     uint32_t *len, uint8_t prefix_code, uint32_t start,
-    uint32_t count, DNP3PointList *points)
+    uint32_t count, DNP3PointList *points, DNP3Arena *arena)
 {
     int rc = 0;
 
     switch (DNP3_OBJECT_CODE(group, variation)) {
         case DNP3_OBJECT_CODE(1, 1):
             rc = DNP3DecodeObjectG1V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(1, 2):
             rc = DNP3DecodeObjectG1V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(2, 1):
             rc = DNP3DecodeObjectG2V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(2, 2):
             rc = DNP3DecodeObjectG2V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(2, 3):
             rc = DNP3DecodeObjectG2V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(3, 1):
             rc = DNP3DecodeObjectG3V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(3, 2):
             rc = DNP3DecodeObjectG3V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(4, 1):
             rc = DNP3DecodeObjectG4V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(4, 2):
             rc = DNP3DecodeObjectG4V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(4, 3):
             rc = DNP3DecodeObjectG4V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(10, 1):
             rc = DNP3DecodeObjectG10V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(10, 2):
             rc = DNP3DecodeObjectG10V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(11, 1):
             rc = DNP3DecodeObjectG11V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(11, 2):
             rc = DNP3DecodeObjectG11V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(12, 1):
             rc = DNP3DecodeObjectG12V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(12, 2):
             rc = DNP3DecodeObjectG12V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(12, 3):
             rc = DNP3DecodeObjectG12V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(13, 1):
             rc = DNP3DecodeObjectG13V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(13, 2):
             rc = DNP3DecodeObjectG13V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(20, 1):
             rc = DNP3DecodeObjectG20V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(20, 2):
             rc = DNP3DecodeObjectG20V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(20, 3):
             rc = DNP3DecodeObjectG20V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(20, 4):
             rc = DNP3DecodeObjectG20V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(20, 5):
             rc = DNP3DecodeObjectG20V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(20, 6):
             rc = DNP3DecodeObjectG20V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(20, 7):
             rc = DNP3DecodeObjectG20V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(20, 8):
             rc = DNP3DecodeObjectG20V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 1):
             rc = DNP3DecodeObjectG21V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 2):
             rc = DNP3DecodeObjectG21V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 3):
             rc = DNP3DecodeObjectG21V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 4):
             rc = DNP3DecodeObjectG21V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 5):
             rc = DNP3DecodeObjectG21V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 6):
             rc = DNP3DecodeObjectG21V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 7):
             rc = DNP3DecodeObjectG21V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 8):
             rc = DNP3DecodeObjectG21V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 9):
             rc = DNP3DecodeObjectG21V9(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 10):
             rc = DNP3DecodeObjectG21V10(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 11):
             rc = DNP3DecodeObjectG21V11(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(21, 12):
             rc = DNP3DecodeObjectG21V12(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(22, 1):
             rc = DNP3DecodeObjectG22V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(22, 2):
             rc = DNP3DecodeObjectG22V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(22, 3):
             rc = DNP3DecodeObjectG22V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(22, 4):
             rc = DNP3DecodeObjectG22V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(22, 5):
             rc = DNP3DecodeObjectG22V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(22, 6):
             rc = DNP3DecodeObjectG22V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(22, 7):
             rc = DNP3DecodeObjectG22V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(22, 8):
             rc = DNP3DecodeObjectG22V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(23, 1):
             rc = DNP3DecodeObjectG23V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(23, 2):
             rc = DNP3DecodeObjectG23V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(23, 3):
             rc = DNP3DecodeObjectG23V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(23, 4):
             rc = DNP3DecodeObjectG23V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(23, 5):
             rc = DNP3DecodeObjectG23V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(23, 6):
             rc = DNP3DecodeObjectG23V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(23, 7):
             rc = DNP3DecodeObjectG23V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(23, 8):
             rc = DNP3DecodeObjectG23V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(30, 1):
             rc = DNP3DecodeObjectG30V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(30, 2):
             rc = DNP3DecodeObjectG30V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(30, 3):
             rc = DNP3DecodeObjectG30V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(30, 4):
             rc = DNP3DecodeObjectG30V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(30, 5):
             rc = DNP3DecodeObjectG30V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(30, 6):
             rc = DNP3DecodeObjectG30V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(31, 1):
             rc = DNP3DecodeObjectG31V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(31, 2):
             rc = DNP3DecodeObjectG31V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(31, 3):
             rc = DNP3DecodeObjectG31V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(31, 4):
             rc = DNP3DecodeObjectG31V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(31, 5):
             rc = DNP3DecodeObjectG31V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(31, 6):
             rc = DNP3DecodeObjectG31V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(31, 7):
             rc = DNP3DecodeObjectG31V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(31, 8):
             rc = DNP3DecodeObjectG31V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(32, 1):
             rc = DNP3DecodeObjectG32V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(32, 2):
             rc = DNP3DecodeObjectG32V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(32, 3):
             rc = DNP3DecodeObjectG32V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(32, 4):
             rc = DNP3DecodeObjectG32V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(32, 5):
             rc = DNP3DecodeObjectG32V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(32, 6):
             rc = DNP3DecodeObjectG32V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(32, 7):
             rc = DNP3DecodeObjectG32V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(32, 8):
             rc = DNP3DecodeObjectG32V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(33, 1):
             rc = DNP3DecodeObjectG33V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(33, 2):
             rc = DNP3DecodeObjectG33V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(33, 3):
             rc = DNP3DecodeObjectG33V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(33, 4):
             rc = DNP3DecodeObjectG33V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(33, 5):
             rc = DNP3DecodeObjectG33V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(33, 6):
             rc = DNP3DecodeObjectG33V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(33, 7):
             rc = DNP3DecodeObjectG33V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(33, 8):
             rc = DNP3DecodeObjectG33V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(34, 1):
             rc = DNP3DecodeObjectG34V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(34, 2):
             rc = DNP3DecodeObjectG34V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(34, 3):
             rc = DNP3DecodeObjectG34V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(40, 1):
             rc = DNP3DecodeObjectG40V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(40, 2):
             rc = DNP3DecodeObjectG40V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(40, 3):
             rc = DNP3DecodeObjectG40V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(40, 4):
             rc = DNP3DecodeObjectG40V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(41, 1):
             rc = DNP3DecodeObjectG41V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(41, 2):
             rc = DNP3DecodeObjectG41V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(41, 3):
             rc = DNP3DecodeObjectG41V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(41, 4):
             rc = DNP3DecodeObjectG41V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(42, 1):
             rc = DNP3DecodeObjectG42V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(42, 2):
             rc = DNP3DecodeObjectG42V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(42, 3):
             rc = DNP3DecodeObjectG42V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(42, 4):
             rc = DNP3DecodeObjectG42V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(42, 5):
             rc = DNP3DecodeObjectG42V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(42, 6):
             rc = DNP3DecodeObjectG42V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(42, 7):
             rc = DNP3DecodeObjectG42V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(42, 8):
             rc = DNP3DecodeObjectG42V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(43, 1):
             rc = DNP3DecodeObjectG43V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(43, 2):
             rc = DNP3DecodeObjectG43V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(43, 3):
             rc = DNP3DecodeObjectG43V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(43, 4):
             rc = DNP3DecodeObjectG43V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(43, 5):
             rc = DNP3DecodeObjectG43V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(43, 6):
             rc = DNP3DecodeObjectG43V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(43, 7):
             rc = DNP3DecodeObjectG43V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(43, 8):
             rc = DNP3DecodeObjectG43V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(50, 1):
             rc = DNP3DecodeObjectG50V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(50, 2):
             rc = DNP3DecodeObjectG50V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(50, 3):
             rc = DNP3DecodeObjectG50V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(50, 4):
             rc = DNP3DecodeObjectG50V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(51, 1):
             rc = DNP3DecodeObjectG51V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(51, 2):
             rc = DNP3DecodeObjectG51V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(52, 1):
             rc = DNP3DecodeObjectG52V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(52, 2):
             rc = DNP3DecodeObjectG52V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(70, 1):
             rc = DNP3DecodeObjectG70V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(70, 2):
             rc = DNP3DecodeObjectG70V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(70, 3):
             rc = DNP3DecodeObjectG70V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(70, 4):
             rc = DNP3DecodeObjectG70V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(70, 5):
             rc = DNP3DecodeObjectG70V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(70, 6):
             rc = DNP3DecodeObjectG70V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(70, 7):
             rc = DNP3DecodeObjectG70V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(70, 8):
             rc = DNP3DecodeObjectG70V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(80, 1):
             rc = DNP3DecodeObjectG80V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(81, 1):
             rc = DNP3DecodeObjectG81V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(83, 1):
             rc = DNP3DecodeObjectG83V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(86, 2):
             rc = DNP3DecodeObjectG86V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(102, 1):
             rc = DNP3DecodeObjectG102V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 1):
             rc = DNP3DecodeObjectG120V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 2):
             rc = DNP3DecodeObjectG120V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 3):
             rc = DNP3DecodeObjectG120V3(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 4):
             rc = DNP3DecodeObjectG120V4(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 5):
             rc = DNP3DecodeObjectG120V5(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 6):
             rc = DNP3DecodeObjectG120V6(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 7):
             rc = DNP3DecodeObjectG120V7(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 8):
             rc = DNP3DecodeObjectG120V8(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 9):
             rc = DNP3DecodeObjectG120V9(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 10):
             rc = DNP3DecodeObjectG120V10(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 11):
             rc = DNP3DecodeObjectG120V11(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 12):
             rc = DNP3DecodeObjectG120V12(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 13):
             rc = DNP3DecodeObjectG120V13(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 14):
             rc = DNP3DecodeObjectG120V14(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(120, 15):
             rc = DNP3DecodeObjectG120V15(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(121, 1):
             rc = DNP3DecodeObjectG121V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(122, 1):
             rc = DNP3DecodeObjectG122V1(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         case DNP3_OBJECT_CODE(122, 2):
             rc = DNP3DecodeObjectG122V2(buf, len, prefix_code, start, count,
-                points);
+                points, arena);
             break;
         default:
             return DNP3_DECODER_EVENT_UNKNOWN_OBJECT;
@@ -1457,8 +1457,10 @@ typedef struct DNP3ObjectG122V2_ {
 
 int DNP3DecodeObject(int group, int variation, const uint8_t **buf,
     uint32_t *len, uint8_t prefix_code, uint32_t start, uint32_t count,
-    DNP3PointList *);
-DNP3PointList *DNP3PointListAlloc(void);
-void DNP3FreeObjectPointList(int group, int variation, DNP3PointList *);
+    DNP3PointList *, DNP3Arena *);
+DNP3PointList *DNP3PointListAlloc(DNP3Arena *);
+void *DNP3ArenaAlloc(DNP3Arena *, size_t);
+void DNP3ArenaReset(DNP3Arena *);
+void DNP3ArenaFree(DNP3Arena *);
 
 #endif /* __APP_LAYER_DNP3_OBJECTS_H__ */
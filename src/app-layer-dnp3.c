@@ -100,6 +100,32 @@ SCEnumCharMap dnp3_decoder_event_table[] = {
 /* Some DNP3 servers start with a banner. */
 static const char banner[] = "DNP3";
 
+/* Keep the decoded object points in the transaction. Only the DNP3
+ * logger and lua scripts look at them. */
+static bool dnp3_decode_points = false;
+
+/**
+ * \brief Keep the decoded points of the objects in the transactions.
+ *
+ * To be called at init by the users of the object points.
+ */
+void DNP3EnablePointDecoding(void)
+{
+    dnp3_decode_points = true;
+}
+
+bool DNP3PointDecodingEnabled(void)
+{
+    return dnp3_decode_points;
+}
+
+#ifdef UNITTESTS
+void DNP3SetPointDecoding(bool decode_points)
+{
+    dnp3_decode_points = decode_points;
+}
+#endif
+
 /* Calculate the next transport sequence number. */
 #define NEXT_TH_SEQNO(current) ((current + 1) % DNP3_MAX_TRAN_SEQNO)
 
@@ -442,6 +468,7 @@ static void *DNP3StateAlloc(void *orig_state, AppProto proto_orig)
         return NULL;
     }
     TAILQ_INIT(&dnp3->tx_list);
+    TAILQ_INIT(&dnp3->scratch_points);
 
     SCReturnPtr(dnp3, "void");
 }
@@ -633,30 +660,17 @@ static void DNP3BufferTrim(DNP3Buffer *buffer)
     }
 }
 
-/**
- * \brief Free a DNP3 object.
- */
-static void DNP3ObjectFree(DNP3Object *object)
-{
-    if (object->points != NULL) {
-        DNP3FreeObjectPointList(object->group, object->variation,
-            object->points);
-    }
-    SCFree(object);
-}
-
 /**
  * \breif Allocate a DNP3 object.
  */
-static DNP3Object *DNP3ObjectAlloc(void)
+static DNP3Object *DNP3ObjectAlloc(DNP3Arena *arena)
 {
-    DNP3Object *object = SCCalloc(1, sizeof(*object));
+    DNP3Object *object = DNP3ArenaAlloc(arena, sizeof(*object));
     if (unlikely(object == NULL)) {
         return NULL;
     }
-    object->points = DNP3PointListAlloc();
+    object->points = DNP3PointListAlloc(arena);
     if (object->points == NULL) {
-        DNP3ObjectFree(object);
         return NULL;
     }
     return object;
@@ -695,7 +709,7 @@ static int DNP3DecodeApplicationObjects(DNP3Transaction *tx, const uint8_t *buf,
         DNP3ObjHeader *header = (DNP3ObjHeader *)buf;
         offset += sizeof(DNP3ObjHeader);
 
-        DNP3Object *object = DNP3ObjectAlloc();
+        DNP3Object *object = DNP3ObjectAlloc(&tx->arena);
         if (unlikely(object == NULL)) {
             goto done;
         }
@@ -811,9 +825,22 @@ static int DNP3DecodeApplicationObjects(DNP3Transaction *tx, const uint8_t *buf,
             goto next;
         }
 
-        int event = DNP3DecodeObject(header->group, header->variation, &buf,
-            &len, object->prefix_code, object->start, object->count,
-            object->points);
+        /* The points have to be decoded to find the end of the
+         * object. If nothing uses them, decode them into the
+         * scratch space that is reused for the next object. */
+        int event;
+        if (dnp3_decode_points) {
+            event = DNP3DecodeObject(header->group, header->variation, &buf,
+                &len, object->prefix_code, object->start, object->count,
+                object->points, &tx->arena);
+        } else {
+            DNP3State *dnp3 = tx->dnp3;
+            event = DNP3DecodeObject(header->group, header->variation, &buf,
+                &len, object->prefix_code, object->start, object->count,
+                &dnp3->scratch_points, &dnp3->scratch);
+            DNP3ArenaReset(&dnp3->scratch);
+            TAILQ_INIT(&dnp3->scratch_points);
+        }
         if (event) {
             DNP3SetEventTx(tx, DNP3_DECODER_EVENT_UNKNOWN_OBJECT);
             goto done;
@@ -1351,19 +1378,6 @@ static uint64_t DNP3GetTxCnt(void *state)
     SCReturnUInt(count);
 }
 
-/**
- * \brief Free all the objects in a DNP3ObjectList.
- */
-static void DNP3TxFreeObjectList(DNP3ObjectList *objects)
-{
-    DNP3Object *object;
-
-    while ((object = TAILQ_FIRST(objects)) != NULL) {
-        TAILQ_REMOVE(objects, object, next);
-        DNP3ObjectFree(object);
-    }
-}
-
 /**
  * \brief Free a DNP3 transaction.
  */
@@ -1385,8 +1399,8 @@ static void DNP3TxFree(DNP3Transaction *tx)
         DetectEngineStateFree(tx->de_state);
     }
 
-    DNP3TxFreeObjectList(&tx->request_objects);
-    DNP3TxFreeObjectList(&tx->response_objects);
+    /* the request and response objects */
+    DNP3ArenaFree(&tx->arena);
 
     SCFree(tx);
     SCReturn;
@@ -1457,6 +1471,7 @@ static void DNP3StateFree(void *state)
         if (dnp3->response_buffer.buffer != NULL) {
             SCFree(dnp3->response_buffer.buffer);
         }
+        DNP3ArenaFree(&dnp3->scratch);
         SCFree(dnp3);
     }
     SCReturn;
@@ -2531,34 +2546,41 @@ static int DNP3ParserTestParsePDU01(void)
     PASS;
 }
 
+/* DNP3 fragment with a single 70:3 object. */
+static const uint8_t dnp3_g70v3_pkt[] = {
+    0x05, 0x64,
+    0x63, 0xc4, 0x04, 0x00, 0x03, 0x00, 0xc7, 0xee,
+    0xc7, 0xc9, 0x1b, 0x46, 0x03, 0x5b, 0x01, 0x55,
+    0x00, 0x1a, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00,
+    0x9e, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x1e, 0x00, 0x43,
+    0x3a, 0x2f, 0x74, 0x65, 0x6d, 0x70, 0x2f, 0x44,
+    0x4e, 0x50, 0x44, 0x65, 0x67, 0x7d, 0x76, 0x69,
+    0x63, 0x65, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67,
+    0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x93, 0x0c,
+    0x6e, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65,
+    0x6e, 0x20, 0x74, 0x6f, 0x20, 0x52, 0x65, 0x6d,
+    0x35, 0x20, 0x6f, 0x74, 0x65, 0x20, 0x44, 0x65,
+    0x76, 0x69, 0x63, 0x65, 0x2e, 0x78, 0x6d, 0x6c,
+    0xc4, 0x8b
+};
+
 /**
  * \test Test the decode of a DNP3 fragment with a single 70:3 object.
  */
 static int DNP3ParserDecodeG70V3Test(void)
 {
-    const uint8_t pkt[] = {
-        0x05, 0x64,
-        0x63, 0xc4, 0x04, 0x00, 0x03, 0x00, 0xc7, 0xee,
-        0xc7, 0xc9, 0x1b, 0x46, 0x03, 0x5b, 0x01, 0x55,
-        0x00, 0x1a, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00,
-        0x9e, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xff, 0xff, 0x00, 0x1e, 0x00, 0x43,
-        0x3a, 0x2f, 0x74, 0x65, 0x6d, 0x70, 0x2f, 0x44,
-        0x4e, 0x50, 0x44, 0x65, 0x67, 0x7d, 0x76, 0x69,
-        0x63, 0x65, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67,
-        0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x93, 0x0c,
-        0x6e, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65,
-        0x6e, 0x20, 0x74, 0x6f, 0x20, 0x52, 0x65, 0x6d,
-        0x35, 0x20, 0x6f, 0x74, 0x65, 0x20, 0x44, 0x65,
-        0x76, 0x69, 0x63, 0x65, 0x2e, 0x78, 0x6d, 0x6c,
-        0xc4, 0x8b
-    };
+    const uint8_t *pkt = dnp3_g70v3_pkt;
+    const uint32_t pkt_len = sizeof(dnp3_g70v3_pkt);
+
+    const bool decode_points = dnp3_decode_points;
+    dnp3_decode_points = true;
 
     DNP3State *dnp3state = DNP3StateAlloc(NULL, ALPROTO_UNKNOWN);
     FAIL_IF_NULL(dnp3state);
-    int bytes = DNP3HandleRequestLinkLayer(dnp3state, pkt, sizeof(pkt));
-    FAIL_IF(bytes != sizeof(pkt));
+    int bytes = DNP3HandleRequestLinkLayer(dnp3state, pkt, pkt_len);
+    FAIL_IF(bytes != pkt_len);
     DNP3Transaction *tx = DNP3GetTx(dnp3state, 0);
     FAIL_IF_NULL(tx);
     FAIL_IF_NOT(tx->has_request);
@@ -2579,6 +2601,43 @@ static int DNP3ParserDecodeG70V3Test(void)
         data->filename,
         "C:/temp/DNPDeviceConfiguration written to Remote Device.xml") == 0);
     DNP3StateFree(dnp3state);
+
+    dnp3_decode_points = decode_points;
+    PASS;
+}
+
+/**
+ * \test Test that the 70:3 object is decoded, but its points are not
+ *     kept if nothing uses them.
+ */
+static int DNP3ParserDecodeG70V3NoPointsTest(void)
+{
+    const bool decode_points = dnp3_decode_points;
+    dnp3_decode_points = false;
+
+    DNP3State *dnp3state = DNP3StateAlloc(NULL, ALPROTO_UNKNOWN);
+    FAIL_IF_NULL(dnp3state);
+    int bytes = DNP3HandleRequestLinkLayer(dnp3state, dnp3_g70v3_pkt,
+        sizeof(dnp3_g70v3_pkt));
+    FAIL_IF(bytes != sizeof(dnp3_g70v3_pkt));
+    DNP3Transaction *tx = DNP3GetTx(dnp3state, 0);
+    FAIL_IF_NULL(tx);
+    FAIL_IF_NOT(tx->has_request);
+    FAIL_IF_NOT(tx->request_complete);
+    DNP3Object *obj = TAILQ_FIRST(&tx->request_objects);
+    FAIL_IF_NULL(obj);
+    FAIL_IF_NOT(obj->group == 70);
+    FAIL_IF_NOT(obj->variation == 3);
+    FAIL_IF_NOT(obj->count == 1);
+    FAIL_IF_NULL(obj->points);
+    FAIL_IF_NOT(TAILQ_EMPTY(obj->points));
+    /* the scratch space is kept for the next object */
+    FAIL_IF_NOT(TAILQ_EMPTY(&dnp3state->scratch_points));
+    FAIL_IF_NULL(dnp3state->scratch.head);
+    FAIL_IF_NOT(dnp3state->scratch.head->used == 0);
+    DNP3StateFree(dnp3state);
+
+    dnp3_decode_points = decode_points;
     PASS;
 }
 
@@ -2680,6 +2739,8 @@ void DNP3ParserRegisterTests(void)
     UtRegisterTest("DNP3ParserTestFlooded", DNP3ParserTestFlooded);
     UtRegisterTest("DNP3ParserTestParsePDU01", DNP3ParserTestParsePDU01);
     UtRegisterTest("DNP3ParserDecodeG70V3Test", DNP3ParserDecodeG70V3Test);
+    UtRegisterTest("DNP3ParserDecodeG70V3NoPointsTest",
+                   DNP3ParserDecodeG70V3NoPointsTest);
     UtRegisterTest("DNP3ParserUnknownEventAlertTest",
         DNP3ParserUnknownEventAlertTest);
     UtRegisterTest("DNP3ParserIncorrectUserData", DNP3ParserIncorrectUserData);
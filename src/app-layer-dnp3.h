@@ -165,6 +165,27 @@ typedef struct DNP3ObjHeader_ {
     uint8_t qualifier;
 } __attribute__((packed)) DNP3ObjHeader;
 
+/**
+ * \brief Chunk of arena memory.
+ */
+typedef struct DNP3ArenaChunk_ {
+    struct DNP3ArenaChunk_ *next;
+    uint32_t size;    /**< Size of data. */
+    uint32_t used;    /**< Bytes of data handed out. */
+    uint8_t data[];
+} DNP3ArenaChunk;
+
+/**
+ * \brief Bump allocator for decoded objects and points.
+ *
+ * Memory is only released for the whole arena at once, so a response
+ * with many points costs a few chunk allocations instead of two
+ * allocations per point.
+ */
+typedef struct DNP3Arena_ {
+    DNP3ArenaChunk *head;  /**< Chunk currently allocated from. */
+} DNP3Arena;
+
 /**
  * \brief DNP3 object point.
  *
@@ -243,6 +264,9 @@ typedef struct DNP3Transaction_ {
                                          * we do not know. */
     DNP3ObjectList         response_objects;
 
+    DNP3Arena              arena; /**< Memory for the request and
+                                   * response objects. */
+
     AppLayerDecoderEvents *decoder_events; /**< Per transcation
                                             * decoder events. */
     DetectEngineState *de_state;
@@ -270,10 +294,19 @@ typedef struct DNP3State_ {
                                  * incomplete response PDUs received
                                  * over TCP. */
 
+    DNP3Arena scratch;          /**< Memory for points that are decoded
+                                 * but not kept. */
+    DNP3PointList scratch_points;
+
 } DNP3State;
 
 void RegisterDNP3Parsers(void);
 void DNP3ParserRegisterTests(void);
+void DNP3EnablePointDecoding(void);
+bool DNP3PointDecodingEnabled(void);
+#ifdef UNITTESTS
+void DNP3SetPointDecoding(bool decode_points);
+#endif
 int DNP3PrefixIsSize(uint8_t);
 
 #endif /* __APP_LAYER_DNP3_H__ */
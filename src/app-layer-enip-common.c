@@ -35,6 +35,83 @@
 
 #include "app-layer-enip-common.h"
 
+/** max number of service, segment and attribute records per flow */
+uint32_t enip_max_records = ENIP_MAX_RECORDS_DEFAULT;
+
+/** record stats: heap allocations, records taken from the flow pool and
+ *  records refused because the flow was over its budget */
+SC_ATOMIC_DECLARE(uint64_t, enip_records_alloc);
+SC_ATOMIC_DECLARE(uint64_t, enip_records_reused);
+SC_ATOMIC_DECLARE(uint64_t, enip_records_over_budget);
+
+uint64_t ENIPRecordsAllocGlobalCounter(void)
+{
+    return SC_ATOMIC_GET(enip_records_alloc);
+}
+
+uint64_t ENIPRecordsReusedGlobalCounter(void)
+{
+    return SC_ATOMIC_GET(enip_records_reused);
+}
+
+uint64_t ENIPRecordsOverBudgetGlobalCounter(void)
+{
+    return SC_ATOMIC_GET(enip_records_over_budget);
+}
+
+/**
+ * \brief Get a zeroed record from the flow's pool
+ *
+ * Records of freed transactions are reused. New records are only
+ * allocated while the flow is below its budget.
+ *
+ * @param state flow state
+ * @return record or NULL if over budget or out of memory
+ */
+void *ENIPRecordAlloc(ENIPState *state)
+{
+    ENIPRecord *r = state->free_records;
+    if (r != NULL) {
+        state->free_records = r->next_free;
+        (void)SC_ATOMIC_ADD(enip_records_reused, 1);
+    } else {
+        if (state->records >= enip_max_records) {
+            (void)SC_ATOMIC_ADD(enip_records_over_budget, 1);
+            return NULL;
+        }
+        r = SCMalloc(sizeof(*r));
+        if (unlikely(r == NULL))
+            return NULL;
+        state->records++;
+        (void)SC_ATOMIC_ADD(enip_records_alloc, 1);
+    }
+    memset(r, 0, sizeof(*r));
+    return r;
+}
+
+/**
+ * \brief Return a record to the flow's pool
+ */
+void ENIPRecordFree(ENIPState *state, void *record)
+{
+    ENIPRecord *r = record;
+    r->next_free = state->free_records;
+    state->free_records = r;
+}
+
+/**
+ * \brief Free the records in the flow's pool
+ */
+void ENIPRecordPoolFree(ENIPState *state)
+{
+    ENIPRecord *r;
+    while ((r = state->free_records) != NULL) {
+        state->free_records = r->next_free;
+        SCFree(r);
+        state->records--;
+    }
+}
+
 /**
  * \brief Extract 8 bits and move up the offset
  * @param res
@@ -127,13 +204,10 @@ static int ENIPExtractUint64(uint64_t *res, const uint8_t *input, uint16_t *offs
 static CIPServiceEntry *CIPServiceAlloc(ENIPTransaction *tx)
 {
 
-    CIPServiceEntry *svc = (CIPServiceEntry *) SCCalloc(1,
-            sizeof(CIPServiceEntry));
-    if (unlikely(svc == NULL))
+    CIPServiceEntry *svc = ENIPRecordAlloc(tx->enip);
+    if (svc == NULL)
         return NULL;
 
-    memset(svc, 0x00, sizeof(CIPServiceEntry));
-
     TAILQ_INIT(&svc->segment_list);
     TAILQ_INIT(&svc->attrib_list);
 
@@ -498,7 +572,7 @@ int DecodeCIPRequestPDU(const uint8_t *input, uint32_t input_len,
     // SCLogDebug("DecodeCIPRequestPDU: service 0x%x size %d", node->service,
     //         node->request.path_size);
 
-    DecodeCIPRequestPathPDU(input, input_len, node, offset);
+    DecodeCIPRequestPathPDU(input, input_len, enip_data, node, offset);
 
     offset += path_size * sizeof(uint16_t); //move offset past pathsize
 
@@ -569,7 +643,7 @@ int DecodeCIPRequestPDU(const uint8_t *input, uint32_t input_len,
  * @return 0 Packet not match
  */
 int DecodeCIPRequestPathPDU(const uint8_t *input, uint32_t input_len,
-        CIPServiceEntry *node, uint16_t offset)
+        ENIPTransaction *enip_data, CIPServiceEntry *node, uint16_t offset)
 {
     //SCLogDebug("DecodeCIPRequestPath: service 0x%x size %d length %d",
     //        node->service, node->request.path_size, input_len);
@@ -613,8 +687,8 @@ int DecodeCIPRequestPathPDU(const uint8_t *input, uint32_t input_len,
                 class = (uint16_t) req_path_class8;
                 SCLogDebug("DecodeCIPRequestPathPDU: 8bit class 0x%x", class);
 
-                seg = SCMalloc(sizeof(SegmentEntry));
-                if (unlikely(seg == NULL))
+                seg = ENIPRecordAlloc(enip_data->enip);
+                if (seg == NULL)
                     return 0;
                 seg->segment = segment;
                 seg->value = class;
@@ -639,8 +713,8 @@ int DecodeCIPRequestPathPDU(const uint8_t *input, uint32_t input_len,
                 //uint16_t attrib = (uint16_t) req_path_attr8;
                 //SCLogDebug("DecodeCIPRequestPath: 8bit attr 0x%x", attrib);
 
-                seg = SCMalloc(sizeof(SegmentEntry));
-                if (unlikely(seg == NULL))
+                seg = ENIPRecordAlloc(enip_data->enip);
+                if (seg == NULL)
                     return 0;
                 seg->segment = segment;
                 seg->value = class;
@@ -660,8 +734,8 @@ int DecodeCIPRequestPathPDU(const uint8_t *input, uint32_t input_len,
                 class = req_path_class16;
                 SCLogDebug("DecodeCIPRequestPath: 16bit class 0x%x", class);
 
-                seg = SCMalloc(sizeof(SegmentEntry));
-                if (unlikely(seg == NULL))
+                seg = ENIPRecordAlloc(enip_data->enip);
+                if (seg == NULL)
                     return 0;
                 seg->segment = segment;
                 seg->value = class;
@@ -721,8 +795,8 @@ int DecodeCIPRequestPathPDU(const uint8_t *input, uint32_t input_len,
             }
             SCLogDebug("DecodeCIPRequestPathPDU: attribute %d", attribute);
             //save attrs
-            AttributeEntry *attr = SCMalloc(sizeof(AttributeEntry));
-            if (unlikely(attr == NULL))
+            AttributeEntry *attr = ENIPRecordAlloc(enip_data->enip);
+            if (attr == NULL)
                 return 0;
             attr->attribute = attribute;
             TAILQ_INSERT_TAIL(&node->attrib_list, attr, next);
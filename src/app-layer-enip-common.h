@@ -192,6 +192,19 @@ typedef struct CIPServiceEntry_
     TAILQ_ENTRY(CIPServiceEntry_) next;
 } CIPServiceEntry;
 
+/** \brief Fixed size record for the per flow pool, holding one of the
+ *         service, segment or attribute entries */
+typedef union ENIPRecord_
+{
+    CIPServiceEntry svc;
+    SegmentEntry seg;
+    AttributeEntry attr;
+    union ENIPRecord_ *next_free;
+} ENIPRecord;
+
+/** default max number of records per flow */
+#define ENIP_MAX_RECORDS_DEFAULT    4096
+
 typedef struct ENIPTransaction_
 {
     struct ENIPState_ *enip;
@@ -229,8 +242,20 @@ typedef struct ENIPState_
     uint16_t offset;
     uint16_t record_len;
     uint8_t *buffer;
+
+    ENIPRecord *free_records;   /**< records of freed txs for reuse */
+    uint32_t records;           /**< records allocated, in use or free */
 } ENIPState;
 
+extern uint32_t enip_max_records;
+
+void *ENIPRecordAlloc(ENIPState *state);
+void ENIPRecordFree(ENIPState *state, void *record);
+void ENIPRecordPoolFree(ENIPState *state);
+uint64_t ENIPRecordsAllocGlobalCounter(void);
+uint64_t ENIPRecordsReusedGlobalCounter(void);
+uint64_t ENIPRecordsOverBudgetGlobalCounter(void);
+
 int DecodeENIPPDU(const uint8_t *input, uint32_t input_len,
         ENIPTransaction *enip_data);
 int DecodeCommonPacketFormatPDU(const uint8_t *input, uint32_t input_len,
@@ -242,7 +267,7 @@ int DecodeCIPRequestPDU(const uint8_t *input, uint32_t input_len,
 int DecodeCIPResponsePDU(const uint8_t *input, uint32_t input_len,
         ENIPTransaction *enip_data, uint16_t offset);
 int DecodeCIPRequestPathPDU(const uint8_t *input, uint32_t input_len,
-        CIPServiceEntry *node, uint16_t offset);
+        ENIPTransaction *enip_data, CIPServiceEntry *node, uint16_t offset);
 int DecodeCIPRequestMSPPDU(const uint8_t *input, uint32_t input_len,
         ENIPTransaction *enip_data, uint16_t offset);
 int DecodeCIPResponseMSPPDU(const uint8_t *input, uint32_t input_len,
@@ -190,17 +190,17 @@ static void ENIPTransactionFree(ENIPTransaction *tx, ENIPState *state)
         while ((seg = TAILQ_FIRST(&svc->segment_list)))
         {
             TAILQ_REMOVE(&svc->segment_list, seg, next);
-            SCFree(seg);
+            ENIPRecordFree(state, seg);
         }
 
         AttributeEntry *attr = NULL;
         while ((attr = TAILQ_FIRST(&svc->attrib_list)))
         {
             TAILQ_REMOVE(&svc->attrib_list, attr, next);
-            SCFree(attr);
+            ENIPRecordFree(state, attr);
         }
 
-        SCFree(svc);
+        ENIPRecordFree(state, svc);
     }
 
     AppLayerDecoderEventsFreeEvents(&tx->decoder_events);
@@ -236,6 +236,7 @@ static void ENIPStateFree(void *s)
             TAILQ_REMOVE(&enip_state->tx_list, tx, next);
             ENIPTransactionFree(tx, enip_state);
         }
+        ENIPRecordPoolFree(enip_state);
 
         if (enip_state->buffer != NULL)
         {
@@ -419,6 +420,23 @@ static uint16_t ENIPProbingParser(Flow *f, uint8_t direction,
     return ALPROTO_FAILED;
 }
 
+/** \internal
+ *  \brief Read the per flow record budget
+ */
+static void ENIPReadConfig(void)
+{
+    intmax_t value = 0;
+    if (ConfGetInt("app-layer.protocols.enip.max-records", &value) == 1) {
+        if (value <= 0 || value > UINT32_MAX) {
+            SCLogWarning(SC_ERR_INVALID_VALUE, "invalid value %"PRIdMAX" for "
+                    "enip max-records, using %u", value, enip_max_records);
+        } else {
+            enip_max_records = (uint32_t)value;
+            SCLogConfig("enip: max %u records per flow", enip_max_records);
+        }
+    }
+}
+
 /**
  * \brief Function to register the ENIP protocol parsers and other functions
  */
@@ -494,6 +512,8 @@ void RegisterENIPUDPParsers(void)
         AppLayerParserRegisterParserAcceptableDataDirection(IPPROTO_UDP,
                 ALPROTO_ENIP, STREAM_TOSERVER | STREAM_TOCLIENT);
 
+        ENIPReadConfig();
+
     } else
     {
         SCLogInfo(
@@ -576,6 +596,8 @@ void RegisterENIPTCPParsers(void)
         AppLayerParserRegisterOptionFlags(IPPROTO_TCP, ALPROTO_ENIP,
                 APP_LAYER_PARSER_OPT_ACCEPT_GAPS);
 
+        ENIPReadConfig();
+
     } else
     {
         SCLogConfig("Parser disabled for %s protocol. Protocol detection still on.",
@@ -644,11 +666,46 @@ static int ALDecodeENIPTest(void)
     PASS;
 }
 
+/**
+ * \brief Test the per flow record pool and budget
+ */
+static int ENIPRecordPoolTest(void)
+{
+    const uint32_t max_records = enip_max_records;
+    ENIPState state;
+    memset(&state, 0, sizeof(state));
+
+    enip_max_records = 2;
+    void *r1 = ENIPRecordAlloc(&state);
+    FAIL_IF_NULL(r1);
+    void *r2 = ENIPRecordAlloc(&state);
+    FAIL_IF_NULL(r2);
+    /* over budget */
+    FAIL_IF_NOT_NULL(ENIPRecordAlloc(&state));
+    FAIL_IF_NOT(state.records == 2);
+
+    /* freed records are reused */
+    ENIPRecordFree(&state, r1);
+    void *r3 = ENIPRecordAlloc(&state);
+    FAIL_IF_NOT(r3 == r1);
+    FAIL_IF_NOT(state.records == 2);
+
+    ENIPRecordFree(&state, r2);
+    ENIPRecordFree(&state, r3);
+    ENIPRecordPoolFree(&state);
+    FAIL_IF_NOT(state.records == 0);
+    FAIL_IF_NOT_NULL(state.free_records);
+
+    enip_max_records = max_records;
+    PASS;
+}
+
 #endif /* UNITTESTS */
 
 void ENIPParserRegisterTests(void)
 {
 #ifdef UNITTESTS
       UtRegisterTest("ALDecodeENIPTest", ALDecodeENIPTest);
+      UtRegisterTest("ENIPRecordPoolTest", ENIPRecordPoolTest);
 #endif /* UNITTESTS */
 }
@@ -35,11 +35,11 @@
 #include "conf.h"
 #include "util-mem.h"
 #include "util-misc.h"
+#include "util-memcap-credit.h"
 
 #include "app-layer-htp-mem.h"
 
 SC_ATOMIC_DECLARE(uint64_t, htp_config_memcap);
-SC_ATOMIC_DECLARE(uint64_t, htp_memuse);
 SC_ATOMIC_DECLARE(uint64_t, htp_memcap);
 
 void HTPParseMemcap()
@@ -66,26 +66,25 @@ void HTPParseMemcap()
         SC_ATOMIC_SET(htp_config_memcap, 0);
     }
 
-    SC_ATOMIC_INIT(htp_memuse);
+    MemcapCreditInit(MEMCAP_CREDIT_HTP);
     SC_ATOMIC_INIT(htp_memcap);
 }
 
 static void HTPIncrMemuse(uint64_t size)
 {
-    (void) SC_ATOMIC_ADD(htp_memuse, size);
+    MemcapCreditIncr(MEMCAP_CREDIT_HTP, size);
     return;
 }
 
 static void HTPDecrMemuse(uint64_t size)
 {
-    (void) SC_ATOMIC_SUB(htp_memuse, size);
+    MemcapCreditDecr(MEMCAP_CREDIT_HTP, size);
     return;
 }
 
 uint64_t HTPMemuseGlobalCounter(void)
 {
-    uint64_t tmpval = SC_ATOMIC_GET(htp_memuse);
-    return tmpval;
+    return MemcapCreditGetMemuse(MEMCAP_CREDIT_HTP);
 }
 
 uint64_t HTPMemcapGlobalCounter(void)
@@ -103,7 +102,7 @@ uint64_t HTPMemcapGlobalCounter(void)
 static int HTPCheckMemcap(uint64_t size)
 {
     uint64_t memcapcopy = SC_ATOMIC_GET(htp_config_memcap);
-    if (memcapcopy == 0 || size + SC_ATOMIC_GET(htp_memuse) <= memcapcopy)
+    if (memcapcopy == 0 || MemcapCreditCheck(MEMCAP_CREDIT_HTP, size, memcapcopy))
         return 1;
     (void) SC_ATOMIC_ADD(htp_memcap, 1);
     return 0;
@@ -116,7 +115,7 @@ static int HTPCheckMemcap(uint64_t size)
  */
 int HTPSetMemcap(uint64_t size)
 {
-    if (size == 0 || (uint64_t)SC_ATOMIC_GET(htp_memuse) < size) {
+    if (size == 0 || HTPMemuseGlobalCounter() < size) {
         SC_ATOMIC_SET(htp_config_memcap, size);
         return 1;
     }
@@ -93,6 +93,28 @@ static HTPCfgRec cfglist;
 
 SC_ATOMIC_DECLARE(uint32_t, htp_config_flags);
 
+/** response body decompression stats: txs for which decompression was
+ *  skipped as nothing uses the body, and the compressed and decompressed
+ *  size of the decompressed bodies */
+SC_ATOMIC_DECLARE(uint64_t, htp_decompress_skipped);
+SC_ATOMIC_DECLARE(uint64_t, htp_decompress_in);
+SC_ATOMIC_DECLARE(uint64_t, htp_decompress_out);
+
+uint64_t HTPDecompressSkippedGlobalCounter(void)
+{
+    return SC_ATOMIC_GET(htp_decompress_skipped);
+}
+
+uint64_t HTPDecompressInGlobalCounter(void)
+{
+    return SC_ATOMIC_GET(htp_decompress_in);
+}
+
+uint64_t HTPDecompressOutGlobalCounter(void)
+{
+    return SC_ATOMIC_GET(htp_decompress_out);
+}
+
 #ifdef DEBUG
 static SCMutex htp_state_mem_lock = SCMUTEX_INITIALIZER;
 static uint64_t htp_state_memuse = 0;
@@ -480,14 +502,14 @@ void AppLayerHtpEnableRequestBodyCallback(void)
 
 /**
  * \brief Sets a flag that informs the HTP app layer that some module in the
- *        engine needs the http request body data.
+ *        engine needs the http response body data.
  * \initonly
  */
 void AppLayerHtpEnableResponseBodyCallback(void)
 {
     SCEnter();
 
-    SC_ATOMIC_OR(htp_config_flags, HTP_REQUIRE_RESPONSE_BODY);
+    SC_ATOMIC_OR(htp_config_flags, HTP_REQUIRE_RESPONSE_BODY|HTP_REQUIRE_RESPONSE_BODY_DATA);
     SCReturn;
 }
 
@@ -517,9 +539,10 @@ void AppLayerHtpNeedFileInspection(void)
     SCEnter();
     AppLayerHtpNeedMultipartHeader();
     AppLayerHtpEnableRequestBodyCallback();
-    AppLayerHtpEnableResponseBodyCallback();
 
-    SC_ATOMIC_OR(htp_config_flags, HTP_REQUIRE_REQUEST_FILE);
+    /* files only need the response body in flows that track files, see
+     * HTPResponseBodyNeeded */
+    SC_ATOMIC_OR(htp_config_flags, HTP_REQUIRE_RESPONSE_BODY|HTP_REQUIRE_REQUEST_FILE);
     SCReturn;
 }
 
@@ -2093,6 +2116,50 @@ static int HTPCallbackRequestStart(htp_tx_t *tx)
     SCReturnInt(HTP_OK);
 }
 
+/**\internal
+ * \brief check if anything uses the response body of this flow
+ *
+ * The body content is used if a module asked for it (file_data rules,
+ * body logging). Otherwise it is only used by the file handling, which
+ * is off for a flow if detection disabled all file features for the
+ * to client direction and no file output forces them.
+ */
+static bool HTPResponseBodyNeeded(const HtpState *hstate)
+{
+    uint32_t flags = SC_ATOMIC_GET(htp_config_flags);
+    if (!(flags & HTP_REQUIRE_RESPONSE_BODY))
+        return false;
+    if (flags & HTP_REQUIRE_RESPONSE_BODY_DATA)
+        return true;
+    if (hstate->f == NULL)
+        return true;
+    return (hstate->f->file_flags & FLOWFILE_NONE_TC) != FLOWFILE_NONE_TC;
+}
+
+/**\internal
+ * \brief called when the response headers are complete
+ *
+ * libhtp sets up the response body decompressor after this callback. If
+ * no detection, logging or file extraction uses the response body, tell
+ * it not to decompress, as the decompressed data would be discarded or
+ * ignored anyway.
+ */
+static int HTPCallbackResponseHeaders(htp_tx_t *tx)
+{
+    HtpState *hstate = htp_connp_get_user_data(tx->connp);
+    if (hstate == NULL || hstate->cfg == NULL) {
+        SCReturnInt(HTP_OK);
+    }
+
+    if (tx->response_content_encoding_processing != HTP_COMPRESSION_NONE &&
+            hstate->cfg->decompress_on_demand && !HTPResponseBodyNeeded(hstate)) {
+        SCLogDebug("tx %p: response body not needed, skip decompression", tx);
+        tx->response_content_encoding_processing = HTP_COMPRESSION_NONE;
+        (void)SC_ATOMIC_ADD(htp_decompress_skipped, 1);
+    }
+    SCReturnInt(HTP_OK);
+}
+
 /**\internal
  * \brief called at start of response
  * Set min inspect size.
@@ -2182,6 +2249,12 @@ static int HTPCallbackResponse(htp_tx_t *tx)
     /* we have one whole transaction now */
     hstate->transaction_cnt++;
 
+    if (tx->response_content_encoding_processing != HTP_COMPRESSION_NONE &&
+            tx->response_message_len > 0) {
+        (void)SC_ATOMIC_ADD(htp_decompress_in, (uint64_t)tx->response_message_len);
+        (void)SC_ATOMIC_ADD(htp_decompress_out, (uint64_t)tx->response_entity_len);
+    }
+
     HtpTxUserData *htud = (HtpTxUserData *) htp_tx_get_user_data(tx);
     if (htud != NULL) {
         if (htud->tcflags & HTP_FILENAME_SET) {
@@ -2376,7 +2449,9 @@ static void HTPConfigSetDefaultsPhase1(HTPCfgRec *cfg_prec)
     htp_config_register_request_complete(cfg_prec->cfg, HTPCallbackRequest);
 
     htp_config_register_response_start(cfg_prec->cfg, HTPCallbackResponseStart);
+    htp_config_register_response_headers(cfg_prec->cfg, HTPCallbackResponseHeaders);
     htp_config_register_response_complete(cfg_prec->cfg, HTPCallbackResponse);
+    cfg_prec->decompress_on_demand = true;
 
     htp_config_set_parse_request_cookies(cfg_prec->cfg, 0);
 
@@ -2608,6 +2683,9 @@ static void HTPConfigParseParameters(HTPCfgRec *cfg_prec, ConfNode *s,
                 exit(EXIT_FAILURE);
             }
 
+        } else if (strcasecmp("response-body-decompress-on-demand", p->name) == 0) {
+            cfg_prec->decompress_on_demand = ConfValIsTrue(p->val);
+
         } else if (strcasecmp("response-body-decompress-layer-limit", p->name) == 0) {
             uint32_t value = 2;
             if (ParseSizeStringU32(p->val, &value) < 0) {
@@ -3148,6 +3226,9 @@ void RegisterHTPParsers(void)
         AppLayerParserRegisterParser(IPPROTO_TCP, ALPROTO_HTTP, STREAM_TOCLIENT,
                                      HTPHandleResponseData);
         SC_ATOMIC_INIT(htp_config_flags);
+        SC_ATOMIC_INIT(htp_decompress_skipped);
+        SC_ATOMIC_INIT(htp_decompress_in);
+        SC_ATOMIC_INIT(htp_decompress_out);
         /* This parser accepts gaps. */
         AppLayerParserRegisterOptionFlags(
                 IPPROTO_TCP, ALPROTO_HTTP, APP_LAYER_PARSER_OPT_ACCEPT_GAPS);
@@ -7027,6 +7108,88 @@ static int HTPParserTest27(void)
     PASS;
 }
 
+/** \internal
+ *  \brief parse a request and a gzip compressed response on a new flow
+ *  \param file_flags file flags of the flow, as set by detection
+ *  \retval entity_len response body length after decompression, or 0 */
+static uint64_t HTPParserTest28Run(const uint16_t file_flags)
+{
+    uint64_t entity_len = 0;
+    uint8_t httpbuf1[] = "GET /alice.txt HTTP/1.1\r\nHost: example.com\r\n\r\n";
+    uint32_t httplen1 = sizeof(httpbuf1) - 1; /* minus the \0 */
+    /* gzip of "Alice was beginning to get very tired" (37 bytes) */
+    uint8_t httpbuf2[] = "HTTP/1.1 200 OK\r\n"
+                         "Content-Encoding: gzip\r\n"
+                         "Content-Length: 57\r\n\r\n"
+                         "\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\xff\x73\xcc\xc9\x4c\x4e\x55"
+                         "\x28\x4f\x2c\x56\x48\x4a\x4d\xcf\xcc\xcb\xcb\xcc\x4b\x57\x28\xc9"
+                         "\x57\x48\x4f\x2d\x51\x28\x4b\x2d\xaa\x54\x28\xc9\x2c\x4a\x4d\x01"
+                         "\x00\x16\x43\xe2\x31\x25\x00\x00\x00";
+    uint32_t httplen2 = sizeof(httpbuf2) - 1; /* minus the \0 */
+    TcpSession ssn;
+    memset(&ssn, 0, sizeof(ssn));
+
+    AppLayerParserThreadCtx *alp_tctx = AppLayerParserThreadCtxAlloc();
+    if (alp_tctx == NULL)
+        return 0;
+    Flow *f = UTHBuildFlow(AF_INET, "1.2.3.4", "1.2.3.5", 1024, 80);
+    if (f == NULL)
+        goto end;
+    f->protoctx = &ssn;
+    f->proto = IPPROTO_TCP;
+    f->alproto = ALPROTO_HTTP;
+    f->file_flags = file_flags;
+
+    if (AppLayerParserParse(NULL, alp_tctx, f, ALPROTO_HTTP,
+                STREAM_TOSERVER | STREAM_START, httpbuf1, httplen1) != 0)
+        goto end;
+    if (AppLayerParserParse(NULL, alp_tctx, f, ALPROTO_HTTP,
+                STREAM_TOCLIENT | STREAM_START, httpbuf2, httplen2) != 0)
+        goto end;
+
+    HtpState *http_state = f->alstate;
+    if (http_state == NULL)
+        goto end;
+    htp_tx_t *tx = HTPStateGetTx(http_state, 0);
+    if (tx == NULL || tx->response_progress != HTP_RESPONSE_COMPLETE)
+        goto end;
+    entity_len = (uint64_t)tx->response_entity_len;
+end:
+    if (f != NULL)
+        UTHFreeFlow(f);
+    AppLayerParserThreadCtxFree(alp_tctx);
+    return entity_len;
+}
+
+/** \test response body decompression is skipped only if nothing needs
+ *        the body */
+static int HTPParserTest28(void)
+{
+    uint32_t flags = SC_ATOMIC_GET(htp_config_flags);
+    StreamTcpInitConfig(TRUE);
+
+    /* file handling uses the body, nothing else does */
+    SC_ATOMIC_SET(htp_config_flags, HTP_REQUIRE_RESPONSE_BODY);
+
+    /* no file features for the flow: left compressed */
+    uint64_t skipped = SC_ATOMIC_GET(htp_decompress_skipped);
+    FAIL_IF_NOT(HTPParserTest28Run(FLOWFILE_NONE) == 57);
+    FAIL_IF_NOT(SC_ATOMIC_GET(htp_decompress_skipped) == skipped + 1);
+
+    /* files are tracked in the flow: decompressed */
+    FAIL_IF_NOT(HTPParserTest28Run(FLOWFILE_NONE_TS) == 37);
+    FAIL_IF_NOT(HTPParserTest28Run(0) == 37);
+
+    /* body content used, e.g. by file_data: decompressed */
+    AppLayerHtpEnableResponseBodyCallback();
+    FAIL_IF_NOT(HTPParserTest28Run(FLOWFILE_NONE) == 37);
+    FAIL_IF_NOT(SC_ATOMIC_GET(htp_decompress_skipped) == skipped + 1);
+
+    StreamTcpFreeConfig(TRUE);
+    SC_ATOMIC_SET(htp_config_flags, flags);
+    PASS;
+}
+
 /**
  *  \brief  Register the Unit tests for the HTTP protocol
  */
@@ -7080,6 +7243,7 @@ static void HTPParserRegisterTests(void)
     UtRegisterTest("HTPParserTest25", HTPParserTest25);
     UtRegisterTest("HTPParserTest26", HTPParserTest26);
     UtRegisterTest("HTPParserTest27", HTPParserTest27);
+    UtRegisterTest("HTPParserTest28", HTPParserTest28);
 
     HTPFileParserRegisterTests();
     HTPXFFParserRegisterTests();
@@ -169,6 +169,9 @@ typedef struct HTPCfgRec_ {
     uint32_t            swf_decompress_depth;
     uint32_t            swf_compress_depth;
 
+    /** skip response body decompression if nothing uses the body */
+    bool                decompress_on_demand;
+
     HTPCfgDir request;
     HTPCfgDir response;
 } HTPCfgRec;
@@ -268,11 +271,17 @@ typedef struct HtpState_ {
 #define HTP_REQUIRE_REQUEST_FILE        (1 << 2)
 /** part of the engine needs the request body (e.g. file_data keyword) */
 #define HTP_REQUIRE_RESPONSE_BODY       (1 << 3)
+/** part of the engine inspects or logs the response body content itself,
+ *  not just the files in it (e.g. file_data keyword, body logging) */
+#define HTP_REQUIRE_RESPONSE_BODY_DATA  (1 << 4)
 
 SC_ATOMIC_EXTERN(uint32_t, htp_config_flags);
 
 void RegisterHTPParsers(void);
 void HTPAtExitPrintStats(void);
+uint64_t HTPDecompressSkippedGlobalCounter(void);
+uint64_t HTPDecompressInGlobalCounter(void);
+uint64_t HTPDecompressOutGlobalCounter(void);
 void HTPFreeConfig(void);
 
 void HtpBodyPrint(HtpBody *);
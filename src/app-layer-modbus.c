@@ -316,9 +316,17 @@ static ModbusTransaction *ModbusTxFindByTransaction(const ModbusState   *modbus,
 static ModbusTransaction *ModbusTxAlloc(ModbusState *modbus) {
     ModbusTransaction *tx;
 
-    tx = (ModbusTransaction *) SCCalloc(1, sizeof(ModbusTransaction));
-    if (unlikely(tx == NULL))
-        return NULL;
+    /* polling generates a request/response pair after another, so
+     * reuse the last freed tx instead of allocating a new one */
+    if (modbus->tx_free != NULL) {
+        tx = modbus->tx_free;
+        modbus->tx_free = NULL;
+        memset(tx, 0, sizeof(*tx));
+    } else {
+        tx = (ModbusTransaction *) SCCalloc(1, sizeof(ModbusTransaction));
+        if (unlikely(tx == NULL))
+            return NULL;
+    }
 
     modbus->transaction_max++;
     modbus->unreplied_cnt++;
@@ -342,24 +350,52 @@ static ModbusTransaction *ModbusTxAlloc(ModbusState *modbus) {
 }
 
 /** \internal
- *  \brief Free a Modbus Transaction
- *
- *  \retval Pointer to Transaction or NULL pointer
+ *  \brief Free the members of a Modbus Transaction
  */
-static void ModbusTxFree(ModbusTransaction *tx) {
-    SCEnter();
-    if (tx->data != NULL)
+static void ModbusTxCleanup(ModbusTransaction *tx) {
+    if (tx->data != NULL && tx->data != tx->data_inline)
         SCFree(tx->data);
 
     AppLayerDecoderEventsFreeEvents(&tx->decoder_events);
 
     if (tx->de_state != NULL)
         DetectEngineStateFree(tx->de_state);
+}
 
+/** \internal
+ *  \brief Free a Modbus Transaction
+ */
+static void ModbusTxFree(ModbusTransaction *tx) {
+    SCEnter();
+    ModbusTxCleanup(tx);
     SCFree(tx);
     SCReturn;
 }
 
+/** \internal
+ *  \brief Free a Modbus Transaction, keeping it for reuse by the state
+ *          if no other one is kept yet
+ */
+static void ModbusTxRecycle(ModbusState *modbus, ModbusTransaction *tx) {
+    if (modbus->tx_free == NULL) {
+        ModbusTxCleanup(tx);
+        modbus->tx_free = tx;
+    } else {
+        ModbusTxFree(tx);
+    }
+}
+
+/** \internal
+ *  \brief Get storage for 'cnt' write values of a transaction
+ *
+ *  Small writes use the storage in the transaction itself.
+ */
+static uint16_t *ModbusTxDataAlloc(ModbusTransaction *tx, uint32_t cnt) {
+    if (cnt <= MODBUS_TX_DATA_INLINE)
+        return tx->data_inline;
+    return (uint16_t *) SCCalloc(cnt, sizeof(uint16_t));
+}
+
 /**
  *  \brief Modbus transaction cleanup callback
  */
@@ -396,7 +432,7 @@ static void ModbusStateTxFree(void *state, uint64_t tx_id)
             modbus->givenup = 0;
 
         TAILQ_REMOVE(&modbus->tx_list, tx, next);
-        ModbusTxFree(tx);
+        ModbusTxRecycle(modbus, tx);
         break;
     }
     SCReturn;
@@ -738,7 +774,7 @@ static int ModbusParseWriteRequest(ModbusTransaction   *tx,
 
     if (type & MODBUS_TYP_COILS) {
         /* Output value (data block) unit is count */
-        tx->data = (uint16_t *) SCCalloc(1, count * sizeof(uint16_t));
+        tx->data = ModbusTxDataAlloc(tx, count);
         if (unlikely(tx->data == NULL))
             SCReturnInt(-1);
 
@@ -760,7 +796,7 @@ static int ModbusParseWriteRequest(ModbusTransaction   *tx,
         }
     } else {
         /* Registers value (data block) unit is quantity */
-        tx->data = (uint16_t *) SCCalloc(1, quantity * sizeof(uint16_t));
+        tx->data = ModbusTxDataAlloc(tx, quantity);
         if (unlikely(tx->data == NULL))
             SCReturnInt(-1);
 
@@ -1420,6 +1456,8 @@ static void ModbusStateFree(void *state)
         TAILQ_FOREACH_SAFE(tx, &modbus->tx_list, next, ttx) {
             ModbusTxFree(tx);
         }
+        if (modbus->tx_free != NULL)
+            SCFree(modbus->tx_free);
 
         SCFree(state);
     }
@@ -82,6 +82,9 @@ enum {
 /* Modbus Function Code. */
 #define MODBUS_FUNC_NONE                0x00
 
+/* Number of write values stored in the transaction itself. */
+#define MODBUS_TX_DATA_INLINE           8
+
 /* Modbus Transaction Structure, request/response. */
 typedef struct ModbusTransaction_ {
     struct ModbusState_ *modbus;
@@ -111,6 +114,7 @@ typedef struct ModbusTransaction_ {
         };
     };
     uint16_t    *data;  /**< to store data to write, bit is converted in 16bits. */
+    uint16_t    data_inline[MODBUS_TX_DATA_INLINE]; /**< storage for data of small writes. */
 
     AppLayerDecoderEvents *decoder_events;  /**< per tx events */
     DetectEngineState *de_state;
@@ -127,6 +131,7 @@ typedef struct ModbusState_ {
     uint32_t                            unreplied_cnt;  /**< number of unreplied requests */
     uint16_t                            events;
     uint8_t                             givenup;    /**< bool indicating flood. */
+    ModbusTransaction                   *tx_free;   /**< freed tx kept for reuse */
 } ModbusState;
 
 void RegisterModbusParsers(void);
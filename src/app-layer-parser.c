@@ -167,6 +167,11 @@ struct AppLayerParserState_ {
 
     /* Used to store decoder events. */
     AppLayerDecoderEvents *decoder_events;
+
+    /* Parser ctx of the flow's protocol, set by AppLayerParserParseUdp
+     * after the first message so the next ones skip the table lookups. */
+    const AppLayerParserProtoCtx *udp_ctx;
+    AppProto udp_alproto;   /**< protocol udp_ctx belongs to */
 };
 
 #ifdef UNITTESTS
@@ -1347,6 +1352,72 @@ int AppLayerParserParse(ThreadVars *tv, AppLayerParserThreadCtx *alp_tctx, Flow
     SCReturnInt(-1);
 }
 
+/**
+ *  \brief parse a UDP message
+ *
+ *  UDP messages are parsed one at a time, so the TCP specific parts of
+ *  AppLayerParserParse (gaps, incomplete data, stream depth and the
+ *  session flags) don't apply. The first message of a flow goes through
+ *  AppLayerParserParse to set up the states, after which the parser ctx
+ *  is cached in the parser state. Following messages call the parser
+ *  through the cached ctx directly.
+ *
+ *  \retval 0 ok
+ *  \retval -1 parser error
+ */
+int AppLayerParserParseUdp(ThreadVars *tv, AppLayerParserThreadCtx *alp_tctx, Flow *f,
+        uint8_t flags, const uint8_t *input, uint32_t input_len)
+{
+    SCEnter();
+    AppLayerParserState *pstate = f->alparser;
+
+    if (unlikely(pstate == NULL || pstate->udp_ctx == NULL ||
+                pstate->udp_alproto != f->alproto || f->alstate == NULL)) {
+        int r = AppLayerParserParse(tv, alp_tctx, f, f->alproto, flags, input, input_len);
+        pstate = f->alparser;
+        if (r == 0 && pstate != NULL && f->alstate != NULL) {
+            pstate->udp_ctx = &alp_ctx.ctxs[f->protomap][f->alproto];
+            pstate->udp_alproto = f->alproto;
+        }
+        SCReturnInt(r);
+    }
+
+    const AppLayerParserProtoCtx *p = pstate->udp_ctx;
+    void *alstate = f->alstate;
+    const int direction = (flags & STREAM_TOSERVER) ? 0 : 1;
+
+    SetEOFFlags(pstate, flags);
+    const uint64_t p_tx_cnt = p->StateGetTxCnt(alstate);
+
+    if (input_len > 0 || (flags & STREAM_EOF)) {
+        AppLayerResult res = p->Parser[direction](f, alstate, pstate,
+                input, input_len,
+                alp_tctx->alproto_local_storage[f->protomap][f->alproto],
+                flags);
+        /* incomplete is only supported for TCP, so it's an error here too
+         * if the return codes are used improperly */
+        if (res.status < 0 || (res.status > 0 &&
+                    (res.consumed > input_len || res.needed + res.consumed < input_len))) {
+            AppLayerParserSetEOF(pstate);
+            SCReturnInt(-1);
+        }
+    }
+
+    if (pstate->flags & APP_LAYER_PARSER_NO_INSPECTION) {
+        AppLayerParserSetEOF(pstate);
+        FlowSetNoPayloadInspectionFlag(f);
+    } else if (!(f->flags & FLOW_NOPAYLOAD_INSPECTION) &&
+            pstate->flags & APP_LAYER_PARSER_NO_INSPECTION_PAYLOAD) {
+        FlowSetNoPayloadInspectionFlag(f);
+    }
+
+    const uint64_t cur_tx_cnt = p->StateGetTxCnt(alstate);
+    if (cur_tx_cnt > p_tx_cnt && tv) {
+        AppLayerIncTxCounter(tv, f, cur_tx_cnt - p_tx_cnt);
+    }
+    SCReturnInt(0);
+}
+
 void AppLayerParserSetEOF(AppLayerParserState *pstate)
 {
     SCEnter();
@@ -1748,6 +1819,19 @@ void AppLayerParserRestoreParserTable(void)
     SCReturn;
 }
 
+static int test_udp_parser_calls = 0;
+
+static AppLayerResult TestProtocolParserUdp(Flow *f, void *test_state, AppLayerParserState *pstate,
+                              const uint8_t *input, uint32_t input_len,
+                              void *local_data, const uint8_t flags)
+{
+    test_udp_parser_calls++;
+    /* fail on a 0xff message */
+    if (input_len > 0 && input[0] == 0xff)
+        return APP_LAYER_ERROR;
+    return APP_LAYER_OK;
+}
+
 /**
  * \test Test the deallocation of app layer parser memory on occurance of
  *       error in the parsing process.
@@ -1860,6 +1944,59 @@ static int AppLayerParserTest02(void)
 }
 
 
+/**
+ * \test UDP fast path: parser ctx is cached after the first message
+ */
+static int AppLayerParserTest03(void)
+{
+    AppLayerParserBackupParserTable();
+
+    uint8_t okbuf[] = { 0x11 };
+    uint8_t errbuf[] = { 0xff };
+    AppLayerParserThreadCtx *alp_tctx = AppLayerParserThreadCtxAlloc();
+    FAIL_IF_NULL(alp_tctx);
+
+    AppLayerParserRegisterParser(IPPROTO_UDP, ALPROTO_TEST, STREAM_TOSERVER,
+                      TestProtocolParserUdp);
+    AppLayerParserRegisterParser(IPPROTO_UDP, ALPROTO_TEST, STREAM_TOCLIENT,
+                      TestProtocolParserUdp);
+    AppLayerParserRegisterStateFuncs(IPPROTO_UDP, ALPROTO_TEST,
+                          TestProtocolStateAlloc, TestProtocolStateFree);
+    AppLayerParserRegisterTxFreeFunc(IPPROTO_UDP, ALPROTO_TEST, TestStateTransactionFree);
+    AppLayerParserRegisterGetTx(IPPROTO_UDP, ALPROTO_TEST, TestGetTx);
+    AppLayerParserRegisterGetTxCnt(IPPROTO_UDP, ALPROTO_TEST, TestGetTxCnt);
+
+    Flow *f = UTHBuildFlow(AF_INET, "1.2.3.4", "4.3.2.1", 20, 40);
+    FAIL_IF_NULL(f);
+    f->alproto = ALPROTO_TEST;
+    f->proto = IPPROTO_UDP;
+    f->protomap = FlowGetProtoMapping(f->proto);
+    test_udp_parser_calls = 0;
+
+    FLOWLOCK_WRLOCK(f);
+    FAIL_IF_NOT(AppLayerParserParseUdp(NULL, alp_tctx, f, STREAM_TOSERVER,
+                okbuf, sizeof(okbuf)) == 0);
+    FAIL_IF_NULL(f->alparser);
+    FAIL_IF_NOT(f->alparser->udp_ctx == &alp_ctx.ctxs[f->protomap][ALPROTO_TEST]);
+
+    FAIL_IF_NOT(AppLayerParserParseUdp(NULL, alp_tctx, f, STREAM_TOCLIENT,
+                okbuf, sizeof(okbuf)) == 0);
+    FAIL_IF_NOT(AppLayerParserParseUdp(NULL, alp_tctx, f, STREAM_TOSERVER,
+                okbuf, sizeof(okbuf)) == 0);
+    FAIL_IF_NOT(test_udp_parser_calls == 3);
+
+    /* errors from the cached path are reported the same way */
+    FAIL_IF_NOT(AppLayerParserParseUdp(NULL, alp_tctx, f, STREAM_TOSERVER,
+                errbuf, sizeof(errbuf)) == -1);
+    FAIL_IF_NOT(AppLayerParserStateIssetFlag(f->alparser, APP_LAYER_PARSER_EOF_TS));
+    FLOWLOCK_UNLOCK(f);
+
+    AppLayerParserThreadCtxFree(alp_tctx);
+    AppLayerParserRestoreParserTable();
+    UTHFreeFlow(f);
+    PASS;
+}
+
 void AppLayerParserRegisterUnittests(void)
 {
     SCEnter();
@@ -1879,6 +2016,7 @@ void AppLayerParserRegisterUnittests(void)
 
     UtRegisterTest("AppLayerParserTest01", AppLayerParserTest01);
     UtRegisterTest("AppLayerParserTest02", AppLayerParserTest02);
+    UtRegisterTest("AppLayerParserTest03", AppLayerParserTest03);
 
     SCReturn;
 }
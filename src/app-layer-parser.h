@@ -244,6 +244,8 @@ void AppLayerParserApplyTxConfig(uint8_t ipproto, AppProto alproto,
 
 int AppLayerParserParse(ThreadVars *tv, AppLayerParserThreadCtx *tctx, Flow *f, AppProto alproto,
                    uint8_t flags, const uint8_t *input, uint32_t input_len);
+int AppLayerParserParseUdp(ThreadVars *tv, AppLayerParserThreadCtx *alp_tctx, Flow *f,
+        uint8_t flags, const uint8_t *input, uint32_t input_len);
 void AppLayerParserSetEOF(AppLayerParserState *pstate);
 bool AppLayerParserHasDecoderEvents(AppLayerParserState *pstate);
 int AppLayerParserProtocolIsTxEventAware(uint8_t ipproto, AppProto alproto);
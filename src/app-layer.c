@@ -39,15 +39,19 @@
 #include "flow.h"
 #include "flow-util.h"
 #include "flow-private.h"
+#include "flow-cpu-cost.h"
 #include "ippair.h"
 
+#include "util-cpu.h"
 #include "util-debug.h"
 #include "util-print.h"
 #include "util-profiling.h"
 #include "util-validate.h"
 #include "decode-events.h"
 
+#include "app-layer-htp.h"
 #include "app-layer-htp-mem.h"
+#include "app-layer-enip-common.h"
 
 /**
  * \brief This is for the app layer in general and it contains per thread
@@ -557,15 +561,9 @@ static int TCPProtoDetect(ThreadVars *tv,
     SCReturnInt(0);
 }
 
-/** \brief handle TCP data for the app-layer.
- *
- *  First run protocol detection and then when the protocol is known invoke
- *  the app layer parser.
- *
- *  \param stream ptr-to-ptr to stream object. Might change if flow dir is
- *                reversed.
- */
-int AppLayerHandleTCPData(ThreadVars *tv, TcpReassemblyThreadCtx *ra_ctx,
+/** \internal
+ *  \brief handle TCP data, see AppLayerHandleTCPData() */
+static int AppLayerHandleTCPDataDo(ThreadVars *tv, TcpReassemblyThreadCtx *ra_ctx,
                           Packet *p, Flow *f,
                           TcpSession *ssn, TcpStream **stream,
                           uint8_t *data, uint32_t data_len,
@@ -701,6 +699,36 @@ int AppLayerHandleTCPData(ThreadVars *tv, TcpReassemblyThreadCtx *ra_ctx,
     SCReturnInt(r);
 }
 
+/** \brief handle TCP data for the app-layer.
+ *
+ *  First run protocol detection and then when the protocol is known invoke
+ *  the app layer parser.
+ *
+ *  If per flow cpu accounting is enabled the cycles spent are added to
+ *  the flow's app-layer cost.
+ *
+ *  \param stream ptr-to-ptr to stream object. Might change if flow dir is
+ *                reversed.
+ */
+int AppLayerHandleTCPData(ThreadVars *tv, TcpReassemblyThreadCtx *ra_ctx,
+                          Packet *p, Flow *f,
+                          TcpSession *ssn, TcpStream **stream,
+                          uint8_t *data, uint32_t data_len,
+                          uint8_t flags)
+{
+    FlowCpuCost *cost = FlowCpuCostGet(f);
+    if (likely(cost == NULL)) {
+        return AppLayerHandleTCPDataDo(tv, ra_ctx, p, f, ssn, stream,
+                data, data_len, flags);
+    }
+
+    const uint64_t start = UtilCpuGetTicks();
+    int r = AppLayerHandleTCPDataDo(tv, ra_ctx, p, f, ssn, stream,
+            data, data_len, flags);
+    cost->app_layer += UtilCpuGetTicks() - start;
+    return r;
+}
+
 /**
  *  \brief Handle a app layer UDP message
  *
@@ -754,8 +782,8 @@ int AppLayerHandleUdp(ThreadVars *tv, AppLayerThreadCtx *tctx, Packet *p, Flow *
             }
 
             PACKET_PROFILING_APP_START(tctx, f->alproto);
-            r = AppLayerParserParse(tv, tctx->alp_tctx, f, f->alproto,
-                                    flags, p->payload, p->payload_len);
+            r = AppLayerParserParseUdp(tv, tctx->alp_tctx, f,
+                                       flags, p->payload, p->payload_len);
             PACKET_PROFILING_APP_END(tctx, f->alproto);
         } else {
             f->alproto = ALPROTO_FAILED;
@@ -773,7 +801,7 @@ int AppLayerHandleUdp(ThreadVars *tv, AppLayerThreadCtx *tctx, Packet *p, Flow *
 
         /* run the parser */
         PACKET_PROFILING_APP_START(tctx, f->alproto);
-        r = AppLayerParserParse(tv, tctx->alp_tctx, f, f->alproto,
+        r = AppLayerParserParseUdp(tv, tctx->alp_tctx, f,
                 flags, p->payload, p->payload_len);
         PACKET_PROFILING_APP_END(tctx, f->alproto);
         PACKET_PROFILING_APP_STORE(tctx, p);
@@ -899,8 +927,17 @@ void AppLayerRegisterGlobalCounters(void)
 {
     StatsRegisterGlobalCounter("http.memuse", HTPMemuseGlobalCounter);
     StatsRegisterGlobalCounter("http.memcap", HTPMemcapGlobalCounter);
+    StatsRegisterGlobalCounter("http.decompress_skipped", HTPDecompressSkippedGlobalCounter);
+    StatsRegisterGlobalCounter("http.decompress_bytes_in", HTPDecompressInGlobalCounter);
+    StatsRegisterGlobalCounter("http.decompress_bytes_out", HTPDecompressOutGlobalCounter);
     StatsRegisterGlobalCounter("ftp.memuse", FTPMemuseGlobalCounter);
     StatsRegisterGlobalCounter("ftp.memcap", FTPMemcapGlobalCounter);
+    StatsRegisterGlobalCounter("enip.records_alloc", ENIPRecordsAllocGlobalCounter);
+    StatsRegisterGlobalCounter("enip.records_reused", ENIPRecordsReusedGlobalCounter);
+    StatsRegisterGlobalCounter("enip.records_over_budget",
+            ENIPRecordsOverBudgetGlobalCounter);
+    StatsRegisterGlobalCounter("ssh.hassh_computed", rs_ssh_hassh_computed);
+    StatsRegisterGlobalCounter("ssh.hassh_skipped", rs_ssh_hassh_skipped);
     StatsRegisterGlobalCounter("app_layer.expectations", ExpectationGetCounter);
 }
 
@@ -528,6 +528,10 @@ void DecodeRegisterPerfCounters(DecodeThreadVars *dtv, ThreadVars *tv)
     dtv->counter_flow_get_used_eval_reject = StatsRegisterCounter("flow.get_used_eval_reject", tv);
     dtv->counter_flow_get_used_eval_busy = StatsRegisterCounter("flow.get_used_eval_busy", tv);
     dtv->counter_flow_get_used_failed = StatsRegisterCounter("flow.get_used_failed", tv);
+    dtv->counter_flow_get_used_tcp_new = StatsRegisterCounter("flow.get_used_tcp_unestablished", tv);
+    dtv->counter_flow_get_used_other = StatsRegisterCounter("flow.get_used_other", tv);
+    dtv->counter_flow_get_used_tcp_est = StatsRegisterCounter("flow.get_used_tcp_established", tv);
+    dtv->counter_flow_get_used_bypassed = StatsRegisterCounter("flow.get_used_bypassed", tv);
 
     dtv->counter_flow_spare_sync_avg = StatsRegisterAvgCounter("flow.wrk.spare_sync_avg", tv);
     dtv->counter_flow_spare_sync = StatsRegisterCounter("flow.wrk.spare_sync", tv);
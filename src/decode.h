@@ -690,6 +690,10 @@ typedef struct DecodeThreadVars_
     uint16_t counter_flow_get_used_eval_reject;
     uint16_t counter_flow_get_used_eval_busy;
     uint16_t counter_flow_get_used_failed;
+    uint16_t counter_flow_get_used_tcp_new;
+    uint16_t counter_flow_get_used_other;
+    uint16_t counter_flow_get_used_tcp_est;
+    uint16_t counter_flow_get_used_bypassed;
 
     uint16_t counter_flow_spare_sync;
     uint16_t counter_flow_spare_sync_empty;
@@ -18,6 +18,9 @@
 #include "suricata-common.h"
 
 #include "detect.h"
+#include "detect-engine.h"
+#include "detect-engine-build.h"
+#include "detect-parse.h"
 #include "detect-engine-alert.h"
 #include "detect-engine-threshold.h"
 #include "detect-engine-tag.h"
@@ -28,6 +31,8 @@
 #include "flow-private.h"
 
 #include "util-profiling.h"
+#include "util-unittest.h"
+#include "util-unittest-helper.h"
 
 /** tag signature we use for tag alerts */
 static Signature g_tag_signature;
@@ -178,7 +183,30 @@ int PacketAlertRemove(Packet *p, uint16_t pos)
     return match;
 }
 
+/** \internal
+ *  \brief grow the thread's alert queue
+ *  \retval 0 ok
+ *  \retval -1 allocation failed, queue unchanged
+ */
+static int AlertQueueExpand(DetectEngineThreadCtx *det_ctx)
+{
+    uint32_t new_cap = det_ctx->alert_queue_capacity * 2;
+    if (new_cap == 0)
+        new_cap = PACKET_ALERT_MAX;
+
+    PacketAlert *q = SCRealloc(det_ctx->alert_queue, new_cap * sizeof(PacketAlert));
+    if (unlikely(q == NULL))
+        return -1;
+    det_ctx->alert_queue = q;
+    det_ctx->alert_queue_capacity = new_cap;
+    SCLogDebug("alert queue expanded to %u", new_cap);
+    return 0;
+}
+
 /** \brief append a signature match to a packet
+ *
+ *  Alerts are queued in the thread ctx in the order they match. They are
+ *  sorted and moved to the packet in PacketAlertFinalize.
  *
  *  \param det_ctx thread detection engine ctx
  *  \param s the signature that matched
@@ -188,41 +216,38 @@ int PacketAlertRemove(Packet *p, uint16_t pos)
 int PacketAlertAppend(DetectEngineThreadCtx *det_ctx, const Signature *s,
         Packet *p, uint64_t tx_id, uint8_t flags)
 {
-    int i = 0;
-
-    if (p->alerts.cnt == PACKET_ALERT_MAX)
-        return 0;
-
     SCLogDebug("sid %"PRIu32"", s->id);
 
-    /* It should be usually the last, so check it before iterating */
-    if (p->alerts.cnt == 0 || (p->alerts.cnt > 0 &&
-                               p->alerts.alerts[p->alerts.cnt - 1].num < s->num)) {
-        /* We just add it */
-        p->alerts.alerts[p->alerts.cnt].num = s->num;
-        p->alerts.alerts[p->alerts.cnt].action = s->action;
-        p->alerts.alerts[p->alerts.cnt].flags = flags;
-        p->alerts.alerts[p->alerts.cnt].s = s;
-        p->alerts.alerts[p->alerts.cnt].tx_id = tx_id;
-    } else {
-        /* We need to make room for this s->num
-         (a bit ugly with memcpy but we are planning changes here)*/
-        for (i = p->alerts.cnt - 1; i >= 0 && p->alerts.alerts[i].num > s->num; i--) {
-            memcpy(&p->alerts.alerts[i + 1], &p->alerts.alerts[i], sizeof(PacketAlert));
+    if (det_ctx->alert_queue_size == det_ctx->alert_queue_capacity) {
+        if (AlertQueueExpand(det_ctx) != 0) {
+            StatsIncr(det_ctx->tv, det_ctx->counter_alerts_discarded);
+            return 0;
         }
-
-        i++; /* The right place to store the alert */
-
-        p->alerts.alerts[i].num = s->num;
-        p->alerts.alerts[i].action = s->action;
-        p->alerts.alerts[i].flags = flags;
-        p->alerts.alerts[i].s = s;
-        p->alerts.alerts[i].tx_id = tx_id;
+    }
+    if (det_ctx->alert_queue_size >= PACKET_ALERT_MAX) {
+        StatsIncr(det_ctx->tv, det_ctx->counter_alert_queue_overflow);
     }
 
-    /* Update the count */
-    p->alerts.cnt++;
+    PacketAlert *pa = &det_ctx->alert_queue[det_ctx->alert_queue_size++];
+    pa->num = s->num;
+    pa->action = s->action;
+    pa->flags = flags;
+    pa->s = s;
+    pa->tx_id = tx_id;
+    return 0;
+}
 
+/** \internal
+ *  \brief sort alerts by signature order, then by tx
+ */
+static int AlertQueueSortHelper(const void *a, const void *b)
+{
+    const PacketAlert *pa0 = a;
+    const PacketAlert *pa1 = b;
+    if (pa0->num != pa1->num)
+        return pa0->num > pa1->num ? 1 : -1;
+    if (pa0->tx_id != pa1->tx_id)
+        return pa0->tx_id > pa1->tx_id ? 1 : -1;
     return 0;
 }
 
@@ -238,13 +263,18 @@ int PacketAlertAppend(DetectEngineThreadCtx *det_ctx, const Signature *s,
 void PacketAlertFinalize(DetectEngineCtx *de_ctx, DetectEngineThreadCtx *det_ctx, Packet *p)
 {
     SCEnter();
-    int i = 0;
 
-    while (i < p->alerts.cnt) {
-        SCLogDebug("Sig->num: %"PRIu32, p->alerts.alerts[i].num);
-        const Signature *s = de_ctx->sig_array[p->alerts.alerts[i].num];
+    if (det_ctx->alert_queue_size > 1) {
+        qsort(det_ctx->alert_queue, det_ctx->alert_queue_size, sizeof(PacketAlert),
+                AlertQueueSortHelper);
+    }
+
+    for (uint32_t i = 0; i < det_ctx->alert_queue_size; i++) {
+        PacketAlert *pa = &det_ctx->alert_queue[i];
+        SCLogDebug("Sig->num: %"PRIu32, pa->num);
+        const Signature *s = de_ctx->sig_array[pa->num];
 
-        int res = PacketAlertHandle(de_ctx, det_ctx, s, p, &p->alerts.alerts[i]);
+        int res = PacketAlertHandle(de_ctx, det_ctx, s, p, pa);
         if (res > 0) {
             /* Now, if we have an alert, we have to check if we want
              * to tag this session or src/dst host */
@@ -287,18 +317,16 @@ void PacketAlertFinalize(DetectEngineCtx *de_ctx, DetectEngineThreadCtx *det_ctx
             }
 
             /* set actions on packet */
-            DetectSignatureApplyActions(p, p->alerts.alerts[i].s, p->alerts.alerts[i].flags);
+            DetectSignatureApplyActions(p, pa->s, pa->flags);
 
             if (PACKET_TEST_ACTION(p, ACTION_PASS)) {
-                /* Ok, reset the alert cnt to end in the previous of pass
-                 * so we ignore the rest with less prio */
-                p->alerts.cnt = i;
+                /* Ok, ignore this alert and the rest with less prio */
                 break;
 
             /* if the signature wants to drop, check if the
              * PACKET_ALERT_FLAG_DROP_FLOW flag is set. */
             } else if ((PACKET_TEST_ACTION(p, ACTION_DROP)) &&
-                    ((p->alerts.alerts[i].flags & PACKET_ALERT_FLAG_DROP_FLOW) ||
+                    ((pa->flags & PACKET_ALERT_FLAG_DROP_FLOW) ||
                          (s->flags & SIG_FLAG_APPLAYER))
                        && p->flow != NULL)
             {
@@ -309,14 +337,18 @@ void PacketAlertFinalize(DetectEngineCtx *de_ctx, DetectEngineThreadCtx *det_ctx
 
         /* Thresholding removes this alert */
         if (res == 0 || res == 2) {
-            PacketAlertRemove(p, i);
+            continue;
+        }
 
-            if (p->alerts.cnt == 0)
-                break;
+        /* actions are applied for all alerts, but only the ones with
+         * the highest prio are kept on the packet for the loggers */
+        if (p->alerts.cnt < PACKET_ALERT_MAX) {
+            p->alerts.alerts[p->alerts.cnt++] = *pa;
         } else {
-            i++;
+            StatsIncr(det_ctx->tv, det_ctx->counter_alerts_discarded);
         }
     }
+    det_ctx->alert_queue_size = 0;
 
     /* At this point, we should have all the new alerts. Now check the tag
      * keyword context for sessions and hosts */
@@ -330,4 +362,53 @@ void PacketAlertFinalize(DetectEngineCtx *de_ctx, DetectEngineThreadCtx *det_ctx
 
 }
 
+#ifdef UNITTESTS
+/** \test more matches than fit in p->alerts: all are handled, the ones
+ *        with the highest prio are kept */
+static int PacketAlertTest01(void)
+{
+    ThreadVars tv;
+    memset(&tv, 0, sizeof(tv));
+    DetectEngineThreadCtx *det_ctx = NULL;
+    uint8_t buf[] = "abcdef";
+
+    Packet *p = UTHBuildPacket(buf, sizeof(buf) - 1, IPPROTO_TCP);
+    FAIL_IF_NULL(p);
+
+    DetectEngineCtx *de_ctx = DetectEngineCtxInit();
+    FAIL_IF_NULL(de_ctx);
+    de_ctx->flags |= DE_QUIET;
+
+    /* sigs are prepended to the list, so sid 1 ends up with the lowest num */
+    for (int sid = 20; sid > 0; sid--) {
+        char sig[128];
+        snprintf(sig, sizeof(sig), "alert tcp any any -> any any "
+                "(content:\"abc\"; sid:%d;)", sid);
+        FAIL_IF_NULL(DetectEngineAppendSig(de_ctx, sig));
+    }
+    SigGroupBuild(de_ctx);
+    DetectEngineThreadCtxInit(&tv, (void *)de_ctx, (void *)&det_ctx);
+    FAIL_IF_NULL(det_ctx);
+
+    SigMatchSignatures(&tv, de_ctx, det_ctx, p);
+    FAIL_IF_NOT(p->alerts.cnt == PACKET_ALERT_MAX);
+    FAIL_IF_NOT(det_ctx->alert_queue_capacity >= 20);
+    FAIL_IF_NOT(det_ctx->alert_queue_size == 0);
+    for (int i = 0; i < p->alerts.cnt; i++) {
+        FAIL_IF_NOT(p->alerts.alerts[i].s->id == (uint32_t)(i + 1));
+    }
+    FAIL_IF(PacketAlertCheck(p, 16));
 
+    DetectEngineThreadCtxDeinit(&tv, det_ctx);
+    DetectEngineCtxFree(de_ctx);
+    UTHFreePacket(p);
+    PASS;
+}
+#endif /* UNITTESTS */
+
+void PacketAlertRegisterTests(void)
+{
+#ifdef UNITTESTS
+    UtRegisterTest("PacketAlertTest01", PacketAlertTest01);
+#endif /* UNITTESTS */
+}
@@ -35,5 +35,6 @@ int PacketAlertCheck(Packet *, uint32_t);
 int PacketAlertRemove(Packet *, uint16_t);
 void PacketAlertTagInit(void);
 PacketAlert *PacketAlertGetTag(void);
+void PacketAlertRegisterTests(void);
 
 #endif /* __DETECT_ENGINE_ALERT_H__ */
@@ -28,11 +28,13 @@
 #include "detect-engine-port.h"
 #include "detect-engine-prefilter.h"
 #include "detect-engine-proto.h"
+#include "detect-engine-payload.h"
 
 #include "detect-dsize.h"
 #include "detect-tcp-flags.h"
 #include "detect-flow.h"
 #include "detect-flowbits.h"
+#include "detect-file-data.h"
 
 #include "util-profiling.h"
 
@@ -1844,6 +1846,7 @@ static int SigMatchPrepare(DetectEngineCtx *de_ctx)
             SigMatch *sm = s->init_data->smlists[type];
             s->sm_arrays[type] = SigMatchList2DataArray(sm);
         }
+        DetectEnginePayloadGramsSetup(s);
         /* set up the pkt inspection engines */
         DetectEnginePktInspectionSetup(s);
 
@@ -1928,6 +1931,8 @@ int SigGroupBuild(DetectEngineCtx *de_ctx)
         FatalError(SC_ERR_FATAL, "initializing the detection engine failed");
     }
 
+    DetectFiledataSetupMaxDepth(de_ctx);
+
     if (SigMatchPrepare(de_ctx) != 0) {
         FatalError(SC_ERR_FATAL, "initializing the detection engine failed");
     }
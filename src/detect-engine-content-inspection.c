@@ -63,6 +63,196 @@
 #include "util-lua.h"
 #endif
 
+/** \internal
+ *  \brief get the op for a single sigmatch
+ *  \retval op or DETECT_CI_OP_NONE if it needs the recursive inspection
+ */
+static uint8_t DetectEngineContentInspectionGetOp(const SigMatchData *smd)
+{
+    if (smd->type != DETECT_CONTENT)
+        return DETECT_CI_OP_NONE;
+
+    const DetectContentData *cd = (const DetectContentData *)smd->ctx;
+    if (cd->flags & (DETECT_CONTENT_NEGATED|DETECT_CONTENT_REPLACE|
+                DETECT_CONTENT_ENDS_WITH|DETECT_CONTENT_DISTANCE_VAR|
+                DETECT_CONTENT_WITHIN_VAR|DETECT_CONTENT_DEPTH_VAR|
+                DETECT_CONTENT_OFFSET_VAR))
+        return DETECT_CI_OP_NONE;
+
+    if (cd->flags & (DETECT_CONTENT_DISTANCE|DETECT_CONTENT_WITHIN))
+        return DETECT_CI_OP_CONTENT_REL;
+    return DETECT_CI_OP_CONTENT;
+}
+
+/**
+ * \brief Compile a SigMatchData array into a content inspection program
+ *
+ * The array is walked backwards. Each element gets an op if it and all
+ * the elements following it can be run by the non-recursive interpreter.
+ * So a list like 'pcre; content; content' gets ops for the contents only,
+ * and the recursive inspection hands over to the interpreter once it gets
+ * to them. Programs are limited to DETECT_CI_PROG_MAX elements.
+ *
+ * \param smd array to compile, the ops are stored in the elements
+ * \param len number of elements in the array
+ */
+void DetectEngineContentInspectionCompile(SigMatchData *smd, const int len)
+{
+    bool compiled = true;
+    for (int i = len - 1; i >= 0; i--) {
+        uint8_t op = DETECT_CI_OP_NONE;
+        if (compiled && (len - i) <= DETECT_CI_PROG_MAX)
+            op = DetectEngineContentInspectionGetOp(&smd[i]);
+        if (op == DETECT_CI_OP_NONE)
+            compiled = false;
+        smd[i].ci_op = op;
+    }
+}
+
+/** \internal
+ *  \brief run a compiled content inspection program
+ *
+ *  Non-recursive version of DetectEngineContentInspection for the compiled
+ *  content ops. Each level of the program has an entry on the backtrack
+ *  stack, so that if a content fails we can continue the search of the
+ *  content it is relative to, like the recursive inspection does when a
+ *  call for 'smd+1' fails. The inspection_recursion_counter is updated for
+ *  each level entered, so the limit and step counts are unchanged.
+ *
+ *  \retval 0 no match
+ *  \retval 1 match
+ */
+static int DetectEngineContentInspectionRun(DetectEngineCtx *de_ctx,
+        DetectEngineThreadCtx *det_ctx, const SigMatchData *prog,
+        const uint8_t *buffer, const uint32_t buffer_len,
+        const uint32_t stream_start_offset)
+{
+    struct {
+        uint32_t prev_buffer_offset;    /**< relative offset at level entry */
+        uint32_t prev_offset;           /**< offset to retry from, or 0 */
+    } stack[DETECT_CI_PROG_MAX];
+    int level = 0;
+    int r = 0;
+
+    KEYWORD_PROFILING_START;
+
+    det_ctx->inspection_recursion_counter++;
+    if (det_ctx->inspection_recursion_counter == de_ctx->inspection_recursion_limit) {
+        det_ctx->discontinue_matching = 1;
+        goto end;
+    }
+    if (buffer_len == 0)
+        goto end;
+
+    stack[0].prev_buffer_offset = det_ctx->buffer_offset;
+    stack[0].prev_offset = 0;
+
+    while (1) {
+        const SigMatchData *smd = &prog[level];
+        const DetectContentData *cd = (const DetectContentData *)smd->ctx;
+        const uint32_t prev_buffer_offset = stack[level].prev_buffer_offset;
+        uint32_t offset;
+        uint32_t depth = buffer_len;
+
+        if (smd->ci_op == DETECT_CI_OP_CONTENT_REL) {
+            offset = prev_buffer_offset;
+
+            int distance = cd->distance;
+            if (cd->flags & DETECT_CONTENT_DISTANCE) {
+                if (distance < 0 && (uint32_t)(abs(distance)) > offset)
+                    offset = 0;
+                else
+                    offset += distance;
+            }
+            if (cd->flags & DETECT_CONTENT_WITHIN) {
+                if ((int32_t)depth > (int32_t)(prev_buffer_offset + cd->within + distance)) {
+                    depth = prev_buffer_offset + cd->within + distance;
+                }
+                if (stream_start_offset != 0 && prev_buffer_offset == 0) {
+                    if (depth <= stream_start_offset)
+                        goto backtrack;
+                    else if (depth < (stream_start_offset + buffer_len))
+                        depth = depth - stream_start_offset;
+                }
+            }
+            if (cd->depth != 0 && (cd->depth + prev_buffer_offset) < depth) {
+                depth = prev_buffer_offset + cd->depth;
+            }
+            if (cd->offset > offset) {
+                offset = cd->offset;
+            }
+        } else {
+            if (cd->depth != 0) {
+                depth = cd->depth;
+            }
+            if (stream_start_offset != 0 && cd->flags & DETECT_CONTENT_DEPTH) {
+                if (depth <= stream_start_offset)
+                    goto backtrack;
+                else if (depth < (stream_start_offset + buffer_len))
+                    depth = depth - stream_start_offset;
+            }
+            offset = cd->offset;
+        }
+
+        if (stack[level].prev_offset != 0)
+            offset = stack[level].prev_offset;
+        if (depth > buffer_len)
+            depth = buffer_len;
+        SCLogDebug("level %d content %"PRIu32" offset %"PRIu32", depth %"PRIu32,
+                level, cd->id, offset, depth);
+        if (offset > depth || depth == 0)
+            goto backtrack;
+
+        const uint8_t *found = NULL;
+        if (cd->content_len <= depth - offset) {
+            found = SpmScan(cd->spm_ctx, det_ctx->spm_thread_ctx,
+                    buffer + offset, depth - offset);
+        }
+        if (found == NULL) {
+            /* independent match from previous matches, so failure is fatal */
+            if (smd->ci_op == DETECT_CI_OP_CONTENT)
+                det_ctx->discontinue_matching = 1;
+            goto backtrack;
+        }
+
+        const uint32_t match_offset = (uint32_t)((found - buffer) + cd->content_len);
+        det_ctx->buffer_offset = match_offset;
+        if (smd->is_last) {
+            r = 1;
+            goto end;
+        }
+        /* if the next level fails we continue after the start of this match */
+        stack[level].prev_offset = match_offset - (cd->content_len - 1);
+
+        det_ctx->inspection_recursion_counter++;
+        if (det_ctx->inspection_recursion_counter == de_ctx->inspection_recursion_limit) {
+            det_ctx->discontinue_matching = 1;
+            goto end;
+        }
+        level++;
+        stack[level].prev_buffer_offset = match_offset;
+        stack[level].prev_offset = 0;
+        continue;
+
+backtrack:
+        if (level == 0 || det_ctx->discontinue_matching)
+            goto end;
+        level--;
+        /* no reason to look for another instance if the failed level doesn't
+         * depend on this one */
+        if ((((const DetectContentData *)prog[level].ctx)->flags & DETECT_CONTENT_WITHIN_NEXT) == 0) {
+            det_ctx->discontinue_matching = 1;
+            goto end;
+        }
+        SCLogDebug("backtracking to level %d, prev_offset %"PRIu32,
+                level, stack[level].prev_offset);
+    }
+
+end:
+    KEYWORD_PROFILING_END(det_ctx, DETECT_CONTENT, r);
+    return r;
+}
+
 /**
  * \brief Run the actual payload match functions
  *
@@ -109,6 +299,13 @@ int DetectEngineContentInspection(DetectEngineCtx *de_ctx, DetectEngineThreadCtx
                                   uint8_t inspection_mode)
 {
     SCEnter();
+
+    if (smd != NULL && smd->ci_op != DETECT_CI_OP_NONE) {
+        int r = DetectEngineContentInspectionRun(de_ctx, det_ctx, smd,
+                buffer, buffer_len, stream_start_offset);
+        SCReturnInt(r);
+    }
+
     KEYWORD_PROFILING_START;
 
     det_ctx->inspection_recursion_counter++;
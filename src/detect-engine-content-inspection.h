@@ -45,6 +45,21 @@ enum {
  *  inspection function contains both start and end of the data. */
 #define DETECT_CI_FLAGS_SINGLE  (DETECT_CI_FLAGS_START|DETECT_CI_FLAGS_END)
 
+/** ops of the compiled content inspection program. An element only gets
+ *  an op if it and all elements after it in the list can be run by the
+ *  non-recursive interpreter, see DetectEngineContentInspectionCompile() */
+enum {
+    DETECT_CI_OP_NONE = 0,      /**< generic recursive inspection */
+    DETECT_CI_OP_CONTENT,       /**< content with fixed offset/depth */
+    DETECT_CI_OP_CONTENT_REL,   /**< content with fixed distance/within */
+};
+
+/** max number of elements in a compiled program, this is the size of the
+ *  backtrack stack of the interpreter */
+#define DETECT_CI_PROG_MAX      16
+
+void DetectEngineContentInspectionCompile(SigMatchData *smd, const int len);
+
 int DetectEngineContentInspection(DetectEngineCtx *de_ctx, DetectEngineThreadCtx *det_ctx,
                                   const Signature *s, const SigMatchData *smd,
                                   Packet *p, Flow *f,
@@ -31,6 +31,7 @@
 #include "detect.h"
 #include "detect-engine.h"
 #include "detect-parse.h"
+#include "detect-content.h"
 #include "detect-engine-content-inspection.h"
 #include "detect-engine-prefilter.h"
 #include "detect-engine-state.h"
@@ -51,19 +52,80 @@
 struct StreamMpmData {
     DetectEngineThreadCtx *det_ctx;
     const MpmCtx *mpm_ctx;
+    TcpStream *stream;
 };
 
-static int StreamMpmFunc(void *cb_data, const uint8_t *data, const uint32_t data_len)
+/** \internal
+ *  \brief update the stream's MPM scan tracker for a block of data and
+ *         get the part of the block that still needs scanning
+ *
+ *  The tracker records up to which offset the stream was scanned by the
+ *  MPM ctx of the rule group. Data before that is only rescanned for
+ *  the length of the longest pattern minus one, so patterns crossing
+ *  the previous right edge are still found.
+ *
+ *  The tracker is reset when the MPM ctx or the detect engine version
+ *  changes. The version is needed because the MPM ctx of a reloaded
+ *  engine can end up at the address of a freed one.
+ *
+ *  \param version version of the detect engine owning \a mpm_ctx
+ *  \param skip_scanned if false the whole block is scanned, but the
+ *                      tracker and new_len are still updated
+ *  \param[out] skip bytes at the start of the block not to scan
+ *  \param[out] new_len bytes in the block not scanned before
+ */
+static void StreamMpmTrackerUpdate(TcpStream *stream, const uint32_t version,
+        const MpmCtx *mpm_ctx, const uint64_t offset, const uint32_t data_len, const bool skip_scanned,
+        uint32_t *skip, uint32_t *new_len)
+{
+    const uint64_t right_edge = offset + data_len;
+
+    if (stream->raw_mpm_ctx != mpm_ctx || stream->raw_mpm_version != version) {
+        stream->raw_mpm_ctx = mpm_ctx;
+        stream->raw_mpm_version = version;
+        stream->raw_mpm_progress = 0;
+    }
+
+    *skip = 0;
+    *new_len = data_len;
+    if (stream->raw_mpm_progress > offset) {
+        const uint32_t seen = (uint32_t)(MIN(stream->raw_mpm_progress, right_edge) - offset);
+        *new_len = data_len - seen;
+        if (skip_scanned) {
+            if (*new_len == 0) {
+                *skip = data_len;
+            } else {
+                const uint32_t lookback = mpm_ctx->maxlen ? mpm_ctx->maxlen - 1 : 0;
+                *skip = seen > lookback ? seen - lookback : 0;
+            }
+        }
+    }
+    if (right_edge > stream->raw_mpm_progress)
+        stream->raw_mpm_progress = right_edge;
+}
+
+static int StreamMpmFunc(
+        void *cb_data, const uint8_t *data, const uint32_t data_len, const uint64_t offset)
 {
     struct StreamMpmData *smd = cb_data;
-    if (data_len >= smd->mpm_ctx->minlen) {
+    DetectEngineThreadCtx *det_ctx = smd->det_ctx;
+
+    uint32_t skip, new_len;
+    StreamMpmTrackerUpdate(smd->stream, det_ctx->de_ctx->version, smd->mpm_ctx,
+            offset, data_len, det_ctx->de_ctx->prefilter_stream_tracking,
+            &skip, &new_len);
+    StatsAddUI64(det_ctx->tv, det_ctx->counter_stream_mpm_new_bytes, new_len);
+
+    const uint32_t scan_len = data_len - skip;
+    if (scan_len >= smd->mpm_ctx->minlen) {
 #ifdef DEBUG
-        smd->det_ctx->stream_mpm_cnt++;
-        smd->det_ctx->stream_mpm_size += data_len;
+        det_ctx->stream_mpm_cnt++;
+        det_ctx->stream_mpm_size += scan_len;
 #endif
+        StatsAddUI64(det_ctx->tv, det_ctx->counter_stream_mpm_bytes, scan_len);
         (void)mpm_table[smd->mpm_ctx->mpm_type].Search(smd->mpm_ctx,
-                &smd->det_ctx->mtcs, &smd->det_ctx->pmq,
-                data, data_len);
+                &det_ctx->mtcs, &det_ctx->pmq,
+                data + skip, scan_len);
     }
     return 0;
 }
@@ -79,8 +141,10 @@ static void PrefilterPktStream(DetectEngineThreadCtx *det_ctx,
     if (p->flags & PKT_DETECT_HAS_STREAMDATA) {
         SCLogDebug("PRE det_ctx->raw_stream_progress %"PRIu64,
                 det_ctx->raw_stream_progress);
-        struct StreamMpmData stream_mpm_data = { det_ctx, mpm_ctx };
-        StreamReassembleRaw(p->flow->protoctx, p,
+        TcpSession *ssn = p->flow->protoctx;
+        struct StreamMpmData stream_mpm_data = { det_ctx, mpm_ctx,
+            PKT_IS_TOSERVER(p) ? &ssn->client : &ssn->server };
+        StreamReassembleRaw(ssn, p,
                 StreamMpmFunc, &stream_mpm_data,
                 &det_ctx->raw_stream_progress,
                 false /* mpm doesn't use min inspect depth */);
@@ -135,6 +199,108 @@ int PrefilterPktPayloadRegister(DetectEngineCtx *de_ctx,
 }
 
 
+/** \internal
+ *  \brief hash a 2-byte gram into the payload gram bitmap
+ *
+ *  Case is folded so that nocase contents can use the same bitmap.
+ */
+static inline uint16_t PayloadGramHash(const uint8_t b0, const uint8_t b1)
+{
+    const uint32_t g = ((uint32_t)u8_tolower(b0) << 8) | u8_tolower(b1);
+    return (uint16_t)((g * 2654435761U) >> 20) & (DETECT_PAYLOAD_GRAMS_BITS - 1);
+}
+
+static void PayloadGramAdd(Signature *s, const uint16_t h)
+{
+    if (s->payload_grams_cnt == DETECT_PAYLOAD_GRAMS_MAX)
+        return;
+    for (uint8_t i = 0; i < s->payload_grams_cnt; i++) {
+        if (s->payload_grams[i] == h)
+            return;
+    }
+    s->payload_grams[s->payload_grams_cnt++] = h;
+}
+
+/**
+ *  \brief set up the signature's payload gram filter
+ *
+ *  Every content in the payload list that isn't negated has to be present
+ *  in the packet payload for the signature to match, so the 2-byte grams
+ *  of those contents have to be present as well. The first and last gram
+ *  of each content are picked first, then the rest, up to
+ *  DETECT_PAYLOAD_GRAMS_MAX. The mpm content is skipped as the prefilter
+ *  already found it.
+ *
+ *  Needs to be called after the sm_arrays are set up.
+ */
+void DetectEnginePayloadGramsSetup(Signature *s)
+{
+    s->payload_grams_cnt = 0;
+
+    const SigMatchData *smd = s->sm_arrays[DETECT_SM_LIST_PMATCH];
+    if (smd == NULL)
+        return;
+
+    for (int pass = 0; pass < 2; pass++) {
+        for (const SigMatchData *e = smd; ; e++) {
+            if (e->type == DETECT_CONTENT) {
+                const DetectContentData *cd = (const DetectContentData *)e->ctx;
+                if ((cd->flags & (DETECT_CONTENT_NEGATED|DETECT_CONTENT_MPM)) == 0 &&
+                        cd->content_len >= 2) {
+                    const uint8_t *c = cd->content;
+                    const uint16_t last = cd->content_len - 2;
+                    if (pass == 0) {
+                        PayloadGramAdd(s, PayloadGramHash(c[0], c[1]));
+                        PayloadGramAdd(s, PayloadGramHash(c[last], c[last + 1]));
+                    } else {
+                        for (uint16_t i = 1; i < last; i++)
+                            PayloadGramAdd(s, PayloadGramHash(c[i], c[i + 1]));
+                    }
+                }
+            }
+            if (e->is_last)
+                break;
+        }
+    }
+    SCLogDebug("sig %u: %u payload grams", s->id, s->payload_grams_cnt);
+}
+
+/** \internal
+ *  \brief check the signature's gram filter against the packet payload
+ *
+ *  The gram bitmap of the payload is built once per packet, on the first
+ *  check.
+ *
+ *  \retval true a required content is absent, the signature can't match
+ *  \retval false inspection is needed
+ */
+static bool PayloadGramsReject(DetectEngineThreadCtx *det_ctx,
+        const Signature *s, const Packet *p)
+{
+    if (s->payload_grams_cnt == 0)
+        return false;
+
+    if (det_ctx->payload_grams_ticker != det_ctx->ticker ||
+            det_ctx->payload_grams_buf != p->payload) {
+        memset(det_ctx->payload_grams, 0, sizeof(det_ctx->payload_grams));
+        for (uint32_t i = 1; i < p->payload_len; i++) {
+            const uint16_t h = PayloadGramHash(p->payload[i - 1], p->payload[i]);
+            det_ctx->payload_grams[h >> 3] |= BIT_U8(h & 7);
+        }
+        det_ctx->payload_grams_ticker = det_ctx->ticker;
+        det_ctx->payload_grams_buf = p->payload;
+    }
+
+    for (uint8_t i = 0; i < s->payload_grams_cnt; i++) {
+        const uint16_t h = s->payload_grams[i];
+        if ((det_ctx->payload_grams[h >> 3] & BIT_U8(h & 7)) == 0) {
+            StatsIncr(det_ctx->tv, det_ctx->counter_payload_gram_rejects);
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  *  \brief Do the content inspection & validation for a signature
  *
@@ -160,6 +326,9 @@ int DetectEngineInspectPacketPayload(DetectEngineCtx *de_ctx,
     det_ctx->payload_persig_cnt++;
     det_ctx->payload_persig_size += p->payload_len;
 #endif
+    if (PayloadGramsReject(det_ctx, s, p)) {
+        SCReturnInt(0);
+    }
     det_ctx->buffer_offset = 0;
     det_ctx->discontinue_matching = 0;
     det_ctx->inspection_recursion_counter = 0;
@@ -224,7 +393,8 @@ struct StreamContentInspectData {
     Flow *f;
 };
 
-static int StreamContentInspectFunc(void *cb_data, const uint8_t *data, const uint32_t data_len)
+static int StreamContentInspectFunc(
+        void *cb_data, const uint8_t *data, const uint32_t data_len, const uint64_t _offset)
 {
     SCEnter();
     int r = 0;
@@ -282,7 +452,8 @@ struct StreamContentInspectEngineData {
     Flow *f;
 };
 
-static int StreamContentInspectEngineFunc(void *cb_data, const uint8_t *data, const uint32_t data_len)
+static int StreamContentInspectEngineFunc(
+        void *cb_data, const uint8_t *data, const uint32_t data_len, const uint64_t _offset)
 {
     SCEnter();
     int r = 0;
@@ -1312,6 +1483,94 @@ end:
     return result;
 }
 
+/** \test stream MPM tracker: only new data plus lookback is scanned */
+static int PayloadTestStreamMpmTracker01(void)
+{
+    TcpStream stream;
+    memset(&stream, 0, sizeof(stream));
+    MpmCtx mpm_ctx;
+    memset(&mpm_ctx, 0, sizeof(mpm_ctx));
+    mpm_ctx.minlen = 2;
+    mpm_ctx.maxlen = 4;
+    uint32_t skip, new_len;
+
+    /* first scan: all new */
+    StreamMpmTrackerUpdate(&stream, 1, &mpm_ctx, 0, 100, true, &skip, &new_len);
+    FAIL_IF_NOT(skip == 0);
+    FAIL_IF_NOT(new_len == 100);
+    FAIL_IF_NOT(stream.raw_mpm_progress == 100);
+
+    /* overlapping window: skip seen data minus lookback of maxlen - 1 */
+    StreamMpmTrackerUpdate(&stream, 1, &mpm_ctx, 50, 100, true, &skip, &new_len);
+    FAIL_IF_NOT(new_len == 50);
+    FAIL_IF_NOT(skip == 47);
+    FAIL_IF_NOT(stream.raw_mpm_progress == 150);
+
+    /* nothing new: skip all */
+    StreamMpmTrackerUpdate(&stream, 1, &mpm_ctx, 60, 40, true, &skip, &new_len);
+    FAIL_IF_NOT(new_len == 0);
+    FAIL_IF_NOT(skip == 40);
+
+    /* tracking disabled: count, but scan everything */
+    StreamMpmTrackerUpdate(&stream, 1, &mpm_ctx, 100, 100, false, &skip, &new_len);
+    FAIL_IF_NOT(new_len == 50);
+    FAIL_IF_NOT(skip == 0);
+    FAIL_IF_NOT(stream.raw_mpm_progress == 200);
+
+    /* other rule group: tracker is reset */
+    MpmCtx mpm_ctx2 = mpm_ctx;
+    StreamMpmTrackerUpdate(&stream, 1, &mpm_ctx2, 150, 100, true, &skip, &new_len);
+    FAIL_IF_NOT(new_len == 100);
+    FAIL_IF_NOT(skip == 0);
+    FAIL_IF_NOT(stream.raw_mpm_progress == 250);
+
+    /* same rule group address after a reload: tracker is reset */
+    StreamMpmTrackerUpdate(&stream, 2, &mpm_ctx2, 200, 100, true, &skip, &new_len);
+    FAIL_IF_NOT(new_len == 100);
+    FAIL_IF_NOT(skip == 0);
+    FAIL_IF_NOT(stream.raw_mpm_progress == 300);
+    PASS;
+}
+
+/** \test payload gram filter */
+static int PayloadTestGrams01(void)
+{
+    ThreadVars tv;
+    memset(&tv, 0, sizeof(tv));
+    DetectEngineThreadCtx *det_ctx = NULL;
+
+    DetectEngineCtx *de_ctx = DetectEngineCtxInit();
+    FAIL_IF_NULL(de_ctx);
+    Signature *s = DetectEngineAppendSig(de_ctx, "alert tcp any any -> any any "
+            "(content:\"abcdef\"; fast_pattern; content:\"XyZ\"; nocase; "
+            "content:!\"klm\"; sid:1;)");
+    FAIL_IF_NULL(s);
+    SigGroupBuild(de_ctx);
+    DetectEngineThreadCtxInit(&tv, (void *)de_ctx, (void *)&det_ctx);
+    FAIL_IF_NULL(det_ctx);
+
+    /* grams of 'xyz' only: mpm and negated contents are skipped */
+    FAIL_IF_NOT(s->payload_grams_cnt == 2);
+
+    uint8_t buf1[] = "abcdef xyz";
+    Packet *p = UTHBuildPacket(buf1, sizeof(buf1) - 1, IPPROTO_TCP);
+    FAIL_IF_NULL(p);
+    det_ctx->ticker++;
+    FAIL_IF(PayloadGramsReject(det_ctx, s, p));
+    UTHFreePacket(p);
+
+    uint8_t buf2[] = "abcdef xy";
+    p = UTHBuildPacket(buf2, sizeof(buf2) - 1, IPPROTO_TCP);
+    FAIL_IF_NULL(p);
+    det_ctx->ticker++;
+    FAIL_IF_NOT(PayloadGramsReject(det_ctx, s, p));
+    UTHFreePacket(p);
+
+    DetectEngineThreadCtxDeinit(&tv, det_ctx);
+    DetectEngineCtxFree(de_ctx);
+    PASS;
+}
+
 #endif /* UNITTESTS */
 
 void PayloadRegisterTests(void)
@@ -1353,6 +1612,8 @@ void PayloadRegisterTests(void)
     UtRegisterTest("PayloadTestSig32", PayloadTestSig32);
     UtRegisterTest("PayloadTestSig33", PayloadTestSig33);
     UtRegisterTest("PayloadTestSig34", PayloadTestSig34);
+    UtRegisterTest("PayloadTestStreamMpmTracker01", PayloadTestStreamMpmTracker01);
+    UtRegisterTest("PayloadTestGrams01", PayloadTestGrams01);
 #endif /* UNITTESTS */
 
     return;
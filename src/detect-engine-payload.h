@@ -29,6 +29,8 @@ int PrefilterPktPayloadRegister(DetectEngineCtx *de_ctx,
 int PrefilterPktStreamRegister(DetectEngineCtx *de_ctx,
         SigGroupHead *sgh, MpmCtx *mpm_ctx);
 
+void DetectEnginePayloadGramsSetup(Signature *s);
+
 int DetectEngineInspectPacketPayload(DetectEngineCtx *,
         DetectEngineThreadCtx *, const Signature *, Flow *, Packet *);
 int DetectEngineInspectStreamPayload(DetectEngineCtx *,
@@ -2459,6 +2459,13 @@ static int DetectEngineCtxLoadConf(DetectEngineCtx *de_ctx)
             break;
     }
 
+    int stream_tracking = 0;
+    if (ConfGetBool("detect.prefilter.stream-tracking", &stream_tracking) == 1 &&
+            stream_tracking) {
+        de_ctx->prefilter_stream_tracking = true;
+        SCLogConfig("prefilter stream MPM only scans new data");
+    }
+
     return 0;
 }
 
@@ -2708,6 +2715,13 @@ static TmEcode ThreadCtxDoInit (DetectEngineCtx *de_ctx, DetectEngineThreadCtx *
         BUG_ON(det_ctx->non_pf_id_array == NULL);
     }
 
+    det_ctx->alert_queue = SCCalloc(PACKET_ALERT_MAX, sizeof(PacketAlert));
+    if (det_ctx->alert_queue == NULL) {
+        return TM_ECODE_FAILED;
+    }
+    det_ctx->alert_queue_capacity = PACKET_ALERT_MAX;
+    det_ctx->alert_queue_size = 0;
+
     /* IP-ONLY */
     DetectEngineIPOnlyThreadInit(de_ctx,&det_ctx->io_ctx);
 
@@ -2828,6 +2842,24 @@ TmEcode DetectEngineThreadCtxInit(ThreadVars *tv, void *initdata, void **data)
 
     /** alert counter setup */
     det_ctx->counter_alerts = StatsRegisterCounter("detect.alert", tv);
+    det_ctx->counter_stream_mpm_bytes = StatsRegisterCounter("detect.stream_mpm_bytes", tv);
+    det_ctx->counter_stream_mpm_new_bytes =
+            StatsRegisterCounter("detect.stream_mpm_new_bytes", tv);
+    det_ctx->counter_iprep_flow_cached =
+            StatsRegisterCounter("detect.iprep_flow_cached", tv);
+    det_ctx->counter_iprep_lookups = StatsRegisterCounter("detect.iprep_lookups", tv);
+    det_ctx->counter_swf_decompress_bytes_in =
+            StatsRegisterCounter("detect.swf_decompress_bytes_in", tv);
+    det_ctx->counter_swf_decompress_bytes_out =
+            StatsRegisterCounter("detect.swf_decompress_bytes_out", tv);
+    det_ctx->counter_swf_decompress_ticks =
+            StatsRegisterCounter("detect.swf_decompress_ticks", tv);
+    det_ctx->counter_payload_gram_rejects =
+            StatsRegisterCounter("detect.payload_gram_rejects", tv);
+    det_ctx->counter_alert_queue_overflow =
+            StatsRegisterCounter("detect.alert_queue_overflow", tv);
+    det_ctx->counter_alerts_discarded =
+            StatsRegisterCounter("detect.alerts_discarded", tv);
 #ifdef PROFILING
     det_ctx->counter_mpm_list = StatsRegisterAvgCounter("detect.mpm_list", tv);
     det_ctx->counter_nonmpm_list = StatsRegisterAvgCounter("detect.nonmpm_list", tv);
@@ -2886,6 +2918,24 @@ static DetectEngineThreadCtx *DetectEngineThreadCtxInitForReload(
 
     /** alert counter setup */
     det_ctx->counter_alerts = StatsRegisterCounter("detect.alert", tv);
+    det_ctx->counter_stream_mpm_bytes = StatsRegisterCounter("detect.stream_mpm_bytes", tv);
+    det_ctx->counter_stream_mpm_new_bytes =
+            StatsRegisterCounter("detect.stream_mpm_new_bytes", tv);
+    det_ctx->counter_iprep_flow_cached =
+            StatsRegisterCounter("detect.iprep_flow_cached", tv);
+    det_ctx->counter_iprep_lookups = StatsRegisterCounter("detect.iprep_lookups", tv);
+    det_ctx->counter_swf_decompress_bytes_in =
+            StatsRegisterCounter("detect.swf_decompress_bytes_in", tv);
+    det_ctx->counter_swf_decompress_bytes_out =
+            StatsRegisterCounter("detect.swf_decompress_bytes_out", tv);
+    det_ctx->counter_swf_decompress_ticks =
+            StatsRegisterCounter("detect.swf_decompress_ticks", tv);
+    det_ctx->counter_payload_gram_rejects =
+            StatsRegisterCounter("detect.payload_gram_rejects", tv);
+    det_ctx->counter_alert_queue_overflow =
+            StatsRegisterCounter("detect.alert_queue_overflow", tv);
+    det_ctx->counter_alerts_discarded =
+            StatsRegisterCounter("detect.alerts_discarded", tv);
 #ifdef PROFILING
     uint16_t counter_mpm_list = StatsRegisterAvgCounter("detect.mpm_list", tv);
     uint16_t counter_nonmpm_list = StatsRegisterAvgCounter("detect.nonmpm_list", tv);
@@ -2950,6 +3000,9 @@ static void DetectEngineThreadCtxFree(DetectEngineThreadCtx *det_ctx)
     if (det_ctx->non_pf_id_array != NULL)
         SCFree(det_ctx->non_pf_id_array);
 
+    if (det_ctx->alert_queue != NULL)
+        SCFree(det_ctx->alert_queue);
+
     if (det_ctx->match_array != NULL)
         SCFree(det_ctx->match_array);
 
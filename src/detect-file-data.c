@@ -50,6 +50,7 @@
 #include "util-unittest.h"
 #include "util-unittest-helper.h"
 #include "util-file-decompression.h"
+#include "detect-content.h"
 
 static int DetectFiledataSetup (DetectEngineCtx *, Signature *, const char *);
 #ifdef UNITTESTS
@@ -58,6 +59,9 @@ static void DetectFiledataRegisterTests(void);
 static void DetectFiledataSetupCallback(const DetectEngineCtx *de_ctx,
                                         Signature *s);
 static int g_file_data_buffer_id = 0;
+static int g_swf_thread_id = 0;
+static void *FiledataSwfThreadInit(void *data);
+static void FiledataSwfThreadFree(void *ctx);
 
 /* HTTP */
 static InspectionBuffer *HttpServerBodyGetDataCallback(DetectEngineThreadCtx *det_ctx,
@@ -135,6 +139,90 @@ void DetectFiledataRegister(void)
             "http response body, smb files or smtp attachments data");
 
     g_file_data_buffer_id = DetectBufferTypeGetByName("file_data");
+
+    g_swf_thread_id = DetectRegisterThreadCtxGlobalFuncs("file_data",
+            FiledataSwfThreadInit, NULL, FiledataSwfThreadFree);
+}
+
+/** \internal
+ *  \brief get the max offset in the buffer a list of matches inspects
+ *
+ *  Content matches are bounded by depth, or by within if relative to a
+ *  bounded content match. Anything else may look at the whole buffer.
+ *
+ *  \retval depth or 0 if unbounded
+ */
+static uint32_t FiledataListMaxDepth(const SigMatch *sm)
+{
+    uint64_t max = 0;
+    uint64_t prev_end = 0;
+
+    for ( ; sm != NULL; sm = sm->next) {
+        if (sm->type != DETECT_CONTENT)
+            return 0;
+        const DetectContentData *cd = (const DetectContentData *)sm->ctx;
+        if (cd->flags & (DETECT_CONTENT_OFFSET_VAR|DETECT_CONTENT_DEPTH_VAR|
+                    DETECT_CONTENT_DISTANCE_VAR|DETECT_CONTENT_WITHIN_VAR))
+            return 0;
+
+        uint64_t end;
+        if (cd->flags & (DETECT_CONTENT_DISTANCE|DETECT_CONTENT_WITHIN)) {
+            if (!(cd->flags & DETECT_CONTENT_WITHIN) || prev_end == 0)
+                return 0;
+            end = prev_end + (uint64_t)MAX(cd->distance, 0) + (uint64_t)cd->within;
+        } else if (cd->flags & DETECT_CONTENT_DEPTH) {
+            end = cd->depth;
+        } else {
+            return 0;
+        }
+        prev_end = end;
+        max = MAX(max, end);
+    }
+    return (uint32_t)MIN(max, UINT32_MAX);
+}
+
+/**
+ *  \brief set DetectEngineCtx::filedata_max_depth from the rules
+ *
+ *  Must be called before the signatures init data is freed.
+ */
+void DetectFiledataSetupMaxDepth(DetectEngineCtx *de_ctx)
+{
+    uint32_t max = 0;
+
+    de_ctx->filedata_max_depth = 0;
+    for (const Signature *s = de_ctx->sig_list; s != NULL; s = s->next) {
+        if (s->init_data == NULL)
+            return;
+        for (uint32_t list = DETECT_SM_LIST_DYNAMIC_START;
+                list < s->init_data->smlists_array_size; list++) {
+            if (s->init_data->smlists[list] == NULL)
+                continue;
+            /* transformed file_data lists have their own id */
+            const char *name = DetectBufferTypeGetNameById(de_ctx, list);
+            if (name == NULL || strcmp(name, "file_data") != 0)
+                continue;
+            if ((int)list != g_file_data_buffer_id)
+                return;
+
+            uint32_t depth = FiledataListMaxDepth(s->init_data->smlists[list]);
+            if (depth == 0)
+                return;
+            max = MAX(max, depth);
+        }
+    }
+    de_ctx->filedata_max_depth = max;
+    SCLogDebug("file_data max depth %u", max);
+}
+
+static void *FiledataSwfThreadInit(void *data)
+{
+    return FileSwfDecompressCtxNew();
+}
+
+static void FiledataSwfThreadFree(void *ctx)
+{
+    FileSwfDecompressCtxFree(ctx);
 }
 
 #define FILEDATA_CONTENT_LIMIT 100000
@@ -325,11 +413,19 @@ static InspectionBuffer *HttpServerBodyGetDataCallback(DetectEngineThreadCtx *de
         if (swf_file_type == FILE_SWF_ZLIB_COMPRESSION ||
             swf_file_type == FILE_SWF_LZMA_COMPRESSION)
         {
+            /* no need to decompress more than the rules inspect */
+            uint32_t decompress_depth = htp_state->cfg->swf_decompress_depth;
+            const uint32_t rule_depth = det_ctx->de_ctx->filedata_max_depth;
+            if (rule_depth != 0 && (decompress_depth == 0 || rule_depth < decompress_depth))
+                decompress_depth = rule_depth;
+
             (void)FileSwfDecompression(data, data_len,
                                        det_ctx,
+                                       DetectThreadCtxGetGlobalKeywordThreadCtx(det_ctx,
+                                               g_swf_thread_id),
                                        buffer,
                                        htp_state->cfg->swf_compression_type,
-                                       htp_state->cfg->swf_decompress_depth,
+                                       decompress_depth,
                                        htp_state->cfg->swf_compress_depth);
         }
     }
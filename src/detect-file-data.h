@@ -26,5 +26,6 @@
 
 /* prototypes */
 void DetectFiledataRegister (void);
+void DetectFiledataSetupMaxDepth(DetectEngineCtx *de_ctx);
 
 #endif /* __DETECT_FILEDATA_H__ */
@@ -48,6 +48,7 @@
 
 #include "reputation.h"
 #include "host.h"
+#include "util-storage.h"
 
 #define PARSE_REGEX         "\\s*(any|src|dst|both)\\s*,\\s*([A-Za-z0-9\\-\\_]+)\\s*,\\s*(\\<|\\>|\\=)\\s*,\\s*([0-9]+)\\s*"
 static DetectParseRegex parse_regex;
@@ -156,6 +157,49 @@ static uint8_t GetHostRepDst(Packet *p, uint8_t cat, uint32_t version)
     return val;
 }
 
+/** \internal
+ *  \brief get the reputation of the packet's source or destination
+ *
+ *  For packets with a flow the result is cached in the flow, so that the
+ *  host table and radix lookups are done once per flow direction and
+ *  category instead of for each packet.
+ *
+ *  \param src true for the packet's source, false for its destination
+ */
+static uint8_t GetRep(DetectEngineThreadCtx *det_ctx, Packet *p,
+        const uint8_t cat, const uint32_t version, const bool src)
+{
+    SRepFlowCache *c = p->flow ? SRepFlowCacheGet(p->flow, version) : NULL;
+    int dir = 0;
+    if (c != NULL) {
+        /* packet source is the flow source in the toserver direction */
+        const bool toserver = (p->flowflags & FLOW_PKT_TOSERVER) != 0;
+        dir = (toserver == src) ? 0 : 1;
+        if (c->resolved[dir] & BIT_U64(cat)) {
+            StatsIncr(det_ctx->tv, det_ctx->counter_iprep_flow_cached);
+            return c->rep[dir][cat];
+        }
+    }
+
+    uint8_t val;
+    if (src) {
+        val = GetHostRepSrc(p, cat, version);
+        if (val == 0)
+            val = SRepCIDRGetIPRepSrc(det_ctx->de_ctx->srepCIDR_ctx, p, cat, version);
+    } else {
+        val = GetHostRepDst(p, cat, version);
+        if (val == 0)
+            val = SRepCIDRGetIPRepDst(det_ctx->de_ctx->srepCIDR_ctx, p, cat, version);
+    }
+    StatsIncr(det_ctx->tv, det_ctx->counter_iprep_lookups);
+
+    if (c != NULL) {
+        c->rep[dir][cat] = val;
+        c->resolved[dir] |= BIT_U64(cat);
+    }
+    return val;
+}
+
 static inline int RepMatch(uint8_t op, uint8_t val1, uint8_t val2)
 {
     if (op == DETECT_IPREP_OP_GT && val1 > val2) {
@@ -186,26 +230,20 @@ static int DetectIPRepMatch (DetectEngineThreadCtx *det_ctx, Packet *p,
     SCLogDebug("rd->cmd %u", rd->cmd);
     switch(rd->cmd) {
         case DETECT_IPREP_CMD_ANY:
-            val = GetHostRepSrc(p, rd->cat, version);
-            if (val == 0)
-                val = SRepCIDRGetIPRepSrc(det_ctx->de_ctx->srepCIDR_ctx, p, rd->cat, version);
+            val = GetRep(det_ctx, p, rd->cat, version, true);
             if (val > 0) {
                 if (RepMatch(rd->op, val, rd->val) == 1)
                     return 1;
             }
-            val = GetHostRepDst(p, rd->cat, version);
-            if (val == 0)
-                val = SRepCIDRGetIPRepDst(det_ctx->de_ctx->srepCIDR_ctx, p, rd->cat, version);
+            val = GetRep(det_ctx, p, rd->cat, version, false);
             if (val > 0) {
                 return RepMatch(rd->op, val, rd->val);
             }
             break;
 
         case DETECT_IPREP_CMD_SRC:
-            val = GetHostRepSrc(p, rd->cat, version);
+            val = GetRep(det_ctx, p, rd->cat, version, true);
             SCLogDebug("checking src -- val %u (looking for cat %u, val %u)", val, rd->cat, rd->val);
-            if (val == 0)
-                val = SRepCIDRGetIPRepSrc(det_ctx->de_ctx->srepCIDR_ctx, p, rd->cat, version);
             if (val > 0) {
                 return RepMatch(rd->op, val, rd->val);
             }
@@ -213,23 +251,17 @@ static int DetectIPRepMatch (DetectEngineThreadCtx *det_ctx, Packet *p,
 
         case DETECT_IPREP_CMD_DST:
             SCLogDebug("checking dst");
-            val = GetHostRepDst(p, rd->cat, version);
-            if (val == 0)
-                val = SRepCIDRGetIPRepDst(det_ctx->de_ctx->srepCIDR_ctx, p, rd->cat, version);
+            val = GetRep(det_ctx, p, rd->cat, version, false);
             if (val > 0) {
                 return RepMatch(rd->op, val, rd->val);
             }
             break;
 
         case DETECT_IPREP_CMD_BOTH:
-            val = GetHostRepSrc(p, rd->cat, version);
-            if (val == 0)
-                val = SRepCIDRGetIPRepSrc(det_ctx->de_ctx->srepCIDR_ctx, p, rd->cat, version);
+            val = GetRep(det_ctx, p, rd->cat, version, true);
             if (val == 0 || RepMatch(rd->op, val, rd->val) == 0)
                 return 0;
-            val = GetHostRepDst(p, rd->cat, version);
-            if (val == 0)
-                val = SRepCIDRGetIPRepDst(det_ctx->de_ctx->srepCIDR_ctx, p, rd->cat, version);
+            val = GetRep(det_ctx, p, rd->cat, version, false);
             if (val > 0) {
                 return RepMatch(rd->op, val, rd->val);
             }
@@ -1002,6 +1034,81 @@ end:
     return result;
 }
 
+/** \test per flow reputation cache: cached hit, and a lookup by an
+ *        engine with another reputation version bypasses the cache */
+static int DetectIPRepTest10(void)
+{
+    ThreadVars th_v;
+    memset(&th_v, 0, sizeof(th_v));
+
+    /* the flow storage is only registered with reputation configured */
+    ConfCreateContextBackup();
+    ConfInit();
+    FAIL_IF_NOT(ConfSet("reputation-categories-file", "dummy") == 1);
+    StorageInit();
+    SRepFlowStorageRegister();
+    FAIL_IF(StorageFinalize() < 0);
+    ConfDeInit();
+    ConfRestoreContextBackup();
+    FlowInitConfig(FLOW_QUIET);
+    HostInitConfig(HOST_QUIET);
+
+    DetectEngineCtx *de_ctx = DetectEngineCtxInit();
+    FAIL_IF_NULL(de_ctx);
+    SRepInit(de_ctx);
+    SRepResetVersion();
+    FAIL_IF(SRepLoadCatFileFromFD(DetectIPRepGenerateCategoriesDummy()) < 0);
+    FAIL_IF(SRepLoadFileFromFD(de_ctx->srepCIDR_ctx,
+                DetectIPRepGenerateNetworksDummy()) < 0);
+
+    DetectEngineThreadCtx det_ctx;
+    memset(&det_ctx, 0, sizeof(det_ctx));
+    det_ctx.tv = &th_v;
+    det_ctx.de_ctx = de_ctx;
+
+    Flow *f = FlowAlloc();
+    FAIL_IF_NULL(f);
+    Packet *p = UTHBuildPacket((uint8_t *)"lalala", 6, IPPROTO_TCP);
+    FAIL_IF_NULL(p);
+    p->src.addr_data32[0] = UTHSetIPv4Address("10.0.0.1");
+    p->flow = f;
+    p->flowflags |= FLOW_PKT_TOSERVER;
+
+    /* first lookup fills the cache */
+    FAIL_IF_NOT(GetRep(&det_ctx, p, 1, 1, true) == 20);
+    SRepFlowCache *c = SRepFlowCacheGet(f, 1);
+    FAIL_IF_NULL(c);
+    FAIL_IF_NOT(c->resolved[0] & BIT_U64(1));
+    FAIL_IF_NOT(c->rep[0][1] == 20);
+
+    /* cached hit: the host and radix lookups are skipped */
+    c->rep[0][1] = 99;
+    FAIL_IF_NOT(GetRep(&det_ctx, p, 1, 1, true) == 99);
+
+    /* the packet's source is the destination of the flow toclient */
+    p->flowflags = FLOW_PKT_TOCLIENT;
+    FAIL_IF_NOT(GetRep(&det_ctx, p, 1, 1, true) == 20);
+    FAIL_IF_NOT(c->resolved[1] & BIT_U64(1));
+    p->flowflags = FLOW_PKT_TOSERVER;
+
+    /* new reputation version: cache is cleared and bypassed */
+    FAIL_IF_NOT(GetRep(&det_ctx, p, 1, 2, true) == 20);
+    FAIL_IF_NOT(c->version == 2);
+    FAIL_IF_NOT(c->resolved[0] == BIT_U64(1));
+    FAIL_IF_NOT(c->resolved[1] == 0);
+
+    UTHFreePacket(p);
+    FlowClearMemory(f, 0);
+    FlowFree(f);
+    DetectEngineCtxFree(de_ctx);
+    HostShutdown();
+    FlowShutdown();
+    StorageCleanup();
+    /* config has no reputation: unregisters the flow storage id */
+    SRepFlowStorageRegister();
+    PASS;
+}
+
 /**
  * \brief this function registers unit tests for IPRep
  */
@@ -1016,5 +1123,6 @@ void IPRepRegisterTests(void)
     UtRegisterTest("DetectIPRepTest07", DetectIPRepTest07);
     UtRegisterTest("DetectIPRepTest08", DetectIPRepTest08);
     UtRegisterTest("DetectIPRepTest09", DetectIPRepTest09);
+    UtRegisterTest("DetectIPRepTest10", DetectIPRepTest10);
 }
 #endif /* UNITTESTS */
\ No newline at end of file
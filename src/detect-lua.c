@@ -51,6 +51,7 @@
 #include "app-layer.h"
 #include "app-layer-parser.h"
 #include "app-layer-htp.h"
+#include "app-layer-dnp3.h"
 
 #include "stream-tcp.h"
 
@@ -905,8 +906,10 @@ static int DetectLuaSetupPrime(DetectEngineCtx *de_ctx, DetectLuaData *ld)
             else if (strcmp(k, "http.request_body") == 0)
                 ld->flags |= DATATYPE_HTTP_REQUEST_BODY;
 
-            else if (strcmp(k, "http.response_body") == 0)
+            else if (strcmp(k, "http.response_body") == 0) {
                 ld->flags |= DATATYPE_HTTP_RESPONSE_BODY;
+                AppLayerHtpEnableResponseBodyCallback();
+            }
 
             else if (strcmp(k, "http.response_cookie") == 0)
                 ld->flags |= DATATYPE_HTTP_RESPONSE_COOKIE;
@@ -971,6 +974,9 @@ static int DetectLuaSetupPrime(DetectEngineCtx *de_ctx, DetectLuaData *ld)
 
             ld->flags |= DATATYPE_DNP3;
 
+            /* scripts can access the object points */
+            DNP3EnablePointDecoding();
+
         } else {
             SCLogError(SC_ERR_LUA_ERROR, "unsupported data type %s", k);
             goto error;
@@ -67,6 +67,7 @@
 #include "string.h"
 #include "detect-parse.h"
 #include "detect-engine-iponly.h"
+#include "detect-engine-content-inspection.h"
 #include "app-layer-detect-proto.h"
 
 /* Table with all SigMatch registrations */
@@ -1634,6 +1635,7 @@ SigMatchData* SigMatchList2DataArray(SigMatch *head)
         sm->ctx = NULL; // SigMatch no longer owns the ctx
         smd->is_last = (sm->next == NULL);
     }
+    DetectEngineContentInspectionCompile(out, len);
     return out;
 }
 
@@ -85,6 +85,9 @@ static int DetectReplacePostMatch(DetectEngineThreadCtx *det_ctx,
     if (det_ctx->replist) {
         DetectReplaceExecuteInternal(p, det_ctx->replist);
         det_ctx->replist = NULL;
+        /* payload changed, rebuild the payload gram bitmap on next use */
+        det_ctx->payload_grams_ticker = 0;
+        det_ctx->payload_grams_buf = NULL;
     }
     return 1;
 }
@@ -593,6 +596,56 @@ static int DetectReplaceMatchTest15(void)
 }
 
 
+/**
+ * \test a rule after a replace sees the replaced payload, also when
+ *       the payload gram filter was already set up for the packet
+ */
+static int DetectReplaceMatchTest16(void)
+{
+    int run_mode_backup = run_mode;
+    run_mode = RUNMODE_NFQ;
+
+    ThreadVars th_v;
+    memset(&th_v, 0, sizeof(th_v));
+    DetectEngineThreadCtx *det_ctx = NULL;
+
+    uint8_t buf[] = "abcd efgh";
+    Packet *p = UTHBuildPacket(buf, sizeof(buf) - 1, IPPROTO_TCP);
+    FAIL_IF_NULL(p);
+
+    DetectEngineCtx *de_ctx = DetectEngineCtxInit();
+    FAIL_IF_NULL(de_ctx);
+    de_ctx->flags |= DE_QUIET;
+
+    /* builds the gram bitmap of the original payload */
+    Signature *s = de_ctx->sig_list = SigInit(de_ctx, "alert tcp any any -> any any "
+            "(content:\"efgh\"; fast_pattern; content:\"abcd\"; sid:1;)");
+    FAIL_IF_NULL(s);
+    s = s->next = SigInit(de_ctx, "alert tcp any any -> any any "
+            "(content:\"abcd\"; replace:\"wxyz\"; sid:2;)");
+    FAIL_IF_NULL(s);
+    s = s->next = SigInit(de_ctx, "alert tcp any any -> any any "
+            "(content:\"efgh\"; fast_pattern; content:\"wxyz\"; sid:3;)");
+    FAIL_IF_NULL(s);
+
+    SigGroupBuild(de_ctx);
+    FAIL_IF_NOT(s->payload_grams_cnt > 0);
+    DetectEngineThreadCtxInit(&th_v, (void *)de_ctx, (void *)&det_ctx);
+    FAIL_IF_NULL(det_ctx);
+
+    SigMatchSignatures(&th_v, de_ctx, det_ctx, p);
+    FAIL_IF_NOT(PacketAlertCheck(p, 1));
+    FAIL_IF_NOT(PacketAlertCheck(p, 2));
+    FAIL_IF_NOT(PacketAlertCheck(p, 3));
+    FAIL_IF_NOT(memcmp(p->payload, "wxyz efgh", 9) == 0);
+
+    DetectEngineThreadCtxDeinit(&th_v, (void *)det_ctx);
+    DetectEngineCtxFree(de_ctx);
+    UTHFreePacket(p);
+    run_mode = run_mode_backup;
+    PASS;
+}
+
 /**
  * \test Parsing test
  */
@@ -853,6 +906,7 @@ void DetectReplaceRegisterTests(void)
     UtRegisterTest("DetectReplaceMatchTest13", DetectReplaceMatchTest13);
     UtRegisterTest("DetectReplaceMatchTest14", DetectReplaceMatchTest14);
     UtRegisterTest("DetectReplaceMatchTest15", DetectReplaceMatchTest15);
+    UtRegisterTest("DetectReplaceMatchTest16", DetectReplaceMatchTest16);
 /* parsing */
     UtRegisterTest("DetectReplaceParseTest01", DetectReplaceParseTest01);
     UtRegisterTest("DetectReplaceParseTest02", DetectReplaceParseTest02);
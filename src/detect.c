@@ -833,6 +833,7 @@ static DetectRunScratchpad DetectRunSetup(
     p->alerts.cnt = 0;
 #endif
     det_ctx->ticker++;
+    det_ctx->alert_queue_size = 0;
     det_ctx->filestore_cnt = 0;
     det_ctx->base64_decoded_len = 0;
     det_ctx->raw_stream_progress = 0;
@@ -57,6 +57,11 @@
 
 #define DETECT_TRANSFORMS_MAX 16
 
+/** max number of grams in a signature's payload filter */
+#define DETECT_PAYLOAD_GRAMS_MAX 8
+/** size of the per packet payload gram bitmap */
+#define DETECT_PAYLOAD_GRAMS_BITS 4096
+
 /** default rule priority if not set through priority keyword or via
  *  classtype. */
 #define DETECT_DEFAULT_PRIO 3
@@ -329,6 +334,7 @@ typedef struct SigMatch_ {
 typedef struct SigMatchData_ {
     uint8_t type; /**< match type */
     uint8_t is_last; /**< Last element of the list */
+    uint8_t ci_op; /**< compiled content inspection op, DETECT_CI_OP_* */
     SigMatchCtx *ctx; /**< plugin specific data */
 } SigMatchData;
 
@@ -580,6 +586,11 @@ typedef struct Signature_ {
      * their inspect engines. */
     SigMatchData *sm_arrays[DETECT_SM_LIST_MAX];
 
+    /** hashed 2-byte grams of the required payload contents, checked
+     *  against the packet payload before inspection. */
+    uint8_t payload_grams_cnt;
+    uint16_t payload_grams[DETECT_PAYLOAD_GRAMS_MAX];
+
     /* memory is still owned by the sm_lists/sm_arrays entry */
     const struct DetectFilestoreData_ *filestore_ctx;
 
@@ -884,6 +895,9 @@ typedef struct DetectEngineCtx_ {
         uint32_t content_inspect_window;
     } filedata_config[ALPROTO_MAX];
     bool filedata_config_initialized;
+    /** max offset in file_data any rule inspects, 0 if unbounded. Bounds
+     *  the swf decompression. */
+    uint32_t filedata_max_depth;
 
 #ifdef PROFILING
     struct SCProfileDetectCtx_ *profile_ctx;
@@ -910,6 +924,10 @@ typedef struct DetectEngineCtx_ {
     /** are we using just mpm or also other prefilters */
     enum DetectEnginePrefilterSetting prefilter_setting;
 
+    /** stream MPM skips data it already scanned for the rule group,
+     *  except for a lookback of the longest pattern */
+    bool prefilter_stream_tracking;
+
     HashListTable *dport_hash_table;
 
     DetectPort *tcp_whitelist;
@@ -1018,11 +1036,23 @@ typedef struct DetectEngineThreadCtx_ {
     /* the thread to which this detection engine thread belongs */
     ThreadVars *tv;
 
+    /** gram bitmap of the packet payload, built on first use for the
+     *  packet identified by ticker and the payload pointer */
+    uint64_t payload_grams_ticker;
+    const uint8_t *payload_grams_buf;
+    uint8_t payload_grams[DETECT_PAYLOAD_GRAMS_BITS / 8];
+
     /** Array of non-prefiltered sigs that need to be evaluated. Updated
      *  per packet based on the rule group and traffic properties. */
     SigIntId *non_pf_id_array;
     uint32_t non_pf_id_cnt; // size is cnt * sizeof(uint32_t)
 
+    /** alerts of the current packet in the order they matched. Sorted and
+     *  moved into p->alerts by PacketAlertFinalize. Grows as needed. */
+    PacketAlert *alert_queue;
+    uint32_t alert_queue_size;
+    uint32_t alert_queue_capacity;
+
     uint32_t mt_det_ctxs_cnt;
     struct DetectEngineThreadCtx_ **mt_det_ctxs;
     HashTable *mt_det_ctxs_hash;
@@ -1047,6 +1077,26 @@ typedef struct DetectEngineThreadCtx_ {
 
     /** id for alert counter */
     uint16_t counter_alerts;
+    /** ids for stream MPM counters: bytes scanned and bytes not scanned
+     *  before for the rule group */
+    uint16_t counter_stream_mpm_bytes;
+    uint16_t counter_stream_mpm_new_bytes;
+    /** ids for iprep counters: lookups answered from the flow cache and
+     *  lookups in the host table / radix trees */
+    uint16_t counter_iprep_flow_cached;
+    uint16_t counter_iprep_lookups;
+    /** ids for swf decompression counters: compressed bytes in,
+     *  decompressed bytes out and cpu ticks spent */
+    uint16_t counter_swf_decompress_bytes_in;
+    uint16_t counter_swf_decompress_bytes_out;
+    uint16_t counter_swf_decompress_ticks;
+    /** id for the counter of payload inspections rejected by the
+     *  signature's gram filter */
+    uint16_t counter_payload_gram_rejects;
+    /** ids for alert queue counters: alerts queued beyond PACKET_ALERT_MAX
+     *  and alerts that didn't fit in p->alerts after finalizing */
+    uint16_t counter_alert_queue_overflow;
+    uint16_t counter_alerts_discarded;
 #ifdef PROFILING
     uint16_t counter_mpm_list;
     uint16_t counter_nonmpm_list;
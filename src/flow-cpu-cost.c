@@ -0,0 +1,181 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Per flow CPU cost accounting.
+ *
+ * When enabled (flow.cpu-accounting) the FlowWorker measures the cycles
+ * it spends on each flow in the stream engine, app-layer and detection.
+ * The totals are stored in flow storage, logged in the EVE flow record
+ * and can be queried for the live flows with the "flow-top-cpu" unix
+ * socket command.
+ */
+
+#include "suricata-common.h"
+#include "conf.h"
+#include "flow.h"
+#include "flow-private.h"
+#include "flow-hash.h"
+#include "flow-storage.h"
+#include "flow-cpu-cost.h"
+#include "util-debug.h"
+#include "util-print.h"
+#include "util-unittest.h"
+
+int g_flow_cpu_cost_id = -1;
+
+static void FlowCpuCostFree(void *x)
+{
+    SCFree(x);
+}
+
+/** \brief register the flow storage if accounting is enabled
+ *
+ *  Needs to be called before the storage API is finalized.
+ */
+void FlowCpuCostRegister(void)
+{
+    int enabled = 0;
+    if (ConfGetBool("flow.cpu-accounting", &enabled) != 1 || !enabled)
+        return;
+
+    g_flow_cpu_cost_id = FlowStorageRegister("cpu_cost", sizeof(void *),
+            NULL, FlowCpuCostFree);
+    if (g_flow_cpu_cost_id < 0) {
+        SCLogError(SC_ERR_FLOW_INIT, "failed to register flow storage for "
+                "cpu accounting");
+        return;
+    }
+    SCLogConfig("per flow cpu accounting enabled");
+}
+
+FlowCpuCost *FlowCpuCostAlloc(Flow *f)
+{
+    FlowCpuCost *c = SCCalloc(1, sizeof(*c));
+    if (unlikely(c == NULL))
+        return NULL;
+    FlowSetStorageById(f, g_flow_cpu_cost_id, c);
+    return c;
+}
+
+/** \internal
+ *  \brief insert entry into the sorted top list if it qualifies
+ *  \retval position of the entry or -1 if it didn't make the list
+ */
+static int FlowCpuCostTopInsert(FlowCpuCostTopEntry *top, uint32_t *cnt,
+        const uint32_t size, const uint64_t total)
+{
+    if (*cnt == size && (size == 0 || total <= top[size - 1].total))
+        return -1;
+
+    uint32_t i = (*cnt < size) ? (*cnt)++ : size - 1;
+    while (i > 0 && top[i - 1].total < total) {
+        top[i] = top[i - 1];
+        i--;
+    }
+    top[i].total = total;
+    return (int)i;
+}
+
+static void FlowCpuCostTopFill(FlowCpuCostTopEntry *e, const Flow *f,
+        const FlowCpuCost *c)
+{
+    if (FLOW_IS_IPV4(f)) {
+        PrintInet(AF_INET, (const void *)&f->src.addr_data32[0], e->src_ip, sizeof(e->src_ip));
+        PrintInet(AF_INET, (const void *)&f->dst.addr_data32[0], e->dst_ip, sizeof(e->dst_ip));
+    } else if (FLOW_IS_IPV6(f)) {
+        PrintInet(AF_INET6, (const void *)f->src.addr_data32, e->src_ip, sizeof(e->src_ip));
+        PrintInet(AF_INET6, (const void *)f->dst.addr_data32, e->dst_ip, sizeof(e->dst_ip));
+    } else {
+        e->src_ip[0] = e->dst_ip[0] = '\0';
+    }
+    e->sp = f->sp;
+    e->dp = f->dp;
+    e->proto = f->proto;
+    e->alproto = f->alproto;
+    e->cost = *c;
+}
+
+/** \brief get the flows in the hash with the highest cpu cost
+ *
+ *  Walks the flow hash. Flows that are locked by a worker are skipped,
+ *  so the walk never waits on packet processing.
+ *
+ *  \param top array to fill, sorted by total cost in descending order
+ *  \param size number of entries in top
+ *  \retval cnt number of entries filled
+ */
+uint32_t FlowCpuCostGetTop(FlowCpuCostTopEntry *top, const uint32_t size)
+{
+    uint32_t cnt = 0;
+
+    if (g_flow_cpu_cost_id < 0 || flow_hash == NULL)
+        return 0;
+
+    for (uint32_t idx = 0; idx < flow_config.hash_size; idx++) {
+        FlowBucket *fb = &flow_hash[idx];
+        if (fb->head == NULL)
+            continue;
+
+        FBLOCK_LOCK(fb);
+        for (Flow *f = fb->head; f != NULL; f = f->next) {
+            if (FLOWLOCK_TRYRDLOCK(f) != 0)
+                continue;
+            const FlowCpuCost *c = FlowGetStorageById(f, g_flow_cpu_cost_id);
+            if (c != NULL) {
+                int pos = FlowCpuCostTopInsert(top, &cnt, size, FlowCpuCostTotal(c));
+                if (pos >= 0)
+                    FlowCpuCostTopFill(&top[pos], f, c);
+            }
+            FLOWLOCK_UNLOCK(f);
+        }
+        FBLOCK_UNLOCK(fb);
+    }
+    return cnt;
+}
+
+#ifdef UNITTESTS
+static int FlowCpuCostTest01(void)
+{
+    FlowCpuCostTopEntry top[3];
+    memset(&top, 0, sizeof(top));
+    uint32_t cnt = 0;
+
+    FAIL_IF_NOT(FlowCpuCostTopInsert(top, &cnt, 3, 10) == 0);
+    FAIL_IF_NOT(FlowCpuCostTopInsert(top, &cnt, 3, 30) == 0);
+    FAIL_IF_NOT(FlowCpuCostTopInsert(top, &cnt, 3, 20) == 1);
+    FAIL_IF_NOT(cnt == 3);
+    FAIL_IF_NOT(top[0].total == 30 && top[1].total == 20 && top[2].total == 10);
+
+    /* too small for a full list */
+    FAIL_IF_NOT(FlowCpuCostTopInsert(top, &cnt, 3, 5) == -1);
+    /* pushes out the smallest */
+    FAIL_IF_NOT(FlowCpuCostTopInsert(top, &cnt, 3, 25) == 1);
+    FAIL_IF_NOT(cnt == 3);
+    FAIL_IF_NOT(top[0].total == 30 && top[1].total == 25 && top[2].total == 20);
+    PASS;
+}
+#endif /* UNITTESTS */
+
+void FlowCpuCostRegisterTests(void)
+{
+#ifdef UNITTESTS
+    UtRegisterTest("FlowCpuCostTest01", FlowCpuCostTest01);
+#endif /* UNITTESTS */
+}
@@ -0,0 +1,78 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Per flow CPU cost accounting: cumulative cycles spent in the stream
+ * engine, app-layer and detection, kept in flow storage.
+ */
+
+#ifndef __FLOW_CPU_COST_H__
+#define __FLOW_CPU_COST_H__
+
+#include "flow.h"
+#include "flow-storage.h"
+
+typedef struct FlowCpuCost_ {
+    uint64_t stream;    /**< cycles in the stream engine, excl. app-layer */
+    uint64_t app_layer; /**< cycles in app-layer detection and parsing */
+    uint64_t detect;    /**< cycles in detection */
+} FlowCpuCost;
+
+static inline uint64_t FlowCpuCostTotal(const FlowCpuCost *c)
+{
+    return c->stream + c->app_layer + c->detect;
+}
+
+/** flow storage id, -1 if accounting is disabled */
+extern int g_flow_cpu_cost_id;
+
+void FlowCpuCostRegister(void);
+FlowCpuCost *FlowCpuCostAlloc(Flow *f);
+
+/** \brief get the cost record of a flow, allocating it if needed
+ *  \retval cost or NULL if accounting is disabled */
+static inline FlowCpuCost *FlowCpuCostGet(Flow *f)
+{
+    if (likely(g_flow_cpu_cost_id < 0))
+        return NULL;
+    FlowCpuCost *c = FlowGetStorageById(f, g_flow_cpu_cost_id);
+    if (unlikely(c == NULL))
+        c = FlowCpuCostAlloc(f);
+    return c;
+}
+
+/** top flows by total cost */
+typedef struct FlowCpuCostTopEntry_ {
+    char src_ip[46];
+    char dst_ip[46];
+    Port sp;
+    Port dp;
+    uint8_t proto;
+    AppProto alproto;
+    FlowCpuCost cost;
+    uint64_t total;
+} FlowCpuCostTopEntry;
+
+#define FLOW_CPU_COST_TOP_DEFAULT 10
+
+uint32_t FlowCpuCostGetTop(FlowCpuCostTopEntry *top, const uint32_t size);
+
+void FlowCpuCostRegisterTests(void);
+
+#endif /* __FLOW_CPU_COST_H__ */
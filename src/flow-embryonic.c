@@ -0,0 +1,385 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Embryonic flow table.
+ *
+ * A SYN flood creates a Flow and TcpSession for every SYN, exhausting the
+ * flow memcap and pushing the engine into emergency mode. When enabled, a
+ * SYN that doesn't match an existing flow is recorded in a direct mapped
+ * table of fixed size entries instead. No Flow is created for it. The next
+ * packet of the connection (usually the SYN/ACK) takes the entry and the
+ * stream engine sets up the session as if it had seen the SYN.
+ *
+ * Entries are never allocated: a SYN simply overwrites whatever was in
+ * its slot. Entries older than the timeout are considered expired.
+ */
+
+#include "suricata-common.h"
+#include "suricata.h"
+#include "threads.h"
+#include "conf.h"
+#include "decode.h"
+#include "counters.h"
+
+#include "flow.h"
+#include "flow-private.h"
+#include "flow-util.h"
+#include "flow-embryonic.h"
+
+#include "util-byte.h"
+#include "util-debug.h"
+#include "util-memcap-credit.h"
+#include "util-unittest.h"
+#include "util-unittest-helper.h"
+
+#define FLOW_EMBRYONIC_DEFAULT_SIZE     65536
+#define FLOW_EMBRYONIC_DEFAULT_TIMEOUT  30
+/** number of locks protecting the table. Each lock covers the slots with
+ *  the same index modulo this value. */
+#define FLOW_EMBRYONIC_LOCKS            1024
+
+typedef struct FlowEmbryonic_ {
+    Address src;
+    Address dst;
+    Port sp;
+    Port dp;
+    uint16_t vlan_id[2];
+    uint8_t recursion_level;
+    FlowEmbryonicSyn syn;   /**< syn.ts == 0 means the slot is unused */
+} FlowEmbryonic;
+
+bool flow_embryonic_enabled = false;
+
+static FlowEmbryonic *flow_embryonic_table = NULL;
+static uint32_t flow_embryonic_mask = 0;
+static uint32_t flow_embryonic_timeout = FLOW_EMBRYONIC_DEFAULT_TIMEOUT;
+static SCSpinlock flow_embryonic_locks[FLOW_EMBRYONIC_LOCKS];
+
+static SC_ATOMIC_DECLARE(uint64_t, flow_embryonic_created);
+static SC_ATOMIC_DECLARE(uint64_t, flow_embryonic_promoted);
+static SC_ATOMIC_DECLARE(uint64_t, flow_embryonic_expired);
+static SC_ATOMIC_DECLARE(uint64_t, flow_embryonic_overwritten);
+
+static uint64_t FlowEmbryonicGetCreated(void)
+{
+    return SC_ATOMIC_GET(flow_embryonic_created);
+}
+
+static uint64_t FlowEmbryonicGetPromoted(void)
+{
+    return SC_ATOMIC_GET(flow_embryonic_promoted);
+}
+
+static uint64_t FlowEmbryonicGetExpired(void)
+{
+    return SC_ATOMIC_GET(flow_embryonic_expired);
+}
+
+static uint64_t FlowEmbryonicGetOverwritten(void)
+{
+    return SC_ATOMIC_GET(flow_embryonic_overwritten);
+}
+
+void FlowEmbryonicRegisterCounters(void)
+{
+    if (!flow_embryonic_enabled)
+        return;
+
+    StatsRegisterGlobalCounter("flow.embryonic_created", FlowEmbryonicGetCreated);
+    StatsRegisterGlobalCounter("flow.embryonic_promoted", FlowEmbryonicGetPromoted);
+    StatsRegisterGlobalCounter("flow.embryonic_expired", FlowEmbryonicGetExpired);
+    StatsRegisterGlobalCounter("flow.embryonic_overwritten", FlowEmbryonicGetOverwritten);
+}
+
+static inline uint32_t RoundUpPow2(uint32_t v)
+{
+    uint32_t r = 1;
+    while (r < v && r < (1U << 31))
+        r <<= 1;
+    return r;
+}
+
+/** \brief initialize the embryonic table if enabled in the config
+ *  \warning Not thread safe */
+void FlowEmbryonicInitConfig(char quiet)
+{
+    SC_ATOMIC_INIT(flow_embryonic_created);
+    SC_ATOMIC_INIT(flow_embryonic_promoted);
+    SC_ATOMIC_INIT(flow_embryonic_expired);
+    SC_ATOMIC_INIT(flow_embryonic_overwritten);
+
+    flow_embryonic_enabled = false;
+    flow_embryonic_timeout = FLOW_EMBRYONIC_DEFAULT_TIMEOUT;
+
+    int enabled = 0;
+    if (ConfGetBool("flow.embryonic.enabled", &enabled) != 1 || !enabled)
+        return;
+
+    uint32_t size = FLOW_EMBRYONIC_DEFAULT_SIZE;
+    const char *conf_val;
+    uint32_t configval = 0;
+    if (ConfGet("flow.embryonic.hash-size", &conf_val) == 1 && conf_val != NULL) {
+        if (StringParseUint32(&configval, 10, strlen(conf_val), conf_val) > 0 &&
+                configval > 0) {
+            size = configval;
+        } else {
+            SCLogError(SC_ERR_INVALID_VALUE, "invalid flow.embryonic.hash-size "
+                    "value '%s', using default %u", conf_val, size);
+        }
+    }
+    size = RoundUpPow2(size);
+
+    if (ConfGet("flow.embryonic.timeout", &conf_val) == 1 && conf_val != NULL) {
+        if (StringParseUint32(&configval, 10, strlen(conf_val), conf_val) > 0 &&
+                configval > 0) {
+            flow_embryonic_timeout = configval;
+        } else {
+            SCLogError(SC_ERR_INVALID_VALUE, "invalid flow.embryonic.timeout "
+                    "value '%s', using default %u", conf_val, flow_embryonic_timeout);
+        }
+    }
+
+    const uint64_t table_size = (uint64_t)size * sizeof(FlowEmbryonic);
+    if (!(FLOW_CHECK_MEMCAP(table_size))) {
+        SCLogError(SC_ERR_FLOW_INIT, "allocating embryonic flow table failed: "
+                "flow memcap is too small for %"PRIu64" bytes. Embryonic flow "
+                "tracking disabled.", table_size);
+        return;
+    }
+    flow_embryonic_table = SCMallocAligned(table_size, CLS);
+    if (unlikely(flow_embryonic_table == NULL)) {
+        FatalError(SC_ERR_FATAL,
+                   "Fatal error encountered in FlowEmbryonicInitConfig. Exiting...");
+    }
+    memset(flow_embryonic_table, 0, table_size);
+    MemcapCreditIncr(MEMCAP_CREDIT_FLOW, table_size);
+
+    for (int i = 0; i < FLOW_EMBRYONIC_LOCKS; i++) {
+        SCSpinInit(&flow_embryonic_locks[i], 0);
+    }
+    flow_embryonic_mask = size - 1;
+    flow_embryonic_enabled = true;
+
+    if (quiet == FALSE) {
+        SCLogConfig("embryonic flow table: %u entries of %"PRIuMAX" bytes, "
+                "timeout %us", size, (uintmax_t)sizeof(FlowEmbryonic),
+                flow_embryonic_timeout);
+    }
+}
+
+/** \brief free the embryonic table
+ *  \warning Not thread safe */
+void FlowEmbryonicShutdown(void)
+{
+    if (flow_embryonic_table == NULL)
+        return;
+
+    for (int i = 0; i < FLOW_EMBRYONIC_LOCKS; i++) {
+        SCSpinDestroy(&flow_embryonic_locks[i]);
+    }
+    SCFreeAligned(flow_embryonic_table);
+    flow_embryonic_table = NULL;
+    MemcapCreditDecr(MEMCAP_CREDIT_FLOW,
+            (uint64_t)(flow_embryonic_mask + 1) * sizeof(FlowEmbryonic));
+    flow_embryonic_mask = 0;
+    flow_embryonic_enabled = false;
+}
+
+/** \internal
+ *  \brief compare entry with packet
+ *  \retval 1 packet in the direction of the SYN
+ *  \retval -1 packet in the opposite direction
+ *  \retval 0 no match
+ */
+static inline int FlowEmbryonicCompare(const FlowEmbryonic *e, const Packet *p)
+{
+    if (e->recursion_level != p->recursion_level ||
+        e->vlan_id[0] != (p->vlan_id[0] & g_vlan_mask) ||
+        e->vlan_id[1] != (p->vlan_id[1] & g_vlan_mask))
+        return 0;
+
+    if (e->sp == p->sp && e->dp == p->dp &&
+        CMP_ADDR(&e->src, &p->src) && CMP_ADDR(&e->dst, &p->dst))
+        return 1;
+    if (e->sp == p->dp && e->dp == p->sp &&
+        CMP_ADDR(&e->src, &p->dst) && CMP_ADDR(&e->dst, &p->src))
+        return -1;
+    return 0;
+}
+
+static inline bool FlowEmbryonicIsExpired(const FlowEmbryonic *e, const uint32_t now)
+{
+    return (now - e->syn.ts) > flow_embryonic_timeout;
+}
+
+/** \brief record a SYN packet in the embryonic table
+ *
+ *  A retransmitted SYN refreshes its entry. Any other entry in the
+ *  slot is overwritten.
+ */
+void FlowEmbryonicAdd(const Packet *p)
+{
+    const uint32_t idx = p->flow_hash & flow_embryonic_mask;
+    const uint32_t now = (uint32_t)p->ts.tv_sec;
+    FlowEmbryonic *e = &flow_embryonic_table[idx];
+    SCSpinlock *lock = &flow_embryonic_locks[idx % FLOW_EMBRYONIC_LOCKS];
+
+    SCSpinLock(lock);
+    if (e->syn.ts != 0 && FlowEmbryonicCompare(e, p) != 1) {
+        if (FlowEmbryonicIsExpired(e, now))
+            (void)SC_ATOMIC_ADD(flow_embryonic_expired, 1);
+        else
+            (void)SC_ATOMIC_ADD(flow_embryonic_overwritten, 1);
+        e->syn.ts = 0;
+    }
+    if (e->syn.ts == 0) {
+        COPY_ADDRESS(&p->src, &e->src);
+        COPY_ADDRESS(&p->dst, &e->dst);
+        e->sp = p->sp;
+        e->dp = p->dp;
+        e->vlan_id[0] = p->vlan_id[0] & g_vlan_mask;
+        e->vlan_id[1] = p->vlan_id[1] & g_vlan_mask;
+        e->recursion_level = p->recursion_level;
+        (void)SC_ATOMIC_ADD(flow_embryonic_created, 1);
+    }
+
+    /* a time of 0 marks an unused slot */
+    e->syn.ts = now ? now : 1;
+    e->syn.seq = TCP_GET_SEQ(p);
+    e->syn.win = TCP_GET_WINDOW(p);
+    e->syn.flags = 0;
+    e->syn.tsval = 0;
+    e->syn.wscale = 0;
+    if (TCP_HAS_TS(p)) {
+        e->syn.flags |= FLOW_EMBRYONIC_HAS_TS;
+        e->syn.tsval = TCP_GET_TSVAL(p);
+    }
+    if (TCP_HAS_WSCALE(p)) {
+        e->syn.flags |= FLOW_EMBRYONIC_HAS_WSCALE;
+        e->syn.wscale = TCP_GET_WSCALE(p);
+    }
+    if (TCP_GET_SACKOK(p) == 1)
+        e->syn.flags |= FLOW_EMBRYONIC_SACKOK;
+    SCSpinUnlock(lock);
+}
+
+/** \brief take the embryonic entry for the connection of a packet
+ *
+ *  On success the entry is removed from the table.
+ *
+ *  \param syn copy of the SYN properties
+ *  \param reversed set to true if the packet travels in the opposite
+ *                  direction of the SYN
+ *
+ *  \retval 1 entry found
+ *  \retval 0 no (valid) entry
+ */
+int FlowEmbryonicTake(const Packet *p, FlowEmbryonicSyn *syn, bool *reversed)
+{
+    const uint32_t idx = p->flow_hash & flow_embryonic_mask;
+    FlowEmbryonic *e = &flow_embryonic_table[idx];
+    SCSpinlock *lock = &flow_embryonic_locks[idx % FLOW_EMBRYONIC_LOCKS];
+    int r = 0;
+
+    SCSpinLock(lock);
+    if (e->syn.ts != 0) {
+        const int dir = FlowEmbryonicCompare(e, p);
+        if (dir != 0) {
+            if (FlowEmbryonicIsExpired(e, (uint32_t)p->ts.tv_sec)) {
+                (void)SC_ATOMIC_ADD(flow_embryonic_expired, 1);
+            } else {
+                *syn = e->syn;
+                *reversed = (dir == -1);
+                (void)SC_ATOMIC_ADD(flow_embryonic_promoted, 1);
+                r = 1;
+            }
+            e->syn.ts = 0;
+        }
+    }
+    SCSpinUnlock(lock);
+    return r;
+}
+
+#ifdef UNITTESTS
+static int FlowEmbryonicTest01(void)
+{
+    FlowInitConfig(FLOW_QUIET);
+    FlowEmbryonicShutdown();
+    ConfCreateContextBackup();
+    ConfInit();
+    ConfSet("flow.embryonic.enabled", "yes");
+    ConfSet("flow.embryonic.hash-size", "1000");
+    FlowEmbryonicInitConfig(FLOW_QUIET);
+    FAIL_IF_NOT(flow_embryonic_enabled);
+    FAIL_IF_NOT(flow_embryonic_mask == 1023);
+
+    Packet *syn = UTHBuildPacketReal(NULL, 0, IPPROTO_TCP,
+            "1.2.3.4", "5.6.7.8", 1024, 80);
+    FAIL_IF_NULL(syn);
+    syn->tcph->th_flags = TH_SYN;
+    syn->tcph->th_seq = htonl(100);
+    syn->flow_hash = 12345;
+    syn->ts.tv_sec = 1000;
+    FAIL_IF_NOT(FlowEmbryonicPacketIsSyn(syn));
+    FlowEmbryonicAdd(syn);
+    FAIL_IF_NOT(SC_ATOMIC_GET(flow_embryonic_created) == 1);
+    /* retransmission refreshes the entry */
+    FlowEmbryonicAdd(syn);
+    FAIL_IF_NOT(SC_ATOMIC_GET(flow_embryonic_created) == 1);
+
+    Packet *synack = UTHBuildPacketReal(NULL, 0, IPPROTO_TCP,
+            "5.6.7.8", "1.2.3.4", 80, 1024);
+    FAIL_IF_NULL(synack);
+    synack->tcph->th_flags = TH_SYN|TH_ACK;
+    synack->flow_hash = 12345;
+    synack->ts.tv_sec = 1001;
+    FAIL_IF(FlowEmbryonicPacketIsSyn(synack));
+
+    FlowEmbryonicSyn s;
+    bool reversed = false;
+    FAIL_IF_NOT(FlowEmbryonicTake(synack, &s, &reversed) == 1);
+    FAIL_IF_NOT(reversed);
+    FAIL_IF_NOT(s.seq == 100);
+    FAIL_IF_NOT(SC_ATOMIC_GET(flow_embryonic_promoted) == 1);
+    /* entry is gone after promotion */
+    FAIL_IF_NOT(FlowEmbryonicTake(synack, &s, &reversed) == 0);
+
+    /* expired entries are not promoted */
+    FlowEmbryonicAdd(syn);
+    synack->ts.tv_sec = 1000 + FLOW_EMBRYONIC_DEFAULT_TIMEOUT + 1;
+    FAIL_IF_NOT(FlowEmbryonicTake(synack, &s, &reversed) == 0);
+    FAIL_IF_NOT(SC_ATOMIC_GET(flow_embryonic_expired) == 1);
+
+    UTHFreePacket(syn);
+    UTHFreePacket(synack);
+    FlowEmbryonicShutdown();
+    ConfDeInit();
+    ConfRestoreContextBackup();
+    FlowShutdown();
+    PASS;
+}
+#endif /* UNITTESTS */
+
+void FlowEmbryonicRegisterTests(void)
+{
+#ifdef UNITTESTS
+    UtRegisterTest("FlowEmbryonicTest01", FlowEmbryonicTest01);
+#endif /* UNITTESTS */
+}
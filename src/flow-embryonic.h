@@ -0,0 +1,66 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Embryonic flow table: TCP flows that have only seen a SYN are tracked
+ * in a fixed size table of small entries instead of a full Flow and
+ * TcpSession. The entry is promoted to a full flow on the next packet
+ * of the connection.
+ */
+
+#ifndef __FLOW_EMBRYONIC_H__
+#define __FLOW_EMBRYONIC_H__
+
+#include "decode.h"
+
+#define FLOW_EMBRYONIC_HAS_TS       BIT_U8(0)
+#define FLOW_EMBRYONIC_HAS_WSCALE   BIT_U8(1)
+#define FLOW_EMBRYONIC_SACKOK       BIT_U8(2)
+
+/** SYN properties needed to set up the TcpSession on promotion */
+typedef struct FlowEmbryonicSyn_ {
+    uint32_t ts;        /**< time of the (last) SYN in seconds */
+    uint32_t seq;
+    uint32_t tsval;
+    uint16_t win;
+    uint8_t wscale;
+    uint8_t flags;      /**< FLOW_EMBRYONIC_* */
+} FlowEmbryonicSyn;
+
+extern bool flow_embryonic_enabled;
+
+void FlowEmbryonicInitConfig(char quiet);
+void FlowEmbryonicShutdown(void);
+void FlowEmbryonicRegisterCounters(void);
+
+/** \brief check if a packet should be tracked in the embryonic table
+ *         instead of getting a flow: a TCP SYN without ACK and data. */
+static inline bool FlowEmbryonicPacketIsSyn(const Packet *p)
+{
+    return flow_embryonic_enabled && p->proto == IPPROTO_TCP && p->tcph != NULL &&
+           (p->tcph->th_flags & (TH_SYN | TH_ACK | TH_RST | TH_FIN)) == TH_SYN &&
+           p->payload_len == 0;
+}
+
+void FlowEmbryonicAdd(const Packet *p);
+int FlowEmbryonicTake(const Packet *p, FlowEmbryonicSyn *syn, bool *reversed);
+
+void FlowEmbryonicRegisterTests(void);
+
+#endif /* __FLOW_EMBRYONIC_H__ */
@@ -38,6 +38,7 @@
 #include "flow-storage.h"
 #include "flow-timeout.h"
 #include "flow-spare-pool.h"
+#include "flow-embryonic.h"
 #include "app-layer-parser.h"
 
 #include "util-time.h"
@@ -717,7 +718,9 @@ static inline void FromHashLockCMP(Flow *f)
  *
  * If the flow is not found or the bucket was emtpy, a new flow is taken from
  * the spare pool. The pool will alloc new flows as long as we stay within our
- * memcap limit.
+ * memcap limit. If embryonic flow tracking is enabled, a TCP SYN that doesn't
+ * match a flow is recorded in the embryonic table instead and no flow is
+ * returned.
  *
  * The p->flow pointer is updated to point to the flow.
  *
@@ -740,6 +743,12 @@ Flow *FlowGetFlowFromHash(ThreadVars *tv, FlowLookupStruct *fls,
 
     /* see if the bucket already has a flow */
     if (fb->head == NULL) {
+        /* a bare SYN only gets an embryonic table entry */
+        if (FlowEmbryonicPacketIsSyn(p)) {
+            FBLOCK_UNLOCK(fb);
+            FlowEmbryonicAdd(p);
+            return NULL;
+        }
         f = FlowGetNew(tv, fls, p);
         if (f == NULL) {
             FBLOCK_UNLOCK(fb);
@@ -800,6 +809,11 @@ Flow *FlowGetFlowFromHash(ThreadVars *tv, FlowLookupStruct *fls,
 
 flow_removed:
         if (next_f == NULL) {
+            if (FlowEmbryonicPacketIsSyn(p)) {
+                FBLOCK_UNLOCK(fb);
+                FlowEmbryonicAdd(p);
+                return NULL;
+            }
             f = FlowGetNew(tv, fls, p);
             if (f == NULL) {
                 FBLOCK_UNLOCK(fb);
@@ -975,6 +989,31 @@ static inline uint32_t GetUsedAtomicUpdate(const uint32_t val)
     return r;
 }
 
+/** \brief get the eviction class of a flow
+ *
+ *  Classification is done at eviction time from the flow state, so the
+ *  packet path doesn't have to track it.
+ *
+ *  \note flow must be locked
+ */
+uint8_t FlowHashGetEvictClass(const Flow *f)
+{
+    switch (f->flow_state) {
+        case FLOW_STATE_LOCAL_BYPASSED:
+#ifdef CAPTURE_OFFLOAD
+        case FLOW_STATE_CAPTURE_BYPASSED:
+#endif
+            return FLOW_EVICT_CLASS_BYPASSED;
+        default:
+            break;
+    }
+    if (f->proto != IPPROTO_TCP)
+        return FLOW_EVICT_CLASS_OTHER;
+    if (f->flow_state == FLOW_STATE_ESTABLISHED)
+        return FLOW_EVICT_CLASS_TCP_EST;
+    return FLOW_EVICT_CLASS_TCP_NEW;
+}
+
 /** \internal
  *  \brief check if flow has just seen an update.
  */
@@ -1015,6 +1054,91 @@ static inline bool StillAlive(const Flow *f, const struct timeval *ts)
         StatsAddUI64(tv, dtv->cnt, (value));
 #endif
 
+static inline void GetUsedIncrClass(ThreadVars *tv, DecodeThreadVars *dtv,
+        const uint8_t c)
+{
+    switch (c) {
+        case FLOW_EVICT_CLASS_TCP_NEW:
+            STATSADDUI64(counter_flow_get_used_tcp_new, 1);
+            break;
+        case FLOW_EVICT_CLASS_OTHER:
+            STATSADDUI64(counter_flow_get_used_other, 1);
+            break;
+        case FLOW_EVICT_CLASS_TCP_EST:
+            STATSADDUI64(counter_flow_get_used_tcp_est, 1);
+            break;
+        case FLOW_EVICT_CLASS_BYPASSED:
+            STATSADDUI64(counter_flow_get_used_bypassed, 1);
+            break;
+    }
+}
+
+/** \internal
+ *  \brief try to take an evictable flow out of a hash row
+ *
+ *  Walks the row and takes the first flow that isn't in use, isn't still
+ *  alive and has an eviction class of at most \a max_class. Only trylocks
+ *  are used.
+ *
+ *  \param min_class[out] lowest class of the evictable flows seen in the
+ *                        row that were not taken
+ *
+ *  \retval f locked flow, removed from the hash, or NULL
+ */
+static Flow *GetUsedFromRow(ThreadVars *tv, DecodeThreadVars *dtv, FlowBucket *fb,
+        const struct timeval *ts, const uint8_t max_class, uint8_t *min_class)
+{
+    if (GetUsedTryLockBucket(fb) != 0) {
+        STATSADDUI64(counter_flow_get_used_eval_busy, 1);
+        return NULL;
+    }
+
+    Flow *prev_f = NULL;
+    for (Flow *f = fb->head; f != NULL; prev_f = f, f = f->next) {
+        if (GetUsedTryLockFlow(f) != 0) {
+            STATSADDUI64(counter_flow_get_used_eval_busy, 1);
+            continue;
+        }
+
+        /** never prune a flow that is used by a packet or stream msg
+         *  we are currently processing in one of the threads */
+        if (f->use_cnt > 0) {
+            STATSADDUI64(counter_flow_get_used_eval_busy, 1);
+            FLOWLOCK_UNLOCK(f);
+            continue;
+        }
+
+        if (StillAlive(f, ts)) {
+            STATSADDUI64(counter_flow_get_used_eval_reject, 1);
+            FLOWLOCK_UNLOCK(f);
+            continue;
+        }
+
+        const uint8_t c = FlowHashGetEvictClass(f);
+        if (c > max_class) {
+            if (c < *min_class)
+                *min_class = c;
+            FLOWLOCK_UNLOCK(f);
+            continue;
+        }
+
+        /* remove from the hash */
+        if (prev_f != NULL)
+            prev_f->next = f->next;
+        else
+            fb->head = f->next;
+        f->next = NULL;
+        f->fb = NULL;
+        FBLOCK_UNLOCK(fb);
+
+        GetUsedIncrClass(tv, dtv, c);
+        return f;
+    }
+
+    FBLOCK_UNLOCK(fb);
+    return NULL;
+}
+
 /** \internal
  *  \brief Get a flow from the hash directly.
  *
@@ -1025,6 +1149,12 @@ static inline bool StillAlive(const Flow *f, const struct timeval *ts)
  *  top each time since that would clear the top of the hash leading to longer
  *  and longer search times under high pressure (observed).
  *
+ *  Flows are classified when they are evaluated, in order of least to most
+ *  valuable: unestablished TCP, other protocols, established TCP and
+ *  bypassed. An unestablished TCP flow is taken right away. Otherwise the
+ *  row holding the least valuable candidate is revisited once the rows have
+ *  been walked.
+ *
  *  \param tv thread vars
  *  \param dtv decode thread vars (for flow log api thread data)
  *
@@ -1034,10 +1164,12 @@ static Flow *FlowGetUsedFlow(ThreadVars *tv, DecodeThreadVars *dtv, const struct
 {
     uint32_t idx = GetUsedAtomicUpdate(FLOW_GET_NEW_TRIES) % flow_config.hash_size;
     uint32_t tried = 0;
+    uint32_t best_idx = 0;
+    uint8_t best_class = FLOW_EVICT_CLASS_MAX;
+    Flow *f = NULL;
 
     while (1) {
         if (tried++ > FLOW_GET_NEW_TRIES) {
-            STATSADDUI64(counter_flow_get_used_eval, tried);
             break;
         }
         if (++idx >= flow_config.hash_size)
@@ -1048,69 +1180,45 @@ static Flow *FlowGetUsedFlow(ThreadVars *tv, DecodeThreadVars *dtv, const struct
         if (SC_ATOMIC_GET(fb->next_ts) == INT_MAX)
             continue;
 
-        if (GetUsedTryLockBucket(fb) != 0) {
-            STATSADDUI64(counter_flow_get_used_eval_busy, 1);
-            continue;
-        }
-
-        Flow *f = fb->head;
-        if (f == NULL) {
-            FBLOCK_UNLOCK(fb);
-            continue;
-        }
-
-        if (GetUsedTryLockFlow(f) != 0) {
-            STATSADDUI64(counter_flow_get_used_eval_busy, 1);
-            FBLOCK_UNLOCK(fb);
-            continue;
-        }
-
-        /** never prune a flow that is used by a packet or stream msg
-         *  we are currently processing in one of the threads */
-        if (f->use_cnt > 0) {
-            STATSADDUI64(counter_flow_get_used_eval_busy, 1);
-            FBLOCK_UNLOCK(fb);
-            FLOWLOCK_UNLOCK(f);
-            continue;
+        uint8_t min_class = FLOW_EVICT_CLASS_MAX;
+        f = GetUsedFromRow(tv, dtv, fb, ts, FLOW_EVICT_CLASS_TCP_NEW, &min_class);
+        if (f != NULL)
+            break;
+        if (min_class < best_class) {
+            best_class = min_class;
+            best_idx = idx;
         }
+    }
 
-        if (StillAlive(f, ts)) {
-            STATSADDUI64(counter_flow_get_used_eval_reject, 1);
-            FBLOCK_UNLOCK(fb);
-            FLOWLOCK_UNLOCK(f);
-            continue;
-        }
+    if (f == NULL && best_class != FLOW_EVICT_CLASS_MAX) {
+        uint8_t min_class = FLOW_EVICT_CLASS_MAX;
+        f = GetUsedFromRow(tv, dtv, &flow_hash[best_idx], ts, best_class, &min_class);
+    }
 
-        /* remove from the hash */
-        fb->head = f->next;
-        f->next = NULL;
-        f->fb = NULL;
-        FBLOCK_UNLOCK(fb);
+    STATSADDUI64(counter_flow_get_used_eval, tried);
+    if (f == NULL) {
+        STATSADDUI64(counter_flow_get_used_failed, 1);
+        return NULL;
+    }
 
-        /* rest of the flags is updated on-demand in output */
-        f->flow_end_flags |= FLOW_END_FLAG_FORCED;
-        if (SC_ATOMIC_GET(flow_flags) & FLOW_EMERGENCY)
-            f->flow_end_flags |= FLOW_END_FLAG_EMERGENCY;
+    /* rest of the flags is updated on-demand in output */
+    f->flow_end_flags |= FLOW_END_FLAG_FORCED;
+    if (SC_ATOMIC_GET(flow_flags) & FLOW_EMERGENCY)
+        f->flow_end_flags |= FLOW_END_FLAG_EMERGENCY;
 
-        /* invoke flow log api */
+    /* invoke flow log api */
 #ifdef UNITTESTS
-        if (dtv) {
+    if (dtv) {
 #endif
-            if (dtv->output_flow_thread_data) {
-                (void)OutputFlowLog(tv, dtv->output_flow_thread_data, f);
-            }
-#ifdef UNITTESTS
+        if (dtv->output_flow_thread_data) {
+            (void)OutputFlowLog(tv, dtv->output_flow_thread_data, f);
         }
+#ifdef UNITTESTS
+    }
 #endif
 
-        FlowClearMemory(f, f->protomap);
-
-        /* leave locked */
+    FlowClearMemory(f, f->protomap);
 
-        STATSADDUI64(counter_flow_get_used_eval, tried);
-        return f;
-    }
-
-    STATSADDUI64(counter_flow_get_used_failed, 1);
-    return NULL;
+    /* leave locked */
+    return f;
 }
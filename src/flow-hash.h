@@ -75,8 +75,20 @@ typedef struct FlowBucket_ {
     #error Enable FBLOCK_SPIN or FBLOCK_MUTEX
 #endif
 
+/** eviction classes, in the order in which flows are evicted when the
+ *  memcap is reached. */
+enum FlowEvictClass {
+    FLOW_EVICT_CLASS_TCP_NEW = 0,   /**< TCP that is not (or no longer) established */
+    FLOW_EVICT_CLASS_OTHER,         /**< UDP, ICMP and other non-TCP */
+    FLOW_EVICT_CLASS_TCP_EST,       /**< established TCP */
+    FLOW_EVICT_CLASS_BYPASSED,      /**< local or capture bypassed */
+    FLOW_EVICT_CLASS_MAX,
+};
+
 /* prototypes */
 
+uint8_t FlowHashGetEvictClass(const Flow *f);
+
 Flow *FlowGetFlowFromHash(ThreadVars *tv, FlowLookupStruct *tctx,
         const Packet *, Flow **);
 
@@ -43,6 +43,7 @@
 #include "flow-manager.h"
 #include "flow-storage.h"
 #include "flow-spare-pool.h"
+#include "flow-embryonic.h"
 
 #include "stream-tcp-private.h"
 #include "stream-tcp-reassemble.h"
@@ -308,10 +309,16 @@ static inline void FMFlowLock(Flow *f)
     FLOWLOCK_WRLOCK(f);
 }
 
+#define FLOW_MANAGER_COMPRESS_MAX 64
+
 typedef struct FlowManagerTimeoutThread {
     /* used to temporarily store flows that have timed out and are
      * removed from the hash */
     FlowQueuePrivate aside_queue;
+    /* referenced idle TCP flows that have their stream data compressed
+     * after the hash row lock is released */
+    Flow *compress[FLOW_MANAGER_COMPRESS_MAX];
+    uint32_t compress_cnt;
 } FlowManagerTimeoutThread;
 
 static uint32_t ProcessAsideQueue(FlowManagerTimeoutThread *td, FlowTimeoutCounters *counters)
@@ -353,6 +360,55 @@ static uint32_t ProcessAsideQueue(FlowManagerTimeoutThread *td, FlowTimeoutCount
     return cnt;
 }
 
+/** \internal
+ *  \brief queue an idle TCP flow for compression of its stream data
+ *
+ *  Called with the hash row lock held. The flow is referenced so it can't
+ *  be removed from the hash and freed before FlowManagerCompressFlows()
+ *  runs. Skips the flow if its lock is contended or it is in use by a
+ *  packet.
+ */
+static void FlowManagerFlowCompressQueue(FlowManagerTimeoutThread *td,
+        Flow *f, struct timeval *ts)
+{
+    if (td->compress_cnt == FLOW_MANAGER_COMPRESS_MAX)
+        return;
+    if (f->proto != IPPROTO_TCP || f->protoctx == NULL ||
+            f->lastts.tv_sec + (time_t)stream_config.reassembly_compress_idle > ts->tv_sec)
+        return;
+
+    if (FLOWLOCK_TRYWRLOCK(f) != 0)
+        return;
+    if (f->use_cnt == 0 && f->protoctx != NULL) {
+        FlowIncrUsecnt(f);
+        td->compress[td->compress_cnt++] = f;
+    }
+    FLOWLOCK_UNLOCK(f);
+}
+
+/** \internal
+ *  \brief compress the retained stream data of the queued flows
+ *
+ *  Called after the hash row lock is released. A flow that picked up
+ *  another reference in the meantime is in use by a packet and is left
+ *  alone.
+ */
+static void FlowManagerCompressFlows(FlowManagerTimeoutThread *td)
+{
+    for (uint32_t i = 0; i < td->compress_cnt; i++) {
+        Flow *f = td->compress[i];
+        td->compress[i] = NULL;
+
+        FLOWLOCK_WRLOCK(f);
+        if (f->use_cnt == 1 && f->protoctx != NULL) {
+            (void)StreamTcpReassembleCompressSession(f->protoctx);
+        }
+        FlowDecrUsecnt(f);
+        FLOWLOCK_UNLOCK(f);
+    }
+    td->compress_cnt = 0;
+}
+
 /**
  *  \internal
  *
@@ -369,6 +425,7 @@ static void FlowManagerHashRowTimeout(FlowManagerTimeoutThread *td,
 {
     uint32_t checked = 0;
     Flow *prev_f = NULL;
+    const bool compress = StreamTcpReassembleCompressNeeded();
 
     do {
         checked++;
@@ -383,6 +440,9 @@ static void FlowManagerHashRowTimeout(FlowManagerTimeoutThread *td,
 
             counters->flows_notimeout++;
 
+            if (compress)
+                FlowManagerFlowCompressQueue(td, f, ts);
+
             prev_f = f;
             f = f->next;
             continue;
@@ -509,6 +569,10 @@ static uint32_t FlowTimeoutHash(FlowManagerTimeoutThread *td,
                         rows_empty++;
                     }
                     FBLOCK_UNLOCK(fb);
+                    /* compress outside of the row lock */
+                    if (td->compress_cnt) {
+                        FlowManagerCompressFlows(td);
+                    }
                     /* processed evicted list */
                     if (evicted) {
                         FlowManagerHashRowClearEvictedList(td, evicted, ts, counters);
@@ -858,7 +922,7 @@ static TmEcode FlowManager(ThreadVars *th_v, void *thread_data)
 #endif
         /* Get the time */
         memset(&ts, 0, sizeof(ts));
-        TimeGet(&ts);
+        TimeGetCoarse(&ts);
         SCLogDebug("ts %" PRIdMAX "", (intmax_t)ts.tv_sec);
         const uint64_t ts_ms = ts.tv_sec * 1000 + ts.tv_usec / 1000;
         const uint32_t rt = (uint32_t)ts.tv_sec;
@@ -1064,6 +1128,8 @@ void FlowManagerThreadSpawn()
 
     SCLogConfig("using %u flow manager threads", flowmgr_number);
     StatsRegisterGlobalCounter("flow.memuse", FlowGetMemuse);
+    StatsRegisterGlobalCounter("flow.drain_duration_ms", FlowForceReassemblyDrainDuration);
+    FlowEmbryonicRegisterCounters();
 
     for (uint32_t u = 0; u < flowmgr_number; u++) {
         char name[TM_THREAD_NAME_MAX];
@@ -1177,7 +1243,7 @@ static TmEcode FlowRecycler(ThreadVars *th_v, void *thread_data)
 
         /* Get the time */
         memset(&ts, 0, sizeof(ts));
-        TimeGet(&ts);
+        TimeGetCoarse(&ts);
         SCLogDebug("ts %" PRIdMAX "", (intmax_t)ts.tv_sec);
 
         Flow *f;
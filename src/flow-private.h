@@ -97,9 +97,6 @@ extern FlowQueue flow_recycle_q;
 extern FlowBucket *flow_hash;
 extern FlowConfig flow_config;
 
-/** flow memuse counter (atomic), for enforcing memcap limit */
-SC_ATOMIC_EXTERN(uint64_t, flow_memuse);
-
 typedef FlowProtoTimeout *FlowProtoTimeoutPtr;
 SC_ATOMIC_EXTERN(FlowProtoTimeoutPtr, flow_timeouts);
 
@@ -351,6 +351,20 @@ void FlowForceReassemblyForFlow(Flow *f)
     TmThreadsInjectFlowById(f, thread_id);
 }
 
+/** shutdown flow drain: the flow hash is split into chunks of rows that are
+ *  claimed by the main thread and by the packet threads in their flow loop */
+#define FLOW_DRAIN_CHUNK_SIZE 4096
+
+static SC_ATOMIC_DECLARE(bool, flow_drain_active);
+/** next hash row to claim */
+static SC_ATOMIC_DECLARE(uint64_t, flow_drain_next);
+/** number of hash rows processed */
+static SC_ATOMIC_DECLARE(uint64_t, flow_drain_done);
+/** number of flows handed to their threads for reassembly */
+static SC_ATOMIC_DECLARE(uint64_t, flow_drain_flows);
+/** duration of the last drain in milliseconds */
+static SC_ATOMIC_DECLARE(uint64_t, flow_drain_msec);
+
 /**
  * \internal
  * \brief Forces reassembly for flows that need it.
@@ -364,11 +378,16 @@ void FlowForceReassemblyForFlow(Flow *f)
  * - be robust in case of future changes
  * - locking overhead if neglectable when no other thread fights us
  *
- * \param q The queue to process flows from.
+ * \param start first hash row to process
+ * \param end last hash row to process + 1
+ *
+ * \retval cnt number of flows handed over for reassembly
  */
-static inline void FlowForceReassemblyForHash(void)
+static inline uint32_t FlowForceReassemblyForHash(const uint32_t start, const uint32_t end)
 {
-    for (uint32_t idx = 0; idx < flow_config.hash_size; idx++) {
+    uint32_t cnt = 0;
+
+    for (uint32_t idx = start; idx < end; idx++) {
         FlowBucket *fb = &flow_hash[idx];
 
         PacketPoolWaitForN(9);
@@ -400,6 +419,7 @@ static inline void FlowForceReassemblyForHash(void)
                 RemoveFromHash(f, prev_f);
                 f->flow_end_flags |= FLOW_END_FLAG_SHUTDOWN;
                 FlowForceReassemblyForFlow(f);
+                cnt++;
                 f = next_f;
                 continue;
             }
@@ -412,15 +432,86 @@ static inline void FlowForceReassemblyForHash(void)
         }
         FBLOCK_UNLOCK(fb);
     }
-    return;
+    return cnt;
+}
+
+/**
+ * \brief Claim and process one chunk of the flow hash during the
+ *        shutdown flow drain.
+ *
+ * Called by the main thread and by packet threads waiting in their flow
+ * loop, so that the hash walk is spread over the available threads. The
+ * flows that need work are injected into the thread that owns them.
+ *
+ * \retval rows number of hash rows processed, 0 if there is nothing (left)
+ *         to drain
+ */
+uint32_t FlowForceReassemblyDrainChunk(void)
+{
+    if (!SC_ATOMIC_GET(flow_drain_active))
+        return 0;
+    if (SC_ATOMIC_GET(flow_drain_next) >= flow_config.hash_size)
+        return 0;
+
+    const uint64_t start = SC_ATOMIC_ADD(flow_drain_next, FLOW_DRAIN_CHUNK_SIZE);
+    if (start >= flow_config.hash_size)
+        return 0;
+    const uint64_t end = MIN(start + FLOW_DRAIN_CHUNK_SIZE, flow_config.hash_size);
+
+    uint32_t cnt = FlowForceReassemblyForHash((uint32_t)start, (uint32_t)end);
+    (void) SC_ATOMIC_ADD(flow_drain_flows, cnt);
+    (void) SC_ATOMIC_ADD(flow_drain_done, end - start);
+    return (uint32_t)(end - start);
+}
+
+/**
+ * \brief Duration of the last shutdown flow drain in milliseconds.
+ */
+uint64_t FlowForceReassemblyDrainDuration(void)
+{
+    uint64_t msec = SC_ATOMIC_GET(flow_drain_msec);
+    return msec;
 }
 
 /**
  * \brief Force reassembly for all the flows that have unprocessed segments.
+ *
+ * The hash walk is shared with the packet threads that are in their flow
+ * loop. This function returns when all rows have been processed.
  */
 void FlowForceReassembly(void)
 {
+    struct timeval start_ts, cur_ts;
+    gettimeofday(&start_ts, NULL);
+    time_t last_report = start_ts.tv_sec;
+
+    SC_ATOMIC_SET(flow_drain_next, 0);
+    SC_ATOMIC_SET(flow_drain_done, 0);
+    SC_ATOMIC_SET(flow_drain_flows, 0);
+    SC_ATOMIC_SET(flow_drain_active, true);
+
     /* Carry out flow reassembly for unattended flows */
-    FlowForceReassemblyForHash();
+    while (SC_ATOMIC_GET(flow_drain_done) < flow_config.hash_size) {
+        /* all chunks are claimed, wait for the other threads */
+        if (FlowForceReassemblyDrainChunk() == 0)
+            SleepMsec(1);
+
+        gettimeofday(&cur_ts, NULL);
+        if (cur_ts.tv_sec != last_report) {
+            last_report = cur_ts.tv_sec;
+            SCLogInfo("draining flows: %"PRIu64"/%u hash rows done, "
+                    "%"PRIu64" flows need reassembly",
+                    SC_ATOMIC_GET(flow_drain_done), flow_config.hash_size,
+                    SC_ATOMIC_GET(flow_drain_flows));
+        }
+    }
+    SC_ATOMIC_SET(flow_drain_active, false);
+
+    gettimeofday(&cur_ts, NULL);
+    const uint64_t msec = ((uint64_t)cur_ts.tv_sec * 1000 + cur_ts.tv_usec / 1000) -
+                          ((uint64_t)start_ts.tv_sec * 1000 + start_ts.tv_usec / 1000);
+    SC_ATOMIC_SET(flow_drain_msec, msec);
+    SCLogPerf("flow drain took %"PRIu64"ms, %"PRIu64" flows need reassembly",
+            msec, SC_ATOMIC_GET(flow_drain_flows));
     return;
 }
@@ -27,6 +27,8 @@
 void FlowForceReassemblyForFlow(Flow *f);
 int FlowForceReassemblyNeedReassembly(Flow *f);
 void FlowForceReassembly(void);
+uint32_t FlowForceReassemblyDrainChunk(void);
+uint64_t FlowForceReassemblyDrainDuration(void);
 void FlowForceReassemblySetup(int detect_disabled);
 
 #endif /* __FLOW_TIMEOUT_H__ */
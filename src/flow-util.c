@@ -57,11 +57,11 @@ Flow *FlowAlloc(void)
         return NULL;
     }
 
-    (void) SC_ATOMIC_ADD(flow_memuse, size);
+    MemcapCreditIncr(MEMCAP_CREDIT_FLOW, size);
 
     f = SCMalloc(size);
     if (unlikely(f == NULL)) {
-        (void)SC_ATOMIC_SUB(flow_memuse, size);
+        MemcapCreditDecr(MEMCAP_CREDIT_FLOW, size);
         return NULL;
     }
     memset(f, 0, size);
@@ -83,7 +83,7 @@ void FlowFree(Flow *f)
     SCFree(f);
 
     size_t size = sizeof(Flow) + FlowStorageSize();
-    (void) SC_ATOMIC_SUB(flow_memuse, size);
+    MemcapCreditDecr(MEMCAP_CREDIT_FLOW, size);
 }
 
 /**
@@ -26,6 +26,7 @@
 
 #include "detect-engine-state.h"
 #include "tmqh-flow.h"
+#include "util-memcap-credit.h"
 
 #define COPY_TIMESTAMP(src,dst) ((dst)->tv_sec = (src)->tv_sec, (dst)->tv_usec = (src)->tv_usec)
 
@@ -142,7 +143,7 @@
  *  \retval 0 no fit
  */
 #define FLOW_CHECK_MEMCAP(size) \
-    ((((uint64_t)SC_ATOMIC_GET(flow_memuse) + (uint64_t)(size)) <= SC_ATOMIC_GET(flow_config.memcap)))
+    MemcapCreditCheck(MEMCAP_CREDIT_FLOW, (uint64_t)(size), SC_ATOMIC_GET(flow_config.memcap))
 
 Flow *FlowAlloc(void);
 Flow *FlowAllocDirect(void);
@@ -48,6 +48,9 @@
 #include "flow-manager.h"
 #include "flow-timeout.h"
 #include "flow-spare-pool.h"
+#include "flow-cpu-cost.h"
+
+#include "util-cpu.h"
 
 typedef DetectEngineThreadCtx *DetectEngineThreadCtxPtr;
 
@@ -357,13 +360,38 @@ static void FlowPruneFiles(Packet *p)
     }
 }
 
+/** \internal
+ *  \brief run detection, accounting the cycles to the flow if enabled */
+static inline void FlowWorkerDetect(ThreadVars *tv, Packet *p, void *detect_thread)
+{
+    FlowCpuCost *cost = p->flow ? FlowCpuCostGet(p->flow) : NULL;
+    const uint64_t start = cost ? UtilCpuGetTicks() : 0;
+
+    FLOWWORKER_PROFILING_START(p, PROFILE_FLOWWORKER_DETECT);
+    Detect(tv, p, detect_thread);
+    FLOWWORKER_PROFILING_END(p, PROFILE_FLOWWORKER_DETECT);
+
+    if (cost)
+        cost->detect += UtilCpuGetTicks() - start;
+}
+
 static inline void FlowWorkerStreamTCPUpdate(ThreadVars *tv, FlowWorkerThreadData *fw,
         Packet *p, void *detect_thread)
 {
+    /* app-layer time is accounted in AppLayerHandleTCPData(), so take
+     * it out of the stream time */
+    FlowCpuCost *cost = FlowCpuCostGet(p->flow);
+    const uint64_t start = cost ? UtilCpuGetTicks() : 0;
+    const uint64_t app_start = cost ? cost->app_layer : 0;
+
     FLOWWORKER_PROFILING_START(p, PROFILE_FLOWWORKER_STREAM);
     StreamTcp(tv, p, fw->stream_thread, &fw->pq);
     FLOWWORKER_PROFILING_END(p, PROFILE_FLOWWORKER_STREAM);
 
+    if (cost) {
+        cost->stream += (UtilCpuGetTicks() - start) - (cost->app_layer - app_start);
+    }
+
     if (FlowChangeProto(p->flow)) {
         StreamTcpDetectLogFlush(tv, fw->stream_thread, p->flow, p, &fw->pq);
         AppLayerParserStateSetFlag(p->flow->alparser, APP_LAYER_PARSER_EOF_TS);
@@ -377,9 +405,7 @@ static inline void FlowWorkerStreamTCPUpdate(ThreadVars *tv, FlowWorkerThreadDat
         SCLogDebug("packet %"PRIu64" extra packet %p", p->pcap_cnt, x);
 
         if (detect_thread != NULL) {
-            FLOWWORKER_PROFILING_START(x, PROFILE_FLOWWORKER_DETECT);
-            Detect(tv, x, detect_thread);
-            FLOWWORKER_PROFILING_END(x, PROFILE_FLOWWORKER_DETECT);
+            FlowWorkerDetect(tv, x, detect_thread);
         }
 
         OutputLoggerLog(tv, x, fw->output_thread);
@@ -405,9 +431,7 @@ static void FlowWorkerFlowTimeout(ThreadVars *tv, Packet *p, FlowWorkerThreadDat
     /* handle Detect */
     SCLogDebug("packet %"PRIu64" calling Detect", p->pcap_cnt);
     if (detect_thread != NULL) {
-        FLOWWORKER_PROFILING_START(p, PROFILE_FLOWWORKER_DETECT);
-        Detect(tv, p, detect_thread);
-        FLOWWORKER_PROFILING_END(p, PROFILE_FLOWWORKER_DETECT);
+        FlowWorkerDetect(tv, p, detect_thread);
     }
 
     // Outputs.
@@ -525,9 +549,15 @@ static TmEcode FlowWorker(ThreadVars *tv, Packet *p, void *data)
 
     /* handle the app layer part of the UDP packet payload */
     } else if (p->flow && p->proto == IPPROTO_UDP) {
+        FlowCpuCost *cost = FlowCpuCostGet(p->flow);
+        const uint64_t start = cost ? UtilCpuGetTicks() : 0;
+
         FLOWWORKER_PROFILING_START(p, PROFILE_FLOWWORKER_APPLAYERUDP);
         AppLayerHandleUdp(tv, fw->stream_thread->ra_ctx->app_tctx, p, p->flow);
         FLOWWORKER_PROFILING_END(p, PROFILE_FLOWWORKER_APPLAYERUDP);
+
+        if (cost)
+            cost->app_layer += UtilCpuGetTicks() - start;
     }
 
     PacketUpdateEngineEventCounters(tv, fw->dtv, p);
@@ -536,9 +566,7 @@ static TmEcode FlowWorker(ThreadVars *tv, Packet *p, void *data)
     DEBUG_ASSERT_FLOW_LOCKED(p->flow);
     SCLogDebug("packet %"PRIu64" calling Detect", p->pcap_cnt);
     if (detect_thread != NULL) {
-        FLOWWORKER_PROFILING_START(p, PROFILE_FLOWWORKER_DETECT);
-        Detect(tv, p, detect_thread);
-        FLOWWORKER_PROFILING_END(p, PROFILE_FLOWWORKER_DETECT);
+        FlowWorkerDetect(tv, p, detect_thread);
     }
 
     // Outputs.
@@ -37,6 +37,7 @@
 #include "flow.h"
 #include "flow-queue.h"
 #include "flow-hash.h"
+#include "flow-embryonic.h"
 #include "flow-util.h"
 #include "flow-var.h"
 #include "flow-private.h"
@@ -97,9 +98,6 @@ FlowProtoFreeFunc flow_freefuncs[FLOW_PROTO_MAX];
 
 FlowConfig flow_config;
 
-/** flow memuse counter (atomic), for enforcing memcap limit */
-SC_ATOMIC_DECLARE(uint64_t, flow_memuse);
-
 void FlowRegisterTests(void);
 void FlowInitFlowProto(void);
 int FlowSetProtoFreeFunc(uint8_t, void (*Free)(void *));
@@ -114,7 +112,7 @@ extern int run_mode;
  */
 int FlowSetMemcap(uint64_t size)
 {
-    if ((uint64_t)SC_ATOMIC_GET(flow_memuse) < size) {
+    if ((uint64_t)FlowGetMemuse() < size) {
         SC_ATOMIC_SET(flow_config.memcap, size);
         return 1;
     }
@@ -135,8 +133,7 @@ uint64_t FlowGetMemcap(void)
 
 uint64_t FlowGetMemuse(void)
 {
-    uint64_t memusecopy = SC_ATOMIC_GET(flow_memuse);
-    return memusecopy;
+    return MemcapCreditGetMemuse(MEMCAP_CREDIT_FLOW);
 }
 
 void FlowCleanupAppLayer(Flow *f)
@@ -519,7 +516,7 @@ void FlowInitConfig(char quiet)
 
     memset(&flow_config,  0, sizeof(flow_config));
     SC_ATOMIC_INIT(flow_flags);
-    SC_ATOMIC_INIT(flow_memuse);
+    MemcapCreditInit(MEMCAP_CREDIT_FLOW);
     SC_ATOMIC_INIT(flow_prune_idx);
     SC_ATOMIC_INIT(flow_config.memcap);
     FlowQueueInit(&flow_recycle_q);
@@ -616,18 +613,19 @@ void FlowInitConfig(char quiet)
         FBLOCK_INIT(&flow_hash[i]);
         SC_ATOMIC_INIT(flow_hash[i].next_ts);
     }
-    (void) SC_ATOMIC_ADD(flow_memuse, (flow_config.hash_size * sizeof(FlowBucket)));
+    MemcapCreditIncr(MEMCAP_CREDIT_FLOW, (flow_config.hash_size * sizeof(FlowBucket)));
 
     if (quiet == FALSE) {
         SCLogConfig("allocated %"PRIu64" bytes of memory for the flow hash... "
                   "%" PRIu32 " buckets of size %" PRIuMAX "",
-                  SC_ATOMIC_GET(flow_memuse), flow_config.hash_size,
+                  FlowGetMemuse(), flow_config.hash_size,
                   (uintmax_t)sizeof(FlowBucket));
     }
     FlowSparePoolInit();
+    FlowEmbryonicInitConfig(quiet);
     if (quiet == FALSE) {
         SCLogConfig("flow memory usage: %"PRIu64" bytes, maximum: %"PRIu64,
-                SC_ATOMIC_GET(flow_memuse), SC_ATOMIC_GET(flow_config.memcap));
+                FlowGetMemuse(), SC_ATOMIC_GET(flow_config.memcap));
     }
 
     FlowInitFlowProto();
@@ -676,9 +674,10 @@ void FlowShutdown(void)
         SCFreeAligned(flow_hash);
         flow_hash = NULL;
     }
-    (void) SC_ATOMIC_SUB(flow_memuse, flow_config.hash_size * sizeof(FlowBucket));
+    MemcapCreditDecr(MEMCAP_CREDIT_FLOW, flow_config.hash_size * sizeof(FlowBucket));
     FlowQueueDestroy(&flow_recycle_q);
     FlowSparePoolDestroy();
+    FlowEmbryonicShutdown();
     return;
 }
 
@@ -1379,6 +1378,47 @@ static int FlowTest09 (void)
     return result;
 }
 
+/**
+ *  \test   Test that flows in the hash are classified for eviction by
+ *          their protocol and state.
+ */
+static int FlowTest10 (void)
+{
+    FlowInitConfig(FLOW_QUIET);
+
+    FlowKey key;
+    memset(&key, 0, sizeof(key));
+    key.src.family = key.dst.family = AF_INET;
+    key.src.addr_data32[0] = 0x01020304;
+    key.dst.addr_data32[0] = 0x05060708;
+    key.sp = 1024;
+    key.dp = 80;
+    key.proto = IPPROTO_TCP;
+    struct timespec ts = { 1, 0 };
+
+    Flow *f = FlowGetFromFlowKey(&key, &ts, 1);
+    FAIL_IF_NULL(f);
+    FAIL_IF_NOT(FlowHashGetEvictClass(f) == FLOW_EVICT_CLASS_TCP_NEW);
+    FlowUpdateState(f, FLOW_STATE_ESTABLISHED);
+    FAIL_IF_NOT(FlowHashGetEvictClass(f) == FLOW_EVICT_CLASS_TCP_EST);
+    FlowUpdateState(f, FLOW_STATE_CLOSED);
+    FAIL_IF_NOT(FlowHashGetEvictClass(f) == FLOW_EVICT_CLASS_TCP_NEW);
+    FlowUpdateState(f, FLOW_STATE_LOCAL_BYPASSED);
+    FAIL_IF_NOT(FlowHashGetEvictClass(f) == FLOW_EVICT_CLASS_BYPASSED);
+    FLOWLOCK_UNLOCK(f);
+
+    key.proto = IPPROTO_UDP;
+    f = FlowGetFromFlowKey(&key, &ts, 2);
+    FAIL_IF_NULL(f);
+    FAIL_IF_NOT(FlowHashGetEvictClass(f) == FLOW_EVICT_CLASS_OTHER);
+    FlowUpdateState(f, FLOW_STATE_ESTABLISHED);
+    FAIL_IF_NOT(FlowHashGetEvictClass(f) == FLOW_EVICT_CLASS_OTHER);
+    FLOWLOCK_UNLOCK(f);
+
+    FlowShutdown();
+    PASS;
+}
+
 #endif /* UNITTESTS */
 
 /**
@@ -1396,6 +1436,8 @@ void FlowRegisterTests (void)
                    FlowTest08);
     UtRegisterTest("FlowTest09 -- Test flow Allocations when it reach memcap",
                    FlowTest09);
+    UtRegisterTest("FlowTest10 -- Test flow eviction class updates",
+                   FlowTest10);
 
     RegisterFlowStorageTests();
 #endif /* UNITTESTS */
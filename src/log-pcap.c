@@ -936,7 +936,7 @@ static TmEcode PcapLogDataInit(ThreadVars *t, const void *initdata, void **data)
 
     struct timeval ts;
     memset(&ts, 0x00, sizeof(struct timeval));
-    TimeGet(&ts);
+    TimeGetCoarse(&ts);
     struct tm local_tm;
     struct tm *tms = SCLocalTime(ts.tv_sec, &local_tm);
     td->pcap_log->prev_day = tms->tm_mday;
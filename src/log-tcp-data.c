@@ -45,6 +45,7 @@
 #include "util-buffer.h"
 
 #include "util-logopenfile.h"
+#include "util-misc.h"
 #include "util-time.h"
 
 #define DEFAULT_LOG_FILENAME "tcp-data.log"
@@ -57,7 +58,8 @@ TmEcode LogTcpDataLogThreadInit(ThreadVars *, const void *, void **);
 TmEcode LogTcpDataLogThreadDeinit(ThreadVars *, void *);
 static void LogTcpDataLogDeInitCtx(OutputCtx *);
 
-int LogTcpDataLogger(ThreadVars *tv, void *thread_data, const Flow *f, const uint8_t *data, uint32_t data_len, uint64_t tx_id, uint8_t flags);
+int LogTcpDataLogger(ThreadVars *tv, void *thread_data, const Flow *f, const uint8_t *data,
+        uint32_t data_len, uint64_t offset, uint64_t tx_id, uint8_t flags);
 
 void LogTcpDataLogRegister (void) {
     OutputRegisterStreamingModule(LOGGER_TCP_DATA, MODULE_NAME, "tcp-data",
@@ -74,14 +76,31 @@ typedef struct LogTcpDataFileCtx_ {
     const char *log_dir;
     int file;
     int dir;
+    uint64_t depth;     /**< bytes to log per stream or body, 0 for all */
 } LogTcpDataFileCtx;
 
 typedef struct LogTcpDataLogThread_ {
     LogTcpDataFileCtx *tcpdatalog_ctx;
     /** LogFileCtx has the pointer to the file and a mutex to allow multithreading */
     MemBuffer *buffer;
+
+    /** dir mode: file of the last logged stream, kept open as consecutive
+     *  chunks are usually for the same stream */
+    FILE *fp;
+    const Flow *fp_flow;
+    uint64_t fp_tx_id;
+    uint8_t fp_dir;
 } LogTcpDataLogThread;
 
+static void LogTcpDataLoggerDirClose(LogTcpDataLogThread *aft)
+{
+    if (aft->fp != NULL) {
+        fclose(aft->fp);
+        aft->fp = NULL;
+    }
+    aft->fp_flow = NULL;
+}
+
 static int LogTcpDataLoggerDir(ThreadVars *tv, void *thread_data, const Flow *f,
         const uint8_t *data, uint32_t data_len, uint64_t tx_id, uint8_t flags)
 {
@@ -89,11 +108,23 @@ static int LogTcpDataLoggerDir(ThreadVars *tv, void *thread_data, const Flow *f,
     LogTcpDataLogThread *aft = thread_data;
     LogTcpDataFileCtx *td = aft->tcpdatalog_ctx;
     const char *mode = "a";
+    const uint8_t dir = flags & (OUTPUT_STREAMING_FLAG_TOSERVER|OUTPUT_STREAMING_FLAG_TOCLIENT);
 
     if (flags & OUTPUT_STREAMING_FLAG_OPEN)
         mode = "w";
 
+    /* reuse the open file if this is the next chunk of the same stream */
+    if (aft->fp != NULL && (flags & OUTPUT_STREAMING_FLAG_OPEN) == 0 &&
+            aft->fp_flow == f && aft->fp_dir == dir && aft->fp_tx_id == tx_id) {
+        if (data && data_len) {
+            fwrite(data, data_len, 1, aft->fp);
+        }
+        goto end;
+    }
+
     if (data && data_len) {
+        LogTcpDataLoggerDirClose(aft);
+
         char srcip[46] = "", dstip[46] = "";
         if (FLOW_IS_IPV4(f)) {
             PrintInet(AF_INET, (const void *)&f->src.addr_data32[0], srcip, sizeof(srcip));
@@ -122,7 +153,14 @@ static int LogTcpDataLoggerDir(ThreadVars *tv, void *thread_data, const Flow *f,
         // PrintRawDataFp(stdout, (uint8_t *)data, data_len);
         fwrite(data, data_len, 1, fp);
 
-        fclose(fp);
+        aft->fp = fp;
+        aft->fp_flow = f;
+        aft->fp_dir = dir;
+        aft->fp_tx_id = tx_id;
+    }
+end:
+    if (flags & OUTPUT_STREAMING_FLAG_CLOSE) {
+        LogTcpDataLoggerDirClose(aft);
     }
     SCReturnInt(TM_ECODE_OK);
 }
@@ -165,12 +203,22 @@ static int LogTcpDataLoggerFile(ThreadVars *tv, void *thread_data, const Flow *f
 }
 
 int LogTcpDataLogger(ThreadVars *tv, void *thread_data, const Flow *f,
-        const uint8_t *data, uint32_t data_len, uint64_t tx_id, uint8_t flags)
+        const uint8_t *data, uint32_t data_len, uint64_t offset, uint64_t tx_id, uint8_t flags)
 {
     SCEnter();
     LogTcpDataLogThread *aft = thread_data;
     LogTcpDataFileCtx *td = aft->tcpdatalog_ctx;
 
+    /* only log the first 'depth' bytes */
+    if (td->depth > 0 && data != NULL) {
+        if (offset >= td->depth) {
+            data = NULL;
+            data_len = 0;
+        } else if (offset + data_len > td->depth) {
+            data_len = (uint32_t)(td->depth - offset);
+        }
+    }
+
     if (td->dir == 1)
         LogTcpDataLoggerDir(tv, thread_data, f, data, data_len, tx_id, flags);
     if (td->file == 1)
@@ -213,6 +261,7 @@ TmEcode LogTcpDataLogThreadDeinit(ThreadVars *t, void *data)
         return TM_ECODE_OK;
     }
 
+    LogTcpDataLoggerDirClose(aft);
     MemBufferFree(aft->buffer);
     /* clear memory */
     memset(aft, 0, sizeof(LogTcpDataLogThread));
@@ -272,6 +321,14 @@ OutputInitResult LogTcpDataLogInitCtx(ConfNode *conf)
             tcpdatalog_ctx->file = 1;
             tcpdatalog_ctx->dir = 1;
         }
+
+        const char *depth = ConfNodeLookupChildValue(conf, "depth");
+        if (depth != NULL && ParseSizeStringU64(depth, &tcpdatalog_ctx->depth) < 0) {
+            SCLogError(SC_ERR_INVALID_ARGUMENT, "invalid depth \"%s\"", depth);
+            LogFileFreeCtx(file_ctx);
+            SCFree(tcpdatalog_ctx);
+            return result;
+        }
     } else {
         tcpdatalog_ctx->file = 1;
         tcpdatalog_ctx->dir = 0;
@@ -26,6 +26,7 @@
 #include "suricata-common.h"
 #include "tm-modules.h"
 #include "output-flow.h"
+#include "output-limit.h"
 #include "util-profiling.h"
 #include "util-validate.h"
 
@@ -111,9 +112,11 @@ TmEcode OutputFlowLog(ThreadVars *tv, void *thread_data, Flow *f)
         DEBUG_VALIDATE_BUG_ON(logger->LogFunc == NULL);
 
         SCLogDebug("logger %p", logger);
-        //PACKET_PROFILING_LOGGER_START(p, logger->module_id);
-        logger->LogFunc(tv, store->thread_data, f);
-        //PACKET_PROFILING_LOGGER_END(p, logger->module_id);
+        if (OutputLimitPass(logger->output_ctx, f, NULL)) {
+            //PACKET_PROFILING_LOGGER_START(p, logger->module_id);
+            logger->LogFunc(tv, store->thread_data, f);
+            //PACKET_PROFILING_LOGGER_END(p, logger->module_id);
+        }
 
         logger = logger->next;
         store = store->next;
@@ -942,6 +942,10 @@ static void JsonAlertLogSetupMetadata(AlertJsonOutputCtx *json_output_ctx,
                 warn_no_meta = true;
             }
         }
+        if (flags & JSON_BODY_LOGGING) {
+            AppLayerHtpEnableRequestBodyCallback();
+            AppLayerHtpEnableResponseBodyCallback();
+        }
 
         json_output_ctx->payload_buffer_size = payload_buffer_size;
     }
@@ -950,6 +954,11 @@ static void JsonAlertLogSetupMetadata(AlertJsonOutputCtx *json_output_ctx,
         DetectEngineSetParseMetadata();
     }
 
+    /* the dnp3 app-layer metadata includes the object points */
+    if (flags & LOG_JSON_APP_LAYER) {
+        DNP3EnablePointDecoding();
+    }
+
     json_output_ctx->flags |= flags;
 }
 
@@ -1020,3 +1029,63 @@ void JsonAlertLogRegister (void)
         JsonAlertLogCondition, JsonAlertLogThreadInit, JsonAlertLogThreadDeinit,
         NULL);
 }
+
+#ifdef UNITTESTS
+static ConfNode *JsonAlertTestConfNode(ConfNode *parent, const char *name,
+        const char *val)
+{
+    ConfNode *node = ConfNodeNew();
+    if (node == NULL)
+        return NULL;
+    node->name = SCStrdup(name);
+    if (val != NULL)
+        node->val = SCStrdup(val);
+    if (parent != NULL)
+        TAILQ_INSERT_TAIL(&parent->head, node, next);
+    return node;
+}
+
+/**
+ * \test Test that dnp3 point decoding is enabled when app-layer metadata
+ *       is logged with the alerts, and only then.
+ */
+static int JsonAlertLogTest01(void)
+{
+    const bool decode_points = DNP3PointDecodingEnabled();
+    AlertJsonOutputCtx json_output_ctx;
+
+    ConfNode *conf = JsonAlertTestConfNode(NULL, "alert", NULL);
+    FAIL_IF_NULL(conf);
+    ConfNode *metadata = JsonAlertTestConfNode(conf, "metadata", NULL);
+    FAIL_IF_NULL(metadata);
+    ConfNode *app_layer = JsonAlertTestConfNode(metadata, "app-layer", "no");
+    FAIL_IF_NULL(app_layer);
+    ConfNode *rule = JsonAlertTestConfNode(metadata, "rule", NULL);
+    FAIL_IF_NULL(rule);
+    FAIL_IF_NULL(JsonAlertTestConfNode(rule, "metadata", "no"));
+
+    DNP3SetPointDecoding(false);
+    memset(&json_output_ctx, 0, sizeof(json_output_ctx));
+    JsonAlertLogSetupMetadata(&json_output_ctx, conf);
+    FAIL_IF(json_output_ctx.flags & LOG_JSON_APP_LAYER);
+    FAIL_IF(DNP3PointDecodingEnabled());
+
+    SCFree(app_layer->val);
+    app_layer->val = SCStrdup("yes");
+    memset(&json_output_ctx, 0, sizeof(json_output_ctx));
+    JsonAlertLogSetupMetadata(&json_output_ctx, conf);
+    FAIL_IF_NOT(json_output_ctx.flags & LOG_JSON_APP_LAYER);
+    FAIL_IF_NOT(DNP3PointDecodingEnabled());
+
+    ConfNodeFree(conf);
+    DNP3SetPointDecoding(decode_points);
+    PASS;
+}
+#endif /* UNITTESTS */
+
+void JsonAlertLogRegisterTests(void)
+{
+#ifdef UNITTESTS
+    UtRegisterTest("JsonAlertLogTest01", JsonAlertLogTest01);
+#endif /* UNITTESTS */
+}
@@ -49,6 +49,7 @@
 
 #include "output-json.h"
 #include "output-json-dns.h"
+#include "output-json-tx-summary.h"
 #include "rust.h"
 
 /* we can do query logging as well, but it's disabled for now as the
@@ -261,6 +262,7 @@ typedef struct LogDnsFileCtx_ {
     uint64_t flags; /** Store mode */
     DnsVersion version;
     OutputJsonCommonSettings cfg;
+    OutputTxSummaryConfig aggregate;
 } LogDnsFileCtx;
 
 typedef struct LogDnsLogThread_ {
@@ -304,6 +306,23 @@ JsonBuilder *JsonDNSLogAnswer(void *txptr, uint64_t tx_id)
     }
 }
 
+/** \internal
+ *  \brief fold the queries of the tx into the flow's summary */
+static void JsonDnsSummaryAddQueries(OutputTxSummary *s, void *txptr)
+{
+    s->cnt++;
+    for (uint16_t i = 0; i < UINT16_MAX; i++) {
+        const uint8_t *name = NULL;
+        uint32_t name_len = 0;
+        uint16_t rrtype = 0;
+        if (!rs_dns_tx_get_query_name(txptr, i, &name, &name_len))
+            break;
+        OutputTxSummaryAddValue(s, name, name_len);
+        if (rs_dns_tx_get_query_rrtype(txptr, i, &rrtype))
+            OutputTxSummaryAddKey(s, 0, rrtype);
+    }
+}
+
 static int JsonDnsLoggerToServer(ThreadVars *tv, void *thread_data,
     const Packet *p, Flow *f, void *alstate, void *txptr, uint64_t tx_id)
 {
@@ -316,6 +335,15 @@ static int JsonDnsLoggerToServer(ThreadVars *tv, void *thread_data,
         return TM_ECODE_OK;
     }
 
+    if (dnslog_ctx->aggregate.enabled) {
+        OutputTxSummary *s = OutputTxSummaryGet(f, &dnslog_ctx->aggregate,
+                &p->ts, td->file_ctx, &td->buffer);
+        if (s != NULL) {
+            JsonDnsSummaryAddQueries(s, txptr);
+            SCReturnInt(TM_ECODE_OK);
+        }
+    }
+
     for (uint16_t i = 0; i < 0xffff; i++) {
         JsonBuilder *jb = CreateEveHeader(p, LOG_DIR_FLOW, "dns", NULL);
         if (unlikely(jb == NULL)) {
@@ -350,6 +378,18 @@ static int JsonDnsLoggerToClient(ThreadVars *tv, void *thread_data,
         return TM_ECODE_OK;
     }
 
+    if (dnslog_ctx->aggregate.enabled) {
+        OutputTxSummary *s = OutputTxSummaryGet(f, &dnslog_ctx->aggregate,
+                &p->ts, td->file_ctx, &td->buffer);
+        if (s != NULL) {
+            /* only count txs that have a response */
+            if (rs_dns_do_log_answer(txptr, LOG_ALL_RRTYPES)) {
+                OutputTxSummaryAddKey(s, 1, rs_dns_tx_get_response_flags(txptr));
+            }
+            SCReturnInt(TM_ECODE_OK);
+        }
+    }
+
     if (td->dnslog_ctx->version == DNS_VERSION_2) {
         if (rs_dns_do_log_answer(txptr, td->dnslog_ctx->flags)) {
             JsonBuilder *jb = CreateEveHeader(p, LOG_DIR_FLOW, "dns", NULL);
@@ -630,6 +670,8 @@ static OutputInitResult JsonDnsLogInitCtxSub(ConfNode *conf, OutputCtx *parent_c
 
     dnslog_ctx->version = version;
     JsonDnsLogInitFilters(dnslog_ctx, conf);
+    OutputTxSummaryParseConfig(conf, &tx_summary_fields_dns, &ojc->cfg,
+            &dnslog_ctx->aggregate);
 
     SCLogDebug("DNS log sub-module initialized");
 
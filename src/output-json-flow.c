@@ -50,6 +50,7 @@
 #include "stream-tcp.h"
 #include "stream-tcp-private.h"
 #include "flow-storage.h"
+#include "flow-cpu-cost.h"
 
 typedef struct LogJsonFileCtx_ {
     LogFileCtx *file_ctx;
@@ -64,7 +65,7 @@ typedef struct JsonFlowLogThread_ {
     MemBuffer *buffer;
 } JsonFlowLogThread;
 
-static JsonBuilder *CreateEveHeaderFromFlow(const Flow *f)
+JsonBuilder *CreateEveHeaderFromFlow(const Flow *f, const char *event_type)
 {
     char timebuf[64];
     char srcip[46] = {0}, dstip[46] = {0};
@@ -77,7 +78,7 @@ static JsonBuilder *CreateEveHeaderFromFlow(const Flow *f)
 
     struct timeval tv;
     memset(&tv, 0x00, sizeof(tv));
-    TimeGet(&tv);
+    TimeGetCoarse(&tv);
 
     CreateIsoTimeString(&tv, timebuf, sizeof(timebuf));
 
@@ -119,7 +120,7 @@ static JsonBuilder *CreateEveHeaderFromFlow(const Flow *f)
         jb_set_string(jb, "in_iface", f->livedev->dev);
     }
 
-    JB_SET_STRING(jb, "event_type", "flow");
+    jb_set_string(jb, "event_type", event_type);
 
     /* vlan */
     if (f->vlan_idx > 0) {
@@ -285,6 +286,18 @@ static void EveFlowLogJSON(JsonFlowLogThread *aft, JsonBuilder *jb, Flow *f)
     if (f->flags & FLOW_WRONG_THREAD)
         JB_SET_TRUE(jb, "wrong_thread");
 
+    if (g_flow_cpu_cost_id >= 0) {
+        const FlowCpuCost *cost = FlowGetStorageById(f, g_flow_cpu_cost_id);
+        if (cost != NULL) {
+            jb_open_object(jb, "cpu");
+            jb_set_uint(jb, "stream", cost->stream);
+            jb_set_uint(jb, "app_layer", cost->app_layer);
+            jb_set_uint(jb, "detect", cost->detect);
+            jb_set_uint(jb, "total", FlowCpuCostTotal(cost));
+            jb_close(jb);
+        }
+    }
+
     /* Close flow. */
     jb_close(jb);
 
@@ -330,7 +343,7 @@ static int JsonFlowLogger(ThreadVars *tv, void *thread_data, Flow *f)
     /* reset */
     MemBufferReset(jhl->buffer);
 
-    JsonBuilder *jb = CreateEveHeaderFromFlow(f);
+    JsonBuilder *jb = CreateEveHeaderFromFlow(f, "flow");
     if (unlikely(jb == NULL)) {
         SCReturnInt(TM_ECODE_OK);
     }
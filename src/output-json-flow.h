@@ -27,5 +27,6 @@
 void JsonFlowLogRegister(void);
 void EveAddFlow(Flow *f, JsonBuilder *js);
 void EveAddAppProto(Flow *f, JsonBuilder *js);
+JsonBuilder *CreateEveHeaderFromFlow(const Flow *f, const char *event_type);
 
 #endif /* __OUTPUT_JSON_FLOW_H__ */
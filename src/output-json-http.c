@@ -53,6 +53,7 @@
 #include "output-json.h"
 #include "output-json-alert.h"
 #include "output-json-http.h"
+#include "output-json-tx-summary.h"
 #include "util-byte.h"
 
 typedef struct LogHttpFileCtx_ {
@@ -62,6 +63,7 @@ typedef struct LogHttpFileCtx_ {
     HttpXFFCfg *xff_cfg;
     HttpXFFCfg *parent_xff_cfg;
     OutputJsonCommonSettings cfg;
+    OutputTxSummaryConfig aggregate;
 } LogHttpFileCtx;
 
 typedef struct JsonHttpLogThread_ {
@@ -477,6 +479,19 @@ static void EveHttpLogJSON(JsonHttpLogThread *aft, JsonBuilder *js, htp_tx_t *tx
     jb_close(js);
 }
 
+/** \internal
+ *  \brief fold the tx into the flow's summary instead of logging it */
+static void JsonHttpSummaryAdd(OutputTxSummary *s, htp_tx_t *tx)
+{
+    s->cnt++;
+    if (tx->request_uri != NULL) {
+        OutputTxSummaryAddValue(s, bstr_ptr(tx->request_uri), bstr_len(tx->request_uri));
+    }
+    if (tx->response_status_number > 0) {
+        OutputTxSummaryAddKey(s, 0, (uint32_t)tx->response_status_number);
+    }
+}
+
 static int JsonHttpLogger(ThreadVars *tv, void *thread_data, const Packet *p, Flow *f, void *alstate, void *txptr, uint64_t tx_id)
 {
     SCEnter();
@@ -484,6 +499,15 @@ static int JsonHttpLogger(ThreadVars *tv, void *thread_data, const Packet *p, Fl
     htp_tx_t *tx = txptr;
     JsonHttpLogThread *jhl = (JsonHttpLogThread *)thread_data;
 
+    if (jhl->httplog_ctx->aggregate.enabled) {
+        OutputTxSummary *s = OutputTxSummaryGet(f, &jhl->httplog_ctx->aggregate,
+                &p->ts, jhl->file_ctx, &jhl->buffer);
+        if (s != NULL) {
+            JsonHttpSummaryAdd(s, tx);
+            SCReturnInt(TM_ECODE_OK);
+        }
+    }
+
     JsonBuilder *js = CreateEveHeaderWithTxId(p, LOG_DIR_FLOW, "http", NULL, tx_id);
     if (unlikely(js == NULL))
         return TM_ECODE_OK;
@@ -616,6 +640,9 @@ static OutputInitResult OutputHttpLogInitSub(ConfNode *conf, OutputCtx *parent_c
         }
     }
 
+    OutputTxSummaryParseConfig(conf, &tx_summary_fields_http, &ojc->cfg,
+            &http_ctx->aggregate);
+
     if (conf != NULL && ConfNodeLookupChild(conf, "xff") != NULL) {
         http_ctx->xff_cfg = SCCalloc(1, sizeof(HttpXFFCfg));
         if (http_ctx->xff_cfg != NULL) {
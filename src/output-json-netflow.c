@@ -74,7 +74,7 @@ static JsonBuilder *CreateEveHeaderFromNetFlow(const Flow *f, int dir)
 
     struct timeval tv;
     memset(&tv, 0x00, sizeof(tv));
-    TimeGet(&tv);
+    TimeGetCoarse(&tv);
 
     CreateIsoTimeString(&tv, timebuf, sizeof(timebuf));
 
@@ -0,0 +1,560 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Aggregated transaction logging.
+ *
+ * A tx logger with 'aggregate' enabled doesn't log its transactions, but
+ * folds them into a summary kept in flow storage: a tx count, the first
+ * unique values (e.g. urls) with their counts, an estimate of the number
+ * of unique values and small histograms (e.g. status codes). The summary
+ * is logged by the flow logger registered here when the flow ends, and by
+ * the tx logger when the configured interval has passed.
+ */
+
+#include "suricata-common.h"
+#include "conf.h"
+#include "flow.h"
+#include "flow-storage.h"
+#include "output.h"
+#include "output-json.h"
+#include "output-json-flow.h"
+#include "output-json-tx-summary.h"
+#include "util-debug.h"
+#include "util-hash-lookup3.h"
+#include "util-time.h"
+#include "util-unittest.h"
+#include "util-validate.h"
+
+#include <math.h>
+
+static int g_tx_summary_id = -1;
+
+const OutputTxSummaryFields tx_summary_fields_http = {
+    .name = "http_summary",
+    .values = "urls",
+    .hist = { "status", NULL },
+};
+
+const OutputTxSummaryFields tx_summary_fields_dns = {
+    .name = "dns_summary",
+    .values = "rrnames",
+    .hist = { "rrtype", "rcode" },
+};
+
+typedef struct JsonTxSummaryLogCtx_ {
+    LogFileCtx *file_ctx;
+    OutputTxSummaryConfig cfg;
+} JsonTxSummaryLogCtx;
+
+typedef struct JsonTxSummaryLogThread_ {
+    JsonTxSummaryLogCtx *ctx;
+    LogFileCtx *file_ctx;
+    MemBuffer *buffer;
+} JsonTxSummaryLogThread;
+
+static void OutputTxSummaryReset(OutputTxSummary *s)
+{
+    for (uint16_t i = 0; i < s->values_cnt; i++) {
+        SCFree(s->values[i].data);
+    }
+    memset(s->values, 0, s->values_max * sizeof(OutputTxSummaryValue));
+    s->values_cnt = 0;
+    s->values_other = 0;
+    s->cnt = 0;
+    memset(&s->first, 0, sizeof(s->first));
+    memset(&s->last, 0, sizeof(s->last));
+    memset(s->hist, 0, sizeof(s->hist));
+    memset(s->sketch, 0, sizeof(s->sketch));
+}
+
+static void OutputTxSummaryFree(void *x)
+{
+    OutputTxSummary *s = x;
+    if (s == NULL)
+        return;
+    OutputTxSummaryReset(s);
+    SCFree(s->values);
+    SCFree(s);
+}
+
+static OutputTxSummary *OutputTxSummaryAlloc(const OutputTxSummaryConfig *cfg)
+{
+    OutputTxSummary *s = SCCalloc(1, sizeof(*s));
+    if (unlikely(s == NULL))
+        return NULL;
+    s->values = SCCalloc(cfg->max_unique, sizeof(OutputTxSummaryValue));
+    if (unlikely(s->values == NULL)) {
+        SCFree(s);
+        return NULL;
+    }
+    s->values_max = cfg->max_unique;
+    s->fields = cfg->fields;
+    return s;
+}
+
+/** \internal
+ *  \brief check if any eve-log tx logger has aggregation enabled */
+static bool OutputTxSummaryConfigured(void)
+{
+    ConfNode *outputs = ConfGetNode("outputs");
+    if (outputs == NULL)
+        return false;
+
+    ConfNode *output;
+    TAILQ_FOREACH(output, &outputs->head, next) {
+        if (output->val == NULL || strcmp(output->val, "eve-log") != 0)
+            continue;
+        ConfNode *eve = ConfNodeLookupChild(output, output->val);
+        if (eve == NULL)
+            continue;
+        ConfNode *types = ConfNodeLookupChild(eve, "types");
+        if (types == NULL)
+            continue;
+
+        ConfNode *type;
+        TAILQ_FOREACH(type, &types->head, next) {
+            ConfNode *conf = ConfNodeLookupChild(type, type->val);
+            if (conf == NULL)
+                continue;
+            ConfNode *agg = ConfNodeLookupChild(conf, "aggregate");
+            if (agg != NULL && ConfNodeChildValueIsTrue(agg, "enabled"))
+                return true;
+        }
+    }
+    return false;
+}
+
+/** \brief register the flow storage if any logger aggregates
+ *
+ *  Needs to be called before the storage API is finalized.
+ */
+void OutputTxSummaryRegister(void)
+{
+    if (!OutputTxSummaryConfigured())
+        return;
+
+    g_tx_summary_id = FlowStorageRegister("tx_summary", sizeof(void *),
+            NULL, OutputTxSummaryFree);
+    if (g_tx_summary_id < 0) {
+        SCLogError(SC_ERR_FLOW_INIT, "failed to register flow storage for "
+                "aggregated tx logging");
+    }
+}
+
+/** \brief parse the 'aggregate' settings of a tx logger
+ *
+ *  \param conf the logger's config node, may be NULL
+ */
+void OutputTxSummaryParseConfig(ConfNode *conf, const OutputTxSummaryFields *fields,
+        const OutputJsonCommonSettings *common, OutputTxSummaryConfig *cfg)
+{
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->fields = fields;
+    cfg->common = *common;
+    cfg->max_unique = TX_SUMMARY_UNIQUE_DEFAULT;
+
+    ConfNode *agg = conf ? ConfNodeLookupChild(conf, "aggregate") : NULL;
+    if (agg == NULL || !ConfNodeChildValueIsTrue(agg, "enabled"))
+        return;
+
+    if (g_tx_summary_id < 0) {
+        SCLogWarning(SC_ERR_INVALID_ARGUMENT, "%s: aggregation not "
+                "available, logging transactions", fields->name);
+        return;
+    }
+
+    intmax_t val = 0;
+    if (ConfGetChildValueInt(agg, "interval", &val)) {
+        if (val < 0 || val > UINT32_MAX) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "%s: invalid aggregate "
+                    "interval %"PRIdMAX, fields->name, val);
+        }
+        cfg->interval = (uint32_t)val;
+    }
+    if (ConfGetChildValueInt(agg, "max-unique", &val)) {
+        if (val < 0 || val > TX_SUMMARY_UNIQUE_MAX) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "%s: invalid aggregate "
+                    "max-unique %"PRIdMAX", max is %d", fields->name, val,
+                    TX_SUMMARY_UNIQUE_MAX);
+        }
+        cfg->max_unique = (uint16_t)val;
+    }
+    cfg->enabled = true;
+}
+
+void OutputTxSummaryAddKey(OutputTxSummary *s, const uint8_t hist, const uint32_t key)
+{
+    DEBUG_VALIDATE_BUG_ON(hist >= TX_SUMMARY_HIST_MAX);
+    OutputTxSummaryHist *h = &s->hist[hist];
+
+    for (uint32_t i = 0; i < h->used; i++) {
+        if (h->key[i] == key) {
+            h->cnt[i]++;
+            return;
+        }
+    }
+    if (h->used < TX_SUMMARY_HIST_SIZE) {
+        h->key[h->used] = key;
+        h->cnt[h->used] = 1;
+        h->used++;
+    } else {
+        h->other++;
+    }
+}
+
+void OutputTxSummaryAddValue(OutputTxSummary *s, const uint8_t *data, uint32_t len)
+{
+    if (len > TX_SUMMARY_VALUE_MAXLEN)
+        len = TX_SUMMARY_VALUE_MAXLEN;
+
+    const uint32_t hash = hashlittle_safe(data, len, 0);
+    const uint32_t bit = hash & (TX_SUMMARY_SKETCH_BITS - 1);
+    s->sketch[bit / 8] |= BIT_U8(bit % 8);
+
+    for (uint16_t i = 0; i < s->values_cnt; i++) {
+        OutputTxSummaryValue *v = &s->values[i];
+        if (v->hash == hash && v->len == len && memcmp(v->data, data, len) == 0) {
+            v->cnt++;
+            return;
+        }
+    }
+    if (s->values_cnt < s->values_max) {
+        OutputTxSummaryValue *v = &s->values[s->values_cnt];
+        v->data = SCMalloc(len ? len : 1);
+        if (likely(v->data != NULL)) {
+            memcpy(v->data, data, len);
+            v->len = (uint16_t)len;
+            v->hash = hash;
+            v->cnt = 1;
+            s->values_cnt++;
+            return;
+        }
+    }
+    s->values_other++;
+}
+
+/** \internal
+ *  \brief number of unique values: exact while they all fit in the list,
+ *         a linear counting estimate after that */
+static uint32_t OutputTxSummaryUniqueCount(const OutputTxSummary *s)
+{
+    if (s->values_other == 0)
+        return s->values_cnt;
+
+    uint32_t zero = 0;
+    for (uint32_t i = 0; i < sizeof(s->sketch); i++) {
+        zero += 8 - __builtin_popcount(s->sketch[i]);
+    }
+    /* saturated, the estimate is a lower bound */
+    if (zero == 0)
+        zero = 1;
+
+    const double m = TX_SUMMARY_SKETCH_BITS;
+    uint32_t est = (uint32_t)(m * log(m / (double)zero) + 0.5);
+    return MAX(est, (uint32_t)s->values_cnt + 1);
+}
+
+/** \internal
+ *  \brief log the summary and reset it */
+static void OutputTxSummaryLog(const Flow *f, OutputTxSummary *s,
+        const OutputTxSummaryConfig *cfg, LogFileCtx *file_ctx, MemBuffer **buffer)
+{
+    const OutputTxSummaryFields *fields = s->fields;
+    char timebuf[64];
+    char name[64];
+
+    JsonBuilder *jb = CreateEveHeaderFromFlow(f, fields->name);
+    if (unlikely(jb == NULL))
+        goto end;
+    EveAddCommonOptions(&cfg->common, NULL, f, jb);
+
+    jb_open_object(jb, fields->name);
+    CreateIsoTimeString(&s->first, timebuf, sizeof(timebuf));
+    jb_set_string(jb, "start", timebuf);
+    CreateIsoTimeString(&s->last, timebuf, sizeof(timebuf));
+    jb_set_string(jb, "end", timebuf);
+    jb_set_uint(jb, "count", s->cnt);
+
+    if (s->values_cnt > 0) {
+        jb_open_array(jb, fields->values);
+        for (uint16_t i = 0; i < s->values_cnt; i++) {
+            jb_start_object(jb);
+            jb_set_string_from_bytes(jb, "value", s->values[i].data, s->values[i].len);
+            jb_set_uint(jb, "count", s->values[i].cnt);
+            jb_close(jb);
+        }
+        jb_close(jb);
+    }
+    snprintf(name, sizeof(name), "%s_unique", fields->values);
+    jb_set_uint(jb, name, OutputTxSummaryUniqueCount(s));
+    if (s->values_other > 0) {
+        snprintf(name, sizeof(name), "%s_other", fields->values);
+        jb_set_uint(jb, name, s->values_other);
+    }
+
+    for (int h = 0; h < TX_SUMMARY_HIST_MAX; h++) {
+        const OutputTxSummaryHist *hist = &s->hist[h];
+        if (fields->hist[h] == NULL || (hist->used == 0 && hist->other == 0))
+            continue;
+        jb_open_object(jb, fields->hist[h]);
+        for (uint32_t i = 0; i < hist->used; i++) {
+            snprintf(name, sizeof(name), "%"PRIu32, hist->key[i]);
+            jb_set_uint(jb, name, hist->cnt[i]);
+        }
+        if (hist->other > 0)
+            jb_set_uint(jb, "other", hist->other);
+        jb_close(jb);
+    }
+    jb_close(jb);
+
+    MemBufferReset(*buffer);
+    OutputJsonBuilderBuffer(jb, file_ctx, buffer);
+    jb_free(jb);
+end:
+    OutputTxSummaryReset(s);
+}
+
+/** \brief get the summary to fold a transaction into
+ *
+ *  If the interval of the current summary has passed, it's logged first
+ *  using the tx logger's output.
+ *
+ *  \retval s summary or NULL if the tx should be logged normally
+ */
+OutputTxSummary *OutputTxSummaryGet(Flow *f, const OutputTxSummaryConfig *cfg,
+        const struct timeval *ts, LogFileCtx *file_ctx, MemBuffer **buffer)
+{
+    if (g_tx_summary_id < 0)
+        return NULL;
+
+    OutputTxSummary *s = FlowGetStorageById(f, g_tx_summary_id);
+    if (s == NULL) {
+        s = OutputTxSummaryAlloc(cfg);
+        if (s == NULL)
+            return NULL;
+        FlowSetStorageById(f, g_tx_summary_id, s);
+    } else if (s->fields != cfg->fields) {
+        /* app-layer protocol change, keep the first protocol's summary */
+        return NULL;
+    } else if (cfg->interval > 0 && timerisset(&s->first) &&
+            ts->tv_sec >= s->first.tv_sec + (time_t)cfg->interval) {
+        OutputTxSummaryLog(f, s, cfg, file_ctx, buffer);
+    }
+
+    if (!timerisset(&s->first))
+        s->first = *ts;
+    s->last = *ts;
+    return s;
+}
+
+static int JsonTxSummaryLogger(ThreadVars *tv, void *thread_data, Flow *f)
+{
+    JsonTxSummaryLogThread *aft = (JsonTxSummaryLogThread *)thread_data;
+
+    if (g_tx_summary_id < 0)
+        return TM_ECODE_OK;
+
+    OutputTxSummary *s = FlowGetStorageById(f, g_tx_summary_id);
+    if (s == NULL || s->fields != aft->ctx->cfg.fields || !timerisset(&s->first))
+        return TM_ECODE_OK;
+
+    OutputTxSummaryLog(f, s, &aft->ctx->cfg, aft->file_ctx, &aft->buffer);
+    return TM_ECODE_OK;
+}
+
+static void JsonTxSummaryLogDeinitSub(OutputCtx *output_ctx)
+{
+    SCFree(output_ctx->data);
+    SCFree(output_ctx);
+}
+
+static OutputInitResult JsonTxSummaryLogInitSub(ConfNode *conf, OutputCtx *parent_ctx,
+        const OutputTxSummaryFields *fields)
+{
+    OutputInitResult result = { NULL, false };
+    OutputJsonCtx *ojc = parent_ctx->data;
+
+    OutputTxSummaryConfig cfg;
+    OutputTxSummaryParseConfig(conf, fields, &ojc->cfg, &cfg);
+    if (!cfg.enabled)
+        return result;
+    SCLogConfig("%s: aggregating transactions, interval %u, max-unique %u",
+            fields->name, cfg.interval, cfg.max_unique);
+
+    JsonTxSummaryLogCtx *ctx = SCCalloc(1, sizeof(*ctx));
+    if (unlikely(ctx == NULL))
+        return result;
+    OutputCtx *output_ctx = SCCalloc(1, sizeof(OutputCtx));
+    if (unlikely(output_ctx == NULL)) {
+        SCFree(ctx);
+        return result;
+    }
+    ctx->file_ctx = ojc->file_ctx;
+    ctx->cfg = cfg;
+
+    output_ctx->data = ctx;
+    output_ctx->DeInit = JsonTxSummaryLogDeinitSub;
+
+    result.ctx = output_ctx;
+    result.ok = true;
+    return result;
+}
+
+static OutputInitResult JsonHttpSummaryLogInitSub(ConfNode *conf, OutputCtx *parent_ctx)
+{
+    return JsonTxSummaryLogInitSub(conf, parent_ctx, &tx_summary_fields_http);
+}
+
+static OutputInitResult JsonDnsSummaryLogInitSub(ConfNode *conf, OutputCtx *parent_ctx)
+{
+    return JsonTxSummaryLogInitSub(conf, parent_ctx, &tx_summary_fields_dns);
+}
+
+static TmEcode JsonTxSummaryLogThreadInit(ThreadVars *t, const void *initdata, void **data)
+{
+    JsonTxSummaryLogThread *aft = SCCalloc(1, sizeof(JsonTxSummaryLogThread));
+    if (unlikely(aft == NULL))
+        return TM_ECODE_FAILED;
+
+    if (initdata == NULL) {
+        SCLogDebug("Error getting context for EveLogTxSummary. \"initdata\" argument NULL");
+        goto error_exit;
+    }
+
+    aft->ctx = ((OutputCtx *)initdata)->data;
+    aft->buffer = MemBufferCreateNew(JSON_OUTPUT_BUFFER_SIZE);
+    if (aft->buffer == NULL) {
+        goto error_exit;
+    }
+
+    aft->file_ctx = LogFileEnsureExists(aft->ctx->file_ctx, t->id);
+    if (!aft->file_ctx) {
+        goto error_exit;
+    }
+
+    *data = (void *)aft;
+    return TM_ECODE_OK;
+
+error_exit:
+    if (aft->buffer != NULL) {
+        MemBufferFree(aft->buffer);
+    }
+    SCFree(aft);
+    return TM_ECODE_FAILED;
+}
+
+static TmEcode JsonTxSummaryLogThreadDeinit(ThreadVars *t, void *data)
+{
+    JsonTxSummaryLogThread *aft = (JsonTxSummaryLogThread *)data;
+    if (aft == NULL) {
+        return TM_ECODE_OK;
+    }
+
+    MemBufferFree(aft->buffer);
+    memset(aft, 0, sizeof(JsonTxSummaryLogThread));
+    SCFree(aft);
+    return TM_ECODE_OK;
+}
+
+void JsonTxSummaryLogRegister(void)
+{
+    /* flow end loggers for the tx loggers in aggregate mode. They share
+     * the config section of the tx logger they summarize. */
+    OutputRegisterFlowSubModule(LOGGER_JSON_TX_SUMMARY, "eve-log", "JsonHttpSummaryLog",
+        "eve-log.http", JsonHttpSummaryLogInitSub, JsonTxSummaryLogger,
+        JsonTxSummaryLogThreadInit, JsonTxSummaryLogThreadDeinit, NULL);
+    OutputRegisterFlowSubModule(LOGGER_JSON_TX_SUMMARY, "eve-log", "JsonDnsSummaryLog",
+        "eve-log.dns", JsonDnsSummaryLogInitSub, JsonTxSummaryLogger,
+        JsonTxSummaryLogThreadInit, JsonTxSummaryLogThreadDeinit, NULL);
+}
+
+#ifdef UNITTESTS
+static int OutputTxSummaryTest01(void)
+{
+    OutputTxSummaryConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.max_unique = 2;
+    cfg.fields = &tx_summary_fields_http;
+
+    OutputTxSummary *s = OutputTxSummaryAlloc(&cfg);
+    FAIL_IF_NULL(s);
+
+    OutputTxSummaryAddValue(s, (const uint8_t *)"/a", 2);
+    OutputTxSummaryAddValue(s, (const uint8_t *)"/b", 2);
+    OutputTxSummaryAddValue(s, (const uint8_t *)"/a", 2);
+    FAIL_IF_NOT(s->values_cnt == 2);
+    FAIL_IF_NOT(s->values[0].cnt == 2);
+    FAIL_IF_NOT(s->values_other == 0);
+    FAIL_IF_NOT(OutputTxSummaryUniqueCount(s) == 2);
+
+    /* list is full, counted as other and estimated by the sketch */
+    OutputTxSummaryAddValue(s, (const uint8_t *)"/c", 2);
+    FAIL_IF_NOT(s->values_cnt == 2);
+    FAIL_IF_NOT(s->values_other == 1);
+    FAIL_IF_NOT(OutputTxSummaryUniqueCount(s) == 3);
+
+    for (uint32_t i = 0; i < TX_SUMMARY_HIST_SIZE + 2; i++) {
+        OutputTxSummaryAddKey(s, 0, 200 + i);
+    }
+    OutputTxSummaryAddKey(s, 0, 200);
+    FAIL_IF_NOT(s->hist[0].used == TX_SUMMARY_HIST_SIZE);
+    FAIL_IF_NOT(s->hist[0].cnt[0] == 2);
+    FAIL_IF_NOT(s->hist[0].other == 2);
+
+    OutputTxSummaryReset(s);
+    FAIL_IF_NOT(s->values_cnt == 0);
+    FAIL_IF_NOT(s->hist[0].used == 0);
+
+    OutputTxSummaryFree(s);
+    PASS;
+}
+
+/** \test unique estimate stays close for many values */
+static int OutputTxSummaryTest02(void)
+{
+    OutputTxSummaryConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.max_unique = 10;
+    cfg.fields = &tx_summary_fields_dns;
+
+    OutputTxSummary *s = OutputTxSummaryAlloc(&cfg);
+    FAIL_IF_NULL(s);
+
+    for (uint32_t i = 0; i < 500; i++) {
+        char name[32];
+        int len = snprintf(name, sizeof(name), "host%u.example.com", i);
+        OutputTxSummaryAddValue(s, (const uint8_t *)name, len);
+        OutputTxSummaryAddValue(s, (const uint8_t *)name, len);
+    }
+    const uint32_t est = OutputTxSummaryUniqueCount(s);
+    FAIL_IF(est < 450 || est > 550);
+
+    OutputTxSummaryFree(s);
+    PASS;
+}
+#endif /* UNITTESTS */
+
+void OutputTxSummaryRegisterTests(void)
+{
+#ifdef UNITTESTS
+    UtRegisterTest("OutputTxSummaryTest01", OutputTxSummaryTest01);
+    UtRegisterTest("OutputTxSummaryTest02", OutputTxSummaryTest02);
+#endif /* UNITTESTS */
+}
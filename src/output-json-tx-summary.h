@@ -0,0 +1,97 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Aggregated transaction logging: tx loggers in aggregate mode fold their
+ * transactions into a per flow summary that is logged once at flow end or
+ * once per interval.
+ */
+
+#ifndef __OUTPUT_JSON_TX_SUMMARY_H__
+#define __OUTPUT_JSON_TX_SUMMARY_H__
+
+#include "output-json.h"
+
+#define TX_SUMMARY_HIST_MAX         2
+#define TX_SUMMARY_HIST_SIZE        16
+#define TX_SUMMARY_SKETCH_BITS      1024
+#define TX_SUMMARY_VALUE_MAXLEN     256
+#define TX_SUMMARY_UNIQUE_DEFAULT   10
+#define TX_SUMMARY_UNIQUE_MAX       100
+
+/** protocol specific names of the summary record fields */
+typedef struct OutputTxSummaryFields_ {
+    const char *name;                       /**< event type and object name */
+    const char *values;                     /**< name of the unique values list */
+    const char *hist[TX_SUMMARY_HIST_MAX];  /**< names of the histograms, or NULL */
+} OutputTxSummaryFields;
+
+extern const OutputTxSummaryFields tx_summary_fields_http;
+extern const OutputTxSummaryFields tx_summary_fields_dns;
+
+typedef struct OutputTxSummaryConfig_ {
+    bool enabled;
+    uint16_t max_unique;    /**< number of unique values listed */
+    uint32_t interval;      /**< seconds between records, 0 for flow end only */
+    const OutputTxSummaryFields *fields;
+    OutputJsonCommonSettings common;
+} OutputTxSummaryConfig;
+
+typedef struct OutputTxSummaryValue_ {
+    uint32_t hash;
+    uint32_t cnt;
+    uint16_t len;
+    uint8_t *data;
+} OutputTxSummaryValue;
+
+/** bounded histogram, keys that don't fit are counted in 'other' */
+typedef struct OutputTxSummaryHist_ {
+    uint32_t key[TX_SUMMARY_HIST_SIZE];
+    uint32_t cnt[TX_SUMMARY_HIST_SIZE];
+    uint32_t used;
+    uint32_t other;
+} OutputTxSummaryHist;
+
+typedef struct OutputTxSummary_ {
+    const OutputTxSummaryFields *fields;
+    struct timeval first;
+    struct timeval last;
+    uint64_t cnt;               /**< transactions folded in */
+    uint64_t values_other;      /**< values seen after the list was full */
+    uint16_t values_max;
+    uint16_t values_cnt;
+    OutputTxSummaryValue *values;
+    OutputTxSummaryHist hist[TX_SUMMARY_HIST_MAX];
+    /** linear counting sketch for the number of unique values */
+    uint8_t sketch[TX_SUMMARY_SKETCH_BITS / 8];
+} OutputTxSummary;
+
+void OutputTxSummaryRegister(void);
+void OutputTxSummaryParseConfig(ConfNode *conf, const OutputTxSummaryFields *fields,
+        const OutputJsonCommonSettings *common, OutputTxSummaryConfig *cfg);
+
+OutputTxSummary *OutputTxSummaryGet(Flow *f, const OutputTxSummaryConfig *cfg,
+        const struct timeval *ts, LogFileCtx *file_ctx, MemBuffer **buffer);
+void OutputTxSummaryAddValue(OutputTxSummary *s, const uint8_t *data, uint32_t len);
+void OutputTxSummaryAddKey(OutputTxSummary *s, const uint8_t hist, const uint32_t key);
+
+void JsonTxSummaryLogRegister(void);
+void OutputTxSummaryRegisterTests(void);
+
+#endif /* __OUTPUT_JSON_TX_SUMMARY_H__ */
@@ -60,6 +60,7 @@
 #include "util-device.h"
 #include "util-validate.h"
 #include "util-crypt.h"
+#include "util-spm-bs.h"
 #include "util-plugin.h"
 
 #include "flow-var.h"
@@ -946,6 +947,69 @@ int OutputJSONMemBufferCallback(const char *str, size_t size, void *data)
     return 0;
 }
 
+/** \internal
+ *  \brief check if a sink wants a record based on its event type
+ *
+ *  The event type is looked up in the serialized record once per record
+ *  and cached in type/type_len.
+ */
+static bool OutputJsonSinkWants(const OutputJsonSink *sink,
+        const uint8_t *data, const size_t len,
+        const uint8_t **type, size_t *type_len)
+{
+    static const uint8_t key[] = "\"event_type\":\"";
+
+    if (sink->event_types == NULL)
+        return true;
+
+    if (*type == NULL) {
+        const uint8_t *k = BasicSearch(data, (uint32_t)len, key, sizeof(key) - 1);
+        if (k == NULL)
+            return false;
+        const uint8_t *start = k + sizeof(key) - 1;
+        const uint8_t *end = memchr(start, '"', len - (start - data));
+        if (end == NULL)
+            return false;
+        *type = start;
+        *type_len = end - start;
+    }
+
+    for (uint16_t i = 0; i < sink->event_types_cnt; i++) {
+        if (strlen(sink->event_types[i]) == *type_len &&
+                memcmp(sink->event_types[i], *type, *type_len) == 0)
+            return true;
+    }
+    return false;
+}
+
+/** \internal
+ *  \brief write an already serialized record to the sinks of an output
+ *
+ *  \param buffer scratch buffer, reset for each sink
+ */
+static void OutputJsonWriteSinks(const LogFileCtx *file_ctx, MemBuffer **buffer,
+        const uint8_t *data, const size_t len)
+{
+    const uint8_t *type = NULL;
+    size_t type_len = 0;
+
+    for (OutputJsonSink *sink = file_ctx->sinks; sink != NULL; sink = sink->next) {
+        if (!OutputJsonSinkWants(sink, data, len, &type, &type_len))
+            continue;
+
+        LogFileCtx *sink_ctx = sink->file_ctx;
+        MemBufferReset(*buffer);
+        if (sink_ctx->prefix) {
+            MemBufferWriteRaw((*buffer), sink_ctx->prefix, sink_ctx->prefix_len);
+        }
+        if (MEMBUFFER_OFFSET(*buffer) + len >= MEMBUFFER_SIZE(*buffer)) {
+            MemBufferExpand(buffer, len);
+        }
+        MemBufferWriteRaw((*buffer), data, len);
+        LogFileWrite(sink_ctx, *buffer);
+    }
+}
+
 int OutputJSONBuffer(json_t *js, LogFileCtx *file_ctx, MemBuffer **buffer)
 {
     if (file_ctx->sensor_name) {
@@ -972,6 +1036,14 @@ int OutputJSONBuffer(json_t *js, LogFileCtx *file_ctx, MemBuffer **buffer)
         return TM_ECODE_OK;
 
     LogFileWrite(file_ctx, *buffer);
+
+    if (file_ctx->sinks != NULL) {
+        char *s = json_dumps(js, file_ctx->json_flags);
+        if (s != NULL) {
+            OutputJsonWriteSinks(file_ctx, buffer, (const uint8_t *)s, strlen(s));
+            free(s);
+        }
+    }
     return 0;
 }
 
@@ -999,9 +1071,107 @@ int OutputJsonBuilderBuffer(JsonBuilder *js, LogFileCtx *file_ctx, MemBuffer **b
     MemBufferWriteRaw((*buffer), jb_ptr(js), jslen);
     LogFileWrite(file_ctx, *buffer);
 
+    /* the record is serialized once, the sinks get the same bytes */
+    if (file_ctx->sinks != NULL) {
+        OutputJsonWriteSinks(file_ctx, buffer, jb_ptr(js), jslen);
+    }
+
     return 0;
 }
 
+static void OutputJsonFreeSinks(LogFileCtx *file_ctx)
+{
+    OutputJsonSink *sink = file_ctx->sinks;
+    while (sink != NULL) {
+        OutputJsonSink *next = sink->next;
+        for (uint16_t i = 0; i < sink->event_types_cnt; i++) {
+            SCFree(sink->event_types[i]);
+        }
+        SCFree(sink->event_types);
+        if (sink->output_ctx != NULL && sink->output_ctx->DeInit != NULL) {
+            sink->output_ctx->DeInit(sink->output_ctx);
+        }
+        SCFree(sink);
+        sink = next;
+    }
+    file_ctx->sinks = NULL;
+}
+
+/** \internal
+ *  \brief set up the 'sinks' of an eve-log output
+ *
+ *  Each sink is configured like an eve-log output itself, minus the
+ *  types. Records logged to the output are written to the sinks as well,
+ *  optionally filtered on 'event-types'.
+ */
+static void OutputJsonInitSinks(ConfNode *conf, LogFileCtx *file_ctx)
+{
+    ConfNode *sinks = ConfNodeLookupChild(conf, "sinks");
+    if (sinks == NULL)
+        return;
+
+    OutputJsonSink *tail = NULL;
+    ConfNode *item;
+    TAILQ_FOREACH(item, &sinks->head, next) {
+        ConfNode *sink_conf = ConfNodeLookupChild(item, item->val);
+        if (sink_conf == NULL) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "eve-log sink '%s' has no "
+                    "configuration", item->val);
+        }
+        const char *enabled = ConfNodeLookupChildValue(sink_conf, "enabled");
+        if (enabled != NULL && !ConfValIsTrue(enabled)) {
+            continue;
+        }
+
+        OutputInitResult r = OutputJsonInitCtx(sink_conf);
+        if (!r.ok || r.ctx == NULL) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "failed to set up eve-log "
+                    "sink '%s'", item->val);
+        }
+        OutputJsonCtx *sink_json_ctx = r.ctx->data;
+        if (sink_json_ctx->file_ctx->threaded) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "eve-log sink '%s': threaded "
+                    "output is not supported for sinks", item->val);
+        }
+
+        OutputJsonSink *sink = SCCalloc(1, sizeof(*sink));
+        if (unlikely(sink == NULL)) {
+            FatalError(SC_ERR_MEM_ALLOC, "failed to allocate eve-log sink");
+        }
+        sink->output_ctx = r.ctx;
+        sink->file_ctx = sink_json_ctx->file_ctx;
+
+        ConfNode *types = ConfNodeLookupChild(sink_conf, "event-types");
+        if (types != NULL) {
+            ConfNode *type;
+            uint16_t cnt = 0;
+            TAILQ_FOREACH(type, &types->head, next) {
+                cnt++;
+            }
+            sink->event_types = SCCalloc(cnt ? cnt : 1, sizeof(char *));
+            if (unlikely(sink->event_types == NULL)) {
+                FatalError(SC_ERR_MEM_ALLOC, "failed to allocate eve-log sink");
+            }
+            TAILQ_FOREACH(type, &types->head, next) {
+                char *t = SCStrdup(type->val);
+                if (unlikely(t == NULL)) {
+                    FatalError(SC_ERR_MEM_ALLOC, "failed to allocate eve-log sink");
+                }
+                sink->event_types[sink->event_types_cnt++] = t;
+            }
+        }
+
+        if (tail == NULL)
+            file_ctx->sinks = sink;
+        else
+            tail->next = sink;
+        tail = sink;
+
+        SCLogConfig("eve-log: added sink '%s'%s", item->val,
+                sink->event_types ? " with event type filter" : "");
+    }
+}
+
 /**
  * \brief Create a new LogFileCtx for "fast" output style.
  * \param conf The configuration node for this output.
@@ -1270,6 +1440,8 @@ OutputInitResult OutputJsonInitCtx(ConfNode *conf)
         }
 
         json_ctx->file_ctx->type = json_ctx->json_out;
+
+        OutputJsonInitSinks(conf, json_ctx->file_ctx);
     }
 
     SCLogDebug("returning output_ctx %p", output_ctx);
@@ -1291,6 +1463,7 @@ static void OutputJsonDeInitCtx(OutputCtx *output_ctx)
     if (json_ctx->xff_cfg != NULL) {
         SCFree(json_ctx->xff_cfg);
     }
+    OutputJsonFreeSinks(logfile_ctx);
     LogFileFreeCtx(logfile_ctx);
     SCFree(json_ctx);
     SCFree(output_ctx);
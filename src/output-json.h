@@ -95,6 +95,16 @@ typedef struct OutputJsonCommonSettings_ {
     uint16_t community_id_seed;
 } OutputJsonCommonSettings;
 
+/** additional output of an eve-log instance: records are serialized
+ *  once and written to the eve-log output and each of its sinks */
+typedef struct OutputJsonSink_ {
+    OutputCtx *output_ctx;      /**< sink's own eve-log output ctx */
+    LogFileCtx *file_ctx;
+    char **event_types;         /**< event types to write, NULL for all */
+    uint16_t event_types_cnt;
+    struct OutputJsonSink_ *next;
+} OutputJsonSink;
+
 /*
  * Global configuration context data
  */
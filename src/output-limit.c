@@ -0,0 +1,404 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Rate limiting and sampling of output events.
+ *
+ * An eve-log type can have a 'limit' section with a token bucket rate
+ * limit and a sample rate. The packet, flow and tx logger loops check
+ * the limit of the logger's output ctx before invoking it, so dropped
+ * events are never built.
+ *
+ * Limits marked 'adaptive' tighten when the capture drop rate or the
+ * packet latency in the loggers exceed the 'load-shedding' thresholds:
+ * each level halves the rate and doubles the sampling interval.
+ */
+
+#include "suricata-common.h"
+#include "conf.h"
+#include "counters.h"
+#include "flow.h"
+#include "output-limit.h"
+#include "util-atomic.h"
+#include "util-debug.h"
+#include "util-device.h"
+#include "util-time.h"
+#include "util-unittest.h"
+
+#define OUTPUT_LIMIT_TOKEN 1000000ULL
+
+#define OUTPUT_LIMIT_DROP_THRESHOLD_DEFAULT     10  /**< permille */
+#define OUTPUT_LIMIT_LATENCY_THRESHOLD_DEFAULT  500 /**< msec */
+
+static struct {
+    uint32_t drop_threshold;    /**< capture drops in permille of packets */
+    uint32_t latency_threshold; /**< msec between capture and logging */
+
+    SC_ATOMIC_DECLARE(uint32_t, pressure);
+    SC_ATOMIC_DECLARE(uint64_t, update_sec);
+    SC_ATOMIC_DECLARE(uint32_t, max_latency);
+    uint64_t pkts;
+    uint64_t drops;
+} output_limit_adaptive = {
+    .drop_threshold = OUTPUT_LIMIT_DROP_THRESHOLD_DEFAULT,
+    .latency_threshold = OUTPUT_LIMIT_LATENCY_THRESHOLD_DEFAULT,
+};
+
+SC_ATOMIC_DECLARE(uint64_t, output_limit_dropped_rate);
+SC_ATOMIC_DECLARE(uint64_t, output_limit_dropped_sample);
+
+static uint64_t OutputLimitDroppedRateCounter(void)
+{
+    return SC_ATOMIC_GET(output_limit_dropped_rate);
+}
+
+static uint64_t OutputLimitDroppedSampleCounter(void)
+{
+    return SC_ATOMIC_GET(output_limit_dropped_sample);
+}
+
+static uint64_t OutputLimitPressureCounter(void)
+{
+    return SC_ATOMIC_GET(output_limit_adaptive.pressure);
+}
+
+static void OutputLimitRegisterCounters(void)
+{
+    static bool registered = false;
+    if (registered)
+        return;
+    registered = true;
+
+    SC_ATOMIC_INIT(output_limit_dropped_rate);
+    SC_ATOMIC_INIT(output_limit_dropped_sample);
+    SC_ATOMIC_INIT(output_limit_adaptive.pressure);
+    SC_ATOMIC_INIT(output_limit_adaptive.update_sec);
+    SC_ATOMIC_INIT(output_limit_adaptive.max_latency);
+
+    StatsRegisterGlobalCounter("output.limit.dropped_rate",
+            OutputLimitDroppedRateCounter);
+    StatsRegisterGlobalCounter("output.limit.dropped_sample",
+            OutputLimitDroppedSampleCounter);
+    StatsRegisterGlobalCounter("output.limit.pressure",
+            OutputLimitPressureCounter);
+}
+
+/** \brief set the load shedding thresholds for adaptive limits
+ *  \param conf 'load-shedding' node of the output, may be NULL */
+void OutputLimitSetupAdaptive(ConfNode *conf)
+{
+    if (conf == NULL)
+        return;
+
+    intmax_t val;
+    if (ConfGetChildValueInt(conf, "drop-threshold", &val)) {
+        if (val < 0 || val > 1000) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "invalid load-shedding "
+                    "drop-threshold %"PRIdMAX", expected permille 0-1000", val);
+        }
+        output_limit_adaptive.drop_threshold = (uint32_t)val;
+    }
+    if (ConfGetChildValueInt(conf, "latency-threshold", &val)) {
+        if (val <= 0 || val > UINT32_MAX) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "invalid load-shedding "
+                    "latency-threshold %"PRIdMAX, val);
+        }
+        output_limit_adaptive.latency_threshold = (uint32_t)val;
+    }
+    SCLogConfig("output load shedding: drop-threshold %u permille, "
+            "latency-threshold %ums", output_limit_adaptive.drop_threshold,
+            output_limit_adaptive.latency_threshold);
+}
+
+/** \brief create a limit from the 'limit' section of an output
+ *  \param conf output config, may be NULL
+ *  \retval limit or NULL if the output has no limit */
+OutputLimit *OutputLimitNew(ConfNode *conf, const char *name)
+{
+    ConfNode *node = conf ? ConfNodeLookupChild(conf, "limit") : NULL;
+    if (node == NULL)
+        return NULL;
+
+    OutputLimit *limit = SCCalloc(1, sizeof(*limit));
+    if (unlikely(limit == NULL)) {
+        FatalError(SC_ERR_MEM_ALLOC, "failed to allocate output limit");
+    }
+
+    intmax_t val;
+    if (ConfGetChildValueInt(node, "rate", &val)) {
+        if (val < 0 || val > UINT32_MAX) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "%s: invalid limit rate "
+                    "%"PRIdMAX, name, val);
+        }
+        limit->rate = (uint32_t)val;
+    }
+    limit->burst = limit->rate;
+    if (ConfGetChildValueInt(node, "burst", &val)) {
+        if (val <= 0 || val > UINT32_MAX) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "%s: invalid limit burst "
+                    "%"PRIdMAX, name, val);
+        }
+        limit->burst = (uint32_t)val;
+    }
+    if (ConfGetChildValueInt(node, "sample", &val)) {
+        if (val < 0 || val > UINT32_MAX) {
+            FatalError(SC_ERR_INVALID_ARGUMENT, "%s: invalid limit sample "
+                    "%"PRIdMAX, name, val);
+        }
+        limit->sample = (uint32_t)val;
+    }
+    int adaptive = 0;
+    if (ConfGetChildValueBool(node, "adaptive", &adaptive) == 1 && adaptive) {
+        limit->adaptive = true;
+    }
+
+    SCSpinInit(&limit->lock, 0);
+    limit->tokens = (uint64_t)limit->burst * OUTPUT_LIMIT_TOKEN;
+    SC_ATOMIC_INIT(limit->sample_cnt);
+
+    OutputLimitRegisterCounters();
+
+    SCLogConfig("%s: limit rate %u/s, burst %u, sample 1/%u%s", name,
+            limit->rate, limit->burst, MAX(limit->sample, 1),
+            limit->adaptive ? ", adaptive" : "");
+    return limit;
+}
+
+void OutputLimitFree(OutputLimit *limit)
+{
+    if (limit == NULL)
+        return;
+    SCSpinDestroy(&limit->lock);
+    SCFree(limit);
+}
+
+/** \internal
+ *  \brief update the load shedding level, at most once per second */
+static void OutputLimitUpdatePressure(const struct timeval *now)
+{
+    const uint64_t sec = (uint64_t)now->tv_sec;
+    const uint64_t last = SC_ATOMIC_GET(output_limit_adaptive.update_sec);
+    if (sec == last || !SC_ATOMIC_CAS(&output_limit_adaptive.update_sec, last, sec))
+        return;
+
+    /* only one thread gets here per second */
+    uint64_t pkts = 0, drops = 0;
+    if (LiveGetDeviceCount() > 0) {
+        LiveDevice *ldev = NULL, *ndev;
+        while (LiveDeviceForEach(&ldev, &ndev)) {
+            pkts += SC_ATOMIC_GET(ldev->pkts);
+            drops += SC_ATOMIC_GET(ldev->drop);
+        }
+    }
+    const uint64_t d_pkts = pkts - output_limit_adaptive.pkts;
+    const uint64_t d_drops = drops - output_limit_adaptive.drops;
+    output_limit_adaptive.pkts = pkts;
+    output_limit_adaptive.drops = drops;
+
+    const uint64_t drop_permille = (d_pkts + d_drops) ?
+        (d_drops * 1000) / (d_pkts + d_drops) : 0;
+    const uint32_t latency = SC_ATOMIC_GET(output_limit_adaptive.max_latency);
+    SC_ATOMIC_SET(output_limit_adaptive.max_latency, 0);
+
+    uint32_t pressure = SC_ATOMIC_GET(output_limit_adaptive.pressure);
+    if (drop_permille > output_limit_adaptive.drop_threshold ||
+            latency > output_limit_adaptive.latency_threshold) {
+        if (pressure < OUTPUT_LIMIT_PRESSURE_MAX)
+            pressure++;
+    } else if (pressure > 0 &&
+            drop_permille <= output_limit_adaptive.drop_threshold / 2 &&
+            latency <= output_limit_adaptive.latency_threshold / 2) {
+        pressure--;
+    }
+    if (pressure != SC_ATOMIC_GET(output_limit_adaptive.pressure)) {
+        SCLogDebug("output load shedding level %u (drops %"PRIu64" permille, "
+                "latency %ums)", pressure, drop_permille, latency);
+        SC_ATOMIC_SET(output_limit_adaptive.pressure, pressure);
+    }
+}
+
+/** \internal
+ *  \brief track the time between capture and logging of live packets */
+static void OutputLimitTrackLatency(const struct timeval *now, const Packet *p)
+{
+    if (p == NULL || !TimeModeIsLive() || timercmp(now, &p->ts, <))
+        return;
+
+    struct timeval d;
+    timersub(now, &p->ts, &d);
+    const uint64_t ms = (uint64_t)d.tv_sec * 1000 + d.tv_usec / 1000;
+    const uint32_t latency = (uint32_t)MIN(ms, UINT32_MAX);
+    if (latency > SC_ATOMIC_GET(output_limit_adaptive.max_latency))
+        SC_ATOMIC_SET(output_limit_adaptive.max_latency, latency);
+}
+
+/** \internal
+ *  \brief take a token from the bucket */
+static bool OutputLimitTake(OutputLimit *limit, const struct timeval *now,
+        const uint32_t rate)
+{
+    const uint64_t max = (uint64_t)MAX(limit->burst, 1) * OUTPUT_LIMIT_TOKEN;
+    bool pass = false;
+
+    SCSpinLock(&limit->lock);
+    if (timercmp(now, &limit->last, >)) {
+        struct timeval d;
+        timersub(now, &limit->last, &d);
+        const uint64_t usec = (uint64_t)d.tv_sec * 1000000 + d.tv_usec;
+        /* usec * rate is in millionths of an event. Past the time it
+         * takes to fill the bucket it is full, which also keeps a first
+         * refill from an unset 'last' from overflowing. */
+        if (usec >= max / rate) {
+            limit->tokens = max;
+        } else {
+            limit->tokens = MIN(max, limit->tokens + usec * rate);
+        }
+        limit->last = *now;
+    }
+    if (limit->tokens >= OUTPUT_LIMIT_TOKEN) {
+        limit->tokens -= OUTPUT_LIMIT_TOKEN;
+        pass = true;
+    }
+    SCSpinUnlock(&limit->lock);
+    return pass;
+}
+
+bool OutputLimitCheck(OutputLimit *limit, const Flow *f, const Packet *p)
+{
+    uint32_t pressure = 0;
+    struct timeval now;
+    TimeGet(&now);
+
+    if (limit->adaptive) {
+        OutputLimitTrackLatency(&now, p);
+        OutputLimitUpdatePressure(&now);
+        pressure = SC_ATOMIC_GET(output_limit_adaptive.pressure);
+    }
+
+    uint64_t sample = MAX(limit->sample, 1);
+    if (pressure > 0)
+        sample <<= pressure;
+    if (sample > 1) {
+        /* sample per flow, so that a flow is logged completely or not at all */
+        const uint32_t key = f ? f->flow_hash : SC_ATOMIC_ADD(limit->sample_cnt, 1);
+        if (key % sample != 0) {
+            SC_ATOMIC_ADD(output_limit_dropped_sample, 1);
+            return false;
+        }
+    }
+
+    if (limit->rate > 0) {
+        const uint32_t rate = MAX(limit->rate >> pressure, 1);
+        if (!OutputLimitTake(limit, &now, rate)) {
+            SC_ATOMIC_ADD(output_limit_dropped_rate, 1);
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifdef UNITTESTS
+static int OutputLimitTest01(void)
+{
+    OutputLimit limit;
+    memset(&limit, 0, sizeof(limit));
+    SCSpinInit(&limit.lock, 0);
+    limit.rate = 2;
+    limit.burst = 2;
+    limit.tokens = 2 * OUTPUT_LIMIT_TOKEN;
+
+    struct timeval now = { .tv_sec = 100, .tv_usec = 0 };
+    limit.last = now;
+
+    FAIL_IF_NOT(OutputLimitTake(&limit, &now, limit.rate));
+    FAIL_IF_NOT(OutputLimitTake(&limit, &now, limit.rate));
+    FAIL_IF(OutputLimitTake(&limit, &now, limit.rate));
+
+    /* half a second refills one token */
+    now.tv_usec = 500000;
+    FAIL_IF_NOT(OutputLimitTake(&limit, &now, limit.rate));
+    FAIL_IF(OutputLimitTake(&limit, &now, limit.rate));
+
+    /* bucket doesn't grow past the burst */
+    now.tv_sec = 200;
+    FAIL_IF_NOT(OutputLimitTake(&limit, &now, limit.rate));
+    FAIL_IF_NOT(OutputLimitTake(&limit, &now, limit.rate));
+    FAIL_IF(OutputLimitTake(&limit, &now, limit.rate));
+
+    SCSpinDestroy(&limit.lock);
+    PASS;
+}
+
+static int OutputLimitTest02(void)
+{
+    OutputLimit limit;
+    memset(&limit, 0, sizeof(limit));
+    SCSpinInit(&limit.lock, 0);
+    SC_ATOMIC_INIT(limit.sample_cnt);
+    limit.sample = 4;
+
+    int passed = 0;
+    for (int i = 0; i < 400; i++) {
+        if (OutputLimitCheck(&limit, NULL, NULL))
+            passed++;
+    }
+    FAIL_IF_NOT(passed == 100);
+
+    /* per flow: all or nothing */
+    Flow f;
+    memset(&f, 0, sizeof(f));
+    f.flow_hash = 8;
+    FAIL_IF_NOT(OutputLimitCheck(&limit, &f, NULL));
+    FAIL_IF_NOT(OutputLimitCheck(&limit, &f, NULL));
+    f.flow_hash = 9;
+    FAIL_IF(OutputLimitCheck(&limit, &f, NULL));
+    FAIL_IF(OutputLimitCheck(&limit, &f, NULL));
+
+    SCSpinDestroy(&limit.lock);
+    PASS;
+}
+
+/** \test first refill with a high rate and an unset last refill time */
+static int OutputLimitTest03(void)
+{
+    OutputLimit limit;
+    memset(&limit, 0, sizeof(limit));
+    SCSpinInit(&limit.lock, 0);
+    limit.rate = 100000;
+    limit.burst = 10;
+
+    struct timeval now = { .tv_sec = 1600000000, .tv_usec = 0 };
+    for (int i = 0; i < 10; i++) {
+        FAIL_IF_NOT(OutputLimitTake(&limit, &now, limit.rate));
+    }
+    FAIL_IF(OutputLimitTake(&limit, &now, limit.rate));
+
+    SCSpinDestroy(&limit.lock);
+    PASS;
+}
+#endif /* UNITTESTS */
+
+void OutputLimitRegisterTests(void)
+{
+#ifdef UNITTESTS
+    UtRegisterTest("OutputLimitTest01", OutputLimitTest01);
+    UtRegisterTest("OutputLimitTest02", OutputLimitTest02);
+    UtRegisterTest("OutputLimitTest03", OutputLimitTest03);
+#endif /* UNITTESTS */
+}
@@ -0,0 +1,67 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Rate limiting and sampling of output events, per output ctx.
+ */
+
+#ifndef __OUTPUT_LIMIT_H__
+#define __OUTPUT_LIMIT_H__
+
+#include "conf.h"
+#include "decode.h"
+#include "tm-modules.h"
+
+/** max load shedding level, at which sampling is 2^level times tighter */
+#define OUTPUT_LIMIT_PRESSURE_MAX   6
+
+typedef struct OutputLimit_ {
+    uint32_t rate;          /**< events per second, 0 for no limit */
+    uint32_t burst;         /**< bucket size in events */
+    uint32_t sample;        /**< log 1 in 'sample' flows/events, 0 or 1 for all */
+    bool adaptive;          /**< tighten under load */
+
+    SCSpinlock lock;        /**< protects the bucket */
+    uint64_t tokens;        /**< in millionths of an event */
+    struct timeval last;    /**< last bucket refill */
+
+    SC_ATOMIC_DECLARE(uint32_t, sample_cnt);
+} OutputLimit;
+
+OutputLimit *OutputLimitNew(ConfNode *conf, const char *name);
+void OutputLimitFree(OutputLimit *limit);
+void OutputLimitSetupAdaptive(ConfNode *conf);
+
+bool OutputLimitCheck(OutputLimit *limit, const Flow *f, const Packet *p);
+
+/** \brief check if an event may be logged by the output
+ *  \param f flow, or NULL. Sampling is per flow if set.
+ *  \param p packet, or NULL. Used for latency measurement.
+ *  \retval true log the event
+ *  \retval false drop the event */
+static inline bool OutputLimitPass(const OutputCtx *ctx, const Flow *f, const Packet *p)
+{
+    if (likely(ctx == NULL || ctx->limit == NULL))
+        return true;
+    return OutputLimitCheck(ctx->limit, f, p);
+}
+
+void OutputLimitRegisterTests(void);
+
+#endif /* __OUTPUT_LIMIT_H__ */
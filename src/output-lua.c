@@ -132,7 +132,7 @@ static int LuaTxLogger(ThreadVars *tv, void *thread_data, const Packet *p, Flow
  *  streaming data.
  */
 static int LuaStreamingLogger(ThreadVars *tv, void *thread_data, const Flow *f,
-        const uint8_t *data, uint32_t data_len, uint64_t tx_id, uint8_t flags)
+        const uint8_t *data, uint32_t data_len, uint64_t offset, uint64_t tx_id, uint8_t flags)
 {
     SCEnter();
 
@@ -794,6 +794,10 @@ static OutputInitResult OutputLuaLogInit(ConfNode *conf)
             om->alproto = ALPROTO_HTTP;
             om->ts_log_progress = -1;
             om->tc_log_progress = -1;
+            /* scripts may get the bodies with HttpGetRequestBody and
+             * HttpGetResponseBody */
+            AppLayerHtpEnableRequestBodyCallback();
+            AppLayerHtpEnableResponseBodyCallback();
             AppLayerParserRegisterLogger(IPPROTO_TCP, ALPROTO_HTTP);
         } else if (opts.alproto == ALPROTO_TLS) {
             om->TxLogFunc = LuaTxLogger;
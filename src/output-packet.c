@@ -27,6 +27,7 @@
 #include "tm-modules.h"
 #include "output.h"
 #include "output-packet.h"
+#include "output-limit.h"
 #include "util-profiling.h"
 #include "util-validate.h"
 
@@ -111,7 +112,8 @@ static TmEcode OutputPacketLog(ThreadVars *tv, Packet *p, void *thread_data)
     while (logger && store) {
         DEBUG_VALIDATE_BUG_ON(logger->LogFunc == NULL || logger->ConditionFunc == NULL);
 
-        if ((logger->ConditionFunc(tv, (const Packet *)p)) == TRUE) {
+        if ((logger->ConditionFunc(tv, (const Packet *)p)) == TRUE &&
+                OutputLimitPass(logger->output_ctx, p->flow, p)) {
             PACKET_PROFILING_LOGGER_START(p, logger->logger_id);
             logger->LogFunc(tv, store->thread_data, (const Packet *)p);
             PACKET_PROFILING_LOGGER_END(p, logger->logger_id);
@@ -37,6 +37,8 @@
 #include "stream-tcp-inline.h"
 #include "stream-tcp-reassemble.h"
 #include "util-validate.h"
+#include "util-unittest.h"
+#include "util-unittest-helper.h"
 
 typedef struct OutputLoggerThreadStore_ {
     void *thread_data;
@@ -98,6 +100,10 @@ int OutputRegisterStreamingLogger(LoggerId id, const char *name,
 
     if (op->type == STREAMING_TCP_DATA) {
         stream_config.streaming_log_api = true;
+    } else if (op->type == STREAMING_HTTP_BODIES) {
+        /* the bodies are logged after normalization and decompression */
+        AppLayerHtpEnableRequestBodyCallback();
+        AppLayerHtpEnableResponseBodyCallback();
     }
 
     SCLogDebug("OutputRegisterStreamingLogger happy");
@@ -112,7 +118,8 @@ typedef struct StreamerCallbackData_ {
     enum OutputStreamingType type;
 } StreamerCallbackData;
 
-static int Streamer(void *cbdata, Flow *f, const uint8_t *data, uint32_t data_len, uint64_t tx_id, uint8_t flags)
+static int Streamer(void *cbdata, Flow *f, const uint8_t *data, uint32_t data_len,
+        uint64_t offset, uint64_t tx_id, uint8_t flags)
 {
     StreamerCallbackData *streamer_cbdata = (StreamerCallbackData *)cbdata;
     DEBUG_VALIDATE_BUG_ON(streamer_cbdata == NULL);
@@ -131,7 +138,8 @@ static int Streamer(void *cbdata, Flow *f, const uint8_t *data, uint32_t data_le
         if (logger->type == streamer_cbdata->type) {
             SCLogDebug("logger %p", logger);
             PACKET_PROFILING_LOGGER_START(p, logger->logger_id);
-            logger->LogFunc(tv, store->thread_data, (const Flow *)f, data, data_len, tx_id, flags);
+            logger->LogFunc(tv, store->thread_data, (const Flow *)f, data, data_len,
+                    offset, tx_id, flags);
             PACKET_PROFILING_LOGGER_END(p, logger->logger_id);
         }
 
@@ -235,7 +243,7 @@ static int HttpBodyIterator(Flow *f, int close, void *cbdata, uint8_t iflags)
                 StreamingBufferSegmentGetData(body->sb, &chunk->sbseg, &data, &data_len);
 
                 // invoke Streamer
-                Streamer(cbdata, f, data, data_len, tx_id, flags);
+                Streamer(cbdata, f, data, data_len, chunk->sbseg.stream_offset, tx_id, flags);
                 //PrintRawDataFp(stdout, data, data_len);
                 chunk->logged = 1;
                 tx_logged = 1;
@@ -246,7 +254,7 @@ static int HttpBodyIterator(Flow *f, int close, void *cbdata, uint8_t iflags)
              * logged no chunks, we call the Streamer with NULL data so it can
              * close up. */
             if (tx_logged == 0 && (close||tx_done)) {
-                Streamer(cbdata, f, NULL, 0, tx_id,
+                Streamer(cbdata, f, NULL, 0, body ? body->content_len_so_far : 0, tx_id,
                          iflags|OUTPUT_STREAMING_FLAG_CLOSE|OUTPUT_STREAMING_FLAG_TRANSACTION);
             }
         }
@@ -260,11 +268,12 @@ struct StreamLogData {
     Flow *f;
 };
 
-static int StreamLogFunc(void *cb_data, const uint8_t *data, const uint32_t data_len)
+static int StreamLogFunc(
+        void *cb_data, const uint8_t *data, const uint32_t data_len, const uint64_t offset)
 {
     struct StreamLogData *log = cb_data;
 
-    Streamer(log->streamer_cbdata, log->f, data, data_len, 0, log->flags);
+    Streamer(log->streamer_cbdata, log->f, data, data_len, offset, 0, log->flags);
 
     /* hack: unset open flag after first run */
     log->flags &= ~OUTPUT_STREAMING_FLAG_OPEN;
@@ -292,7 +301,7 @@ static int TcpDataLogger (Flow *f, TcpSession *ssn, TcpStream *stream,
     }
 
     if (eof) {
-        Streamer(streamer_cbdata, f, NULL, 0, 0, flags|OUTPUT_STREAMING_FLAG_CLOSE);
+        Streamer(streamer_cbdata, f, NULL, 0, progress, 0, flags|OUTPUT_STREAMING_FLAG_CLOSE);
     }
     return 0;
 }
@@ -473,3 +482,88 @@ void OutputStreamingShutdown(void)
     }
     list = NULL;
 }
+
+#ifdef UNITTESTS
+static uint8_t streaming_test_buf[64];
+static uint32_t streaming_test_len = 0;
+
+static int OutputStreamingTestLog(ThreadVars *tv, void *thread_data,
+        const Flow *f, const uint8_t *data, uint32_t data_len,
+        uint64_t offset, uint64_t tx_id, uint8_t flags)
+{
+    if (data != NULL && offset + data_len <= sizeof(streaming_test_buf)) {
+        memcpy(streaming_test_buf + offset, data, data_len);
+        streaming_test_len = MAX(streaming_test_len, (uint32_t)(offset + data_len));
+    }
+    return 0;
+}
+
+/** \test a gzip response body reaches a http body streaming logger
+ *        decompressed, also if nothing else uses the body */
+static int OutputStreamingTest01(void)
+{
+    uint8_t httpbuf1[] = "GET /alice.txt HTTP/1.1\r\nHost: example.com\r\n\r\n";
+    uint32_t httplen1 = sizeof(httpbuf1) - 1; /* minus the \0 */
+    /* gzip of "Alice was beginning to get very tired" */
+    uint8_t httpbuf2[] = "HTTP/1.1 200 OK\r\n"
+                         "Content-Encoding: gzip\r\n"
+                         "Content-Length: 57\r\n\r\n"
+                         "\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\xff\x73\xcc\xc9\x4c\x4e\x55"
+                         "\x28\x4f\x2c\x56\x48\x4a\x4d\xcf\xcc\xcb\xcb\xcc\x4b\x57\x28\xc9"
+                         "\x57\x48\x4f\x2d\x51\x28\x4b\x2d\xaa\x54\x28\xc9\x2c\x4a\x4d\x01"
+                         "\x00\x16\x43\xe2\x31\x25\x00\x00\x00";
+    uint32_t httplen2 = sizeof(httpbuf2) - 1; /* minus the \0 */
+    const char expected[] = "Alice was beginning to get very tired";
+
+    /* only file inspection uses the response body */
+    const uint32_t htp_flags = SC_ATOMIC_GET(htp_config_flags);
+    SC_ATOMIC_SET(htp_config_flags, HTP_REQUIRE_RESPONSE_BODY);
+    OutputStreamingLogger *saved_list = list;
+    list = NULL;
+
+    FAIL_IF(OutputRegisterStreamingLogger(LOGGER_TCP_DATA, "test",
+                OutputStreamingTestLog, NULL, STREAMING_HTTP_BODIES,
+                NULL, NULL, NULL) != 0);
+    FAIL_IF_NOT(SC_ATOMIC_GET(htp_config_flags) & HTP_REQUIRE_RESPONSE_BODY_DATA);
+
+    TcpSession ssn;
+    memset(&ssn, 0, sizeof(ssn));
+    AppLayerParserThreadCtx *alp_tctx = AppLayerParserThreadCtxAlloc();
+    FAIL_IF_NULL(alp_tctx);
+    Flow *f = UTHBuildFlow(AF_INET, "1.2.3.4", "1.2.3.5", 1024, 80);
+    FAIL_IF_NULL(f);
+    f->protoctx = &ssn;
+    f->proto = IPPROTO_TCP;
+    f->alproto = ALPROTO_HTTP;
+    /* no file features for the flow */
+    f->file_flags = FLOWFILE_NONE;
+    StreamTcpInitConfig(TRUE);
+
+    FAIL_IF(AppLayerParserParse(NULL, alp_tctx, f, ALPROTO_HTTP,
+                STREAM_TOSERVER | STREAM_START, httpbuf1, httplen1) != 0);
+    FAIL_IF(AppLayerParserParse(NULL, alp_tctx, f, ALPROTO_HTTP,
+                STREAM_TOCLIENT | STREAM_START, httpbuf2, httplen2) != 0);
+
+    OutputLoggerThreadStore store = { NULL, NULL };
+    StreamerCallbackData cbdata = { list, &store, NULL, NULL, STREAMING_HTTP_BODIES };
+    streaming_test_len = 0;
+    HttpBodyIterator(f, 1, &cbdata, OUTPUT_STREAMING_FLAG_TOCLIENT);
+    FAIL_IF_NOT(streaming_test_len == strlen(expected));
+    FAIL_IF_NOT(memcmp(streaming_test_buf, expected, strlen(expected)) == 0);
+
+    UTHFreeFlow(f);
+    AppLayerParserThreadCtxFree(alp_tctx);
+    StreamTcpFreeConfig(TRUE);
+    OutputStreamingShutdown();
+    list = saved_list;
+    SC_ATOMIC_SET(htp_config_flags, htp_flags);
+    PASS;
+}
+#endif /* UNITTESTS */
+
+void OutputStreamingRegisterTests(void)
+{
+#ifdef UNITTESTS
+    UtRegisterTest("OutputStreamingTest01", OutputStreamingTest01);
+#endif /* UNITTESTS */
+}
@@ -40,10 +40,16 @@ enum OutputStreamingType {
     STREAMING_HTTP_BODIES,
 };
 
-/** filedata logger function pointer type */
+/** streaming logger function pointer type
+ *
+ *  'data' points into the stream's or body's StreamingBuffer, it is not
+ *  copied for the loggers. It is only valid during the call, so loggers
+ *  that need it afterwards have to copy it. 'offset' is the offset of
+ *  'data' in the stream or body, so loggers can limit themselves to the
+ *  range they need without tracking it per flow. */
 typedef int (*StreamingLogger)(ThreadVars *, void *thread_data,
         const Flow *f, const uint8_t *data, uint32_t data_len,
-        uint64_t tx_id, uint8_t flags);
+        uint64_t offset, uint64_t tx_id, uint8_t flags);
 
 int OutputRegisterStreamingLogger(LoggerId id, const char *name,
     StreamingLogger LogFunc, OutputCtx *, enum OutputStreamingType,
@@ -53,5 +59,6 @@ int OutputRegisterStreamingLogger(LoggerId id, const char *name,
 void OutputStreamingLoggerRegister (void);
 
 void OutputStreamingShutdown(void);
+void OutputStreamingRegisterTests(void);
 
 #endif /* __OUTPUT_STREAMING_H__ */
@@ -27,6 +27,7 @@
 #include "tm-modules.h"
 #include "output.h"
 #include "output-tx.h"
+#include "output-limit.h"
 #include "app-layer.h"
 #include "app-layer-parser.h"
 #include "util-profiling.h"
@@ -146,11 +147,13 @@ static void OutputTxLogList0(ThreadVars *tv,
 
         SCLogDebug("logger %p", logger);
 
-        /* always invoke "wild card" tx loggers */
-        SCLogDebug("Logging tx_id %"PRIu64" to logger %d", tx_id, logger->logger_id);
-        PACKET_PROFILING_LOGGER_START(p, logger->logger_id);
-        logger->LogFunc(tv, store->thread_data, p, f, f->alstate, tx, tx_id);
-        PACKET_PROFILING_LOGGER_END(p, logger->logger_id);
+        /* always invoke "wild card" tx loggers, unless rate limited */
+        if (OutputLimitPass(logger->output_ctx, f, p)) {
+            SCLogDebug("Logging tx_id %"PRIu64" to logger %d", tx_id, logger->logger_id);
+            PACKET_PROFILING_LOGGER_START(p, logger->logger_id);
+            logger->LogFunc(tv, store->thread_data, p, f, f->alstate, tx, tx_id);
+            PACKET_PROFILING_LOGGER_END(p, logger->logger_id);
+        }
 
         logger = logger->next;
         store = store->next;
@@ -293,6 +296,13 @@ static TmEcode OutputTxLog(ThreadVars *tv, Packet *p, void *thread_data)
                     }
                 }
 
+                /* a tx dropped by the limit counts as logged */
+                if (!OutputLimitPass(logger->output_ctx, f, p)) {
+                    SCLogDebug("tx_id %"PRIu64" dropped by limit", tx_id);
+                    tx_logged |= (1<<logger->logger_id);
+                    goto next_logger;
+                }
+
                 SCLogDebug("Logging tx_id %"PRIu64" to logger %d", tx_id, logger->logger_id);
                 PACKET_PROFILING_LOGGER_START(p, logger->logger_id);
                 logger->LogFunc(tv, store->thread_data, p, f, alstate, tx, tx_id);
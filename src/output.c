@@ -49,6 +49,7 @@
 #include "output-json-anomaly.h"
 #include "output-json-flow.h"
 #include "output-json-netflow.h"
+#include "output-json-tx-summary.h"
 #include "log-cf-common.h"
 #include "output-json-drop.h"
 #include "log-httplog.h"
@@ -1081,6 +1082,8 @@ void OutputRegisterLoggers(void)
     /* flow/netflow */
     JsonFlowLogRegister();
     JsonNetFlowLogRegister();
+    /* aggregated tx summaries */
+    JsonTxSummaryLogRegister();
     /* json stats */
     JsonStatsLogRegister();
 
@@ -37,6 +37,7 @@
 #include "host.h"
 #include "conf.h"
 #include "detect.h"
+#include "flow-storage.h"
 #include "reputation.h"
 
 /** effective reputation version, atomic as the host
@@ -48,6 +49,10 @@ SC_ATOMIC_DECLARE(uint32_t, srep_eversion);
  *  so hosts will always have a minial value of 1 */
 static uint32_t srep_version = 0;
 
+/** flow storage id of the SRepFlowCache, -1 if ip reputation is
+ *  not configured */
+static int g_srep_flow_id = -1;
+
 static uint32_t SRepIncrVersion(void)
 {
     return ++srep_version;
@@ -183,6 +188,63 @@ static void SRepInitComplete(void)
     SCLogDebug("effective Reputation version %u", SRepGetEffectiveVersion());
 }
 
+static void SRepFlowCacheFree(void *x)
+{
+    SCFree(x);
+}
+
+/** \brief register the flow storage for the per flow reputation cache
+ *
+ *  Only registered if ip reputation is configured. Needs to be called
+ *  before the storage API is finalized.
+ */
+void SRepFlowStorageRegister(void)
+{
+    g_srep_flow_id = -1;
+
+    const char *filename = NULL;
+    (void)ConfGet("reputation-categories-file", &filename);
+    if (filename == NULL && ConfGetNode("reputation-files") == NULL)
+        return;
+
+    g_srep_flow_id = FlowStorageRegister("iprep", sizeof(void *),
+            NULL, SRepFlowCacheFree);
+    if (g_srep_flow_id < 0) {
+        SCLogWarning(SC_ERR_NO_REPUTATION, "failed to register flow "
+                "storage for ip reputation, lookups won't be cached");
+    }
+}
+
+/** \brief get the reputation cache of a flow
+ *
+ *  The cache is created on first use. If it was filled by a detect
+ *  engine with another reputation version, e.g. before a rule reload,
+ *  it is cleared.
+ *
+ *  \param version srep_version of the detect engine
+ *  \retval cache or NULL if caching is not available
+ */
+SRepFlowCache *SRepFlowCacheGet(Flow *f, const uint32_t version)
+{
+    if (g_srep_flow_id < 0)
+        return NULL;
+
+    SRepFlowCache *c = FlowGetStorageById(f, g_srep_flow_id);
+    if (c == NULL) {
+        c = SCCalloc(1, sizeof(*c));
+        if (unlikely(c == NULL))
+            return NULL;
+        FlowSetStorageById(f, g_srep_flow_id, c);
+        c->version = version;
+    } else if (c->version != version) {
+        SCLogDebug("flow %p cache version %u, engine version %u",
+                f, c->version, version);
+        memset(c, 0, sizeof(*c));
+        c->version = version;
+    }
+    return c;
+}
+
 /** \brief Check if a Host is timed out wrt ip rep, meaning a new
  *         version is in place.
  *
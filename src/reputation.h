@@ -41,12 +41,24 @@ typedef struct SReputation_ {
     uint8_t rep[SREP_MAX_CATS];
 } SReputation;
 
+/** per flow cache of the reputation of the flow's addresses, filled
+ *  per category as iprep keywords are evaluated. Index 0 is the flow's
+ *  source address, 1 the destination address. */
+typedef struct SRepFlowCache_ {
+    uint32_t version;               /**< detect engine srep_version */
+    uint64_t resolved[2];           /**< bitmap of categories looked up */
+    uint8_t rep[2][SREP_MAX_CATS];
+} SRepFlowCache;
+
 uint8_t SRepCatGetByShortname(char *shortname);
 int SRepInit(struct DetectEngineCtx_ *de_ctx);
 void SRepDestroy(struct DetectEngineCtx_ *de_ctx);
 void SRepReloadComplete(void);
 int SRepHostTimedOut(Host *);
 
+void SRepFlowStorageRegister(void);
+SRepFlowCache *SRepFlowCacheGet(struct Flow_ *f, const uint32_t version);
+
 uint8_t SRepCIDRGetIPRepSrc(SRepCIDRTree *cidr_ctx, Packet *p, uint8_t cat, uint32_t version);
 uint8_t SRepCIDRGetIPRepDst(SRepCIDRTree *cidr_ctx, Packet *p, uint8_t cat, uint32_t version);
 void SRepResetVersion(void);
@@ -37,6 +37,7 @@
 #include "detect-engine-dcepayload.h"
 #include "detect-engine-state.h"
 #include "detect-engine-tag.h"
+#include "detect-engine-alert.h"
 #include "detect-engine-modbus.h"
 #include "detect-fast-pattern.h"
 #include "flow.h"
@@ -44,6 +45,12 @@
 #include "flow-manager.h"
 #include "flow-var.h"
 #include "flow-bit.h"
+#include "flow-embryonic.h"
+#include "flow-cpu-cost.h"
+#include "output-json-tx-summary.h"
+#include "output-limit.h"
+#include "output-streaming.h"
+#include "output-json-alert.h"
 #include "pkt-var.h"
 
 #include "host.h"
@@ -93,6 +100,7 @@
 #include "util-proto-name.h"
 #include "util-macset.h"
 #include "util-memrchr.h"
+#include "util-memcap-credit.h"
 
 #include "util-mpm-ac.h"
 #include "util-mpm-hs.h"
@@ -164,6 +172,12 @@ static void RegisterUnittests(void)
     ConfYamlRegisterTests();
     TmqhFlowRegisterTests();
     FlowRegisterTests();
+    FlowEmbryonicRegisterTests();
+    FlowCpuCostRegisterTests();
+    OutputTxSummaryRegisterTests();
+    OutputLimitRegisterTests();
+    OutputStreamingRegisterTests();
+    JsonAlertLogRegisterTests();
     HostRegisterUnittests();
     IPPairRegisterUnittests();
     SCSigRegisterSignatureOrderingTests();
@@ -181,6 +195,7 @@ static void RegisterUnittests(void)
     SCRConfRegisterTests();
     PayloadRegisterTests();
     DcePayloadRegisterTests();
+    PacketAlertRegisterTests();
 #ifdef PROFILING
     SCProfilingRegisterTests();
 #endif
@@ -196,6 +211,8 @@ static void RegisterUnittests(void)
     DetectPortTests();
     SCAtomicRegisterTests();
     MemrchrRegisterTests();
+    MemcapCreditRegisterTests();
+    UtilTimeRegisterTests();
     AppLayerUnittestsRegister();
     MimeDecRegisterTests();
     StreamingBufferRegisterTests();
@@ -285,6 +302,7 @@ void RunUnittests(int list_unittests, const char *regex_arg)
 
         uint32_t failed = UtRunTests(regex_arg);
         PacketPoolDestroy();
+        MemcapCreditThreadRelease();
         UtCleanup();
 #ifdef BUILD_HYPERSCAN
         MpmHSGlobalCleanup();
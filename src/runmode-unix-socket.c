@@ -33,6 +33,7 @@
 
 #include "flow-manager.h"
 #include "flow-timeout.h"
+#include "flow-cpu-cost.h"
 #include "stream-tcp.h"
 #include "stream-tcp-reassemble.h"
 #include "source-pcap-file-directory-helper.h"
@@ -1523,6 +1524,62 @@ TmEcode UnixSocketShowAllMemcap(json_t *cmd, json_t *answer, void *data)
     json_object_set_new(answer, "message", jmemcaps);
     SCReturnInt(TM_ECODE_OK);
 }
+
+/**
+ * \brief Command to list the live flows with the highest cpu cost
+ */
+TmEcode UnixSocketFlowTopCpu(json_t *cmd, json_t *answer, void *data)
+{
+    FlowCpuCostTopEntry top[FLOW_CPU_COST_TOP_DEFAULT];
+
+    if (g_flow_cpu_cost_id < 0) {
+        json_object_set_new(answer, "message",
+                            json_string("flow cpu accounting is disabled, "
+                                        "see flow.cpu-accounting"));
+        return TM_ECODE_FAILED;
+    }
+
+    json_t *jflows = json_array();
+    if (jflows == NULL) {
+        json_object_set_new(answer, "message",
+                            json_string("internal error at json array creation"));
+        return TM_ECODE_FAILED;
+    }
+
+    const uint32_t cnt = FlowCpuCostGetTop(top, FLOW_CPU_COST_TOP_DEFAULT);
+    for (uint32_t i = 0; i < cnt; i++) {
+        json_t *jobj = json_object();
+        json_t *jcpu = json_object();
+        if (jobj == NULL || jcpu == NULL) {
+            if (jobj != NULL)
+                json_decref(jobj);
+            if (jcpu != NULL)
+                json_decref(jcpu);
+            json_decref(jflows);
+            json_object_set_new(answer, "message",
+                                json_string("internal error at json object creation"));
+            return TM_ECODE_FAILED;
+        }
+        json_object_set_new(jobj, "src_ip", json_string(top[i].src_ip));
+        json_object_set_new(jobj, "dest_ip", json_string(top[i].dst_ip));
+        json_object_set_new(jobj, "src_port", json_integer(top[i].sp));
+        json_object_set_new(jobj, "dest_port", json_integer(top[i].dp));
+        json_object_set_new(jobj, "proto", json_integer(top[i].proto));
+        json_object_set_new(jobj, "app_proto",
+                json_string(AppProtoToString(top[i].alproto)));
+
+        json_object_set_new(jcpu, "stream", json_integer(top[i].cost.stream));
+        json_object_set_new(jcpu, "app_layer", json_integer(top[i].cost.app_layer));
+        json_object_set_new(jcpu, "detect", json_integer(top[i].cost.detect));
+        json_object_set_new(jcpu, "total", json_integer(top[i].total));
+        json_object_set_new(jobj, "cpu", jcpu);
+
+        json_array_append_new(jflows, jobj);
+    }
+
+    json_object_set_new(answer, "message", jflows);
+    SCReturnInt(TM_ECODE_OK);
+}
 #endif /* BUILD_UNIX_SOCKET */
 
 #ifdef BUILD_UNIX_SOCKET
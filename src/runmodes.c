@@ -54,6 +54,7 @@
 #include "flow-manager.h"
 #include "flow-bypass.h"
 #include "counters.h"
+#include "output-limit.h"
 
 #include "suricata-plugin.h"
 
@@ -98,6 +99,9 @@ static char *active_runmode;
 typedef struct OutputFreeList_ {
     OutputModule *output_module;
     OutputCtx *output_ctx;
+    /** limit owned by this entry. It may be shared with the output ctx's
+     *  of other entries, so it's freed with this entry only. */
+    OutputLimit *limit;
 
     TAILQ_ENTRY(OutputFreeList_) entries;
 } OutputFreeList;
@@ -480,6 +484,10 @@ static void RunOutputFreeList(void)
         SCLogDebug("output %s %p %p", output->output_module->name, output,
             output->output_ctx);
 
+        if (output->output_ctx != NULL) {
+            output->output_ctx->limit = NULL;
+        }
+        OutputLimitFree(output->limit);
         if (output->output_ctx != NULL && output->output_ctx->DeInit != NULL)
             output->output_ctx->DeInit(output->output_ctx);
 
@@ -555,14 +563,15 @@ void RunModeShutDown(void)
 /** \internal
  *  \brief add Sub RunModeOutput to list for Submodule so we can free
  *         the output ctx at shutdown and unix socket reload */
-static void AddOutputToFreeList(OutputModule *module, OutputCtx *output_ctx)
+static OutputFreeList *AddOutputToFreeList(OutputModule *module, OutputCtx *output_ctx)
 {
     OutputFreeList *fl_output = SCCalloc(1, sizeof(OutputFreeList));
     if (unlikely(fl_output == NULL))
-        return;
+        return NULL;
     fl_output->output_module = module;
     fl_output->output_ctx = output_ctx;
     TAILQ_INSERT_TAIL(&output_free_list, fl_output, entries);
+    return fl_output;
 }
 
 /** \brief Turn output into thread module */
@@ -636,6 +645,8 @@ static void RunModeInitializeEveOutput(ConfNode *conf, OutputCtx *parent_ctx)
         return;
     }
 
+    OutputLimitSetupAdaptive(ConfNodeLookupChild(conf, "load-shedding"));
+
     ConfNode *type = NULL;
     TAILQ_FOREACH(type, &types->head, next) {
         SCLogConfig("enabling 'eve-log' module '%s'", type->val);
@@ -653,6 +664,10 @@ static void RunModeInitializeEveOutput(ConfNode *conf, OutputCtx *parent_ctx)
             }
         }
 
+        /* one limit per eve type, shared by all its sub-modules */
+        OutputLimit *limit = NULL;
+        bool limit_setup = false;
+
         /* Now setup all registers logger of this name. */
         OutputModule *sub_module;
         TAILQ_FOREACH(sub_module, &output_modules, entries) {
@@ -675,8 +690,13 @@ static void RunModeInitializeEveOutput(ConfNode *conf, OutputCtx *parent_ctx)
                 if (!result.ok || result.ctx == NULL) {
                     continue;
                 }
-
-                AddOutputToFreeList(sub_module, result.ctx);
+                OutputFreeList *fl_output = AddOutputToFreeList(sub_module, result.ctx);
+                if (!limit_setup && fl_output != NULL) {
+                    limit = OutputLimitNew(sub_output_config, subname);
+                    fl_output->limit = limit;
+                    limit_setup = true;
+                }
+                result.ctx->limit = limit;
                 SetupOutput(sub_module->name, sub_module,
                         result.ctx);
             }
@@ -283,7 +283,7 @@ static void PcapCallbackLoop(char *user, struct pcap_pkthdr *h, u_char *pkt)
     }
 
     /* Trigger one dump of stats every second */
-    TimeGet(&current_time);
+    TimeGetCoarse(&current_time);
     if (current_time.tv_sec != ptv->last_stats_dump) {
         PcapDumpCounters(ptv);
         ptv->last_stats_dump = current_time.tv_sec;
@@ -119,6 +119,11 @@ typedef struct TcpStream_ {
                                      *   remains available for inspection together with app layer buffers */
     uint32_t data_required;         /**< data required from STREAM_APP_PROGRESS before calling app-layer again */
 
+    uint64_t raw_mpm_progress;      /**< absolute offset up to which the stream MPM scanned */
+    const void *raw_mpm_ctx;        /**< MPM ctx (rule group) raw_mpm_progress is tracked for */
+    uint32_t raw_mpm_version;       /**< detect engine version raw_mpm_ctx belongs to, as the
+                                     *   ctx may be allocated at the same address after a reload */
+
     StreamingBuffer sb;
     struct TCPSEG seg_tree;         /**< red black tree of TCP segments. Data is stored in TcpStream::sb */
     uint32_t segs_right_edge;
@@ -195,7 +200,8 @@ enum TcpState
  * Per STREAM flags
  */
 
-// bit 0 vacant
+/** retained data was (attempted to be) compressed while the flow was idle */
+#define STREAMTCP_STREAM_FLAG_COMPRESSED                    BIT_U16(0)
 /** Flag to avoid stream reassembly/app layer inspection for the stream */
 #define STREAMTCP_STREAM_FLAG_NOREASSEMBLY                  BIT_U16(1)
 /** we received a keep alive */
@@ -66,6 +66,7 @@
 
 #include "util-profiling.h"
 #include "util-validate.h"
+#include "util-memcap-credit.h"
 
 #ifdef DEBUG
 static SCMutex segment_pool_memuse_mutex;
@@ -73,20 +74,22 @@ static uint64_t segment_pool_memuse = 0;
 static uint64_t segment_pool_memcnt = 0;
 #endif
 
+/** compressed size of the retained data of idle sessions */
+static SC_ATOMIC_DECLARE(uint64_t, ra_compressed_bytes);
+/** uncompressed size of the data in ra_compressed_bytes */
+static SC_ATOMIC_DECLARE(uint64_t, ra_uncompressed_bytes);
+
 static PoolThread *segment_thread_pool = NULL;
 /* init only, protect initializing and growing pool */
 static SCMutex segment_thread_pool_mutex = SCMUTEX_INITIALIZER;
 
-/* Memory use counter */
-SC_ATOMIC_DECLARE(uint64_t, ra_memuse);
-
 /* prototypes */
 TcpSegment *StreamTcpGetSegment(ThreadVars *tv, TcpReassemblyThreadCtx *);
 void StreamTcpCreateTestPacket(uint8_t *, uint8_t, uint8_t, uint8_t);
 
 void StreamTcpReassembleInitMemuse(void)
 {
-    SC_ATOMIC_INIT(ra_memuse);
+    MemcapCreditInit(MEMCAP_CREDIT_REASSEMBLY);
 }
 
 /**
@@ -97,7 +100,7 @@ void StreamTcpReassembleInitMemuse(void)
  */
 void StreamTcpReassembleIncrMemuse(uint64_t size)
 {
-    (void) SC_ATOMIC_ADD(ra_memuse, size);
+    MemcapCreditIncr(MEMCAP_CREDIT_REASSEMBLY, size);
     SCLogDebug("REASSEMBLY %"PRIu64", incr %"PRIu64, StreamTcpReassembleMemuseGlobalCounter(), size);
     return;
 }
@@ -111,17 +114,17 @@ void StreamTcpReassembleIncrMemuse(uint64_t size)
 void StreamTcpReassembleDecrMemuse(uint64_t size)
 {
 #ifdef UNITTESTS
-    uint64_t presize = SC_ATOMIC_GET(ra_memuse);
+    uint64_t presize = StreamTcpReassembleMemuseGlobalCounter();
     if (RunmodeIsUnittests()) {
         BUG_ON(presize > UINT_MAX);
     }
 #endif
 
-    (void) SC_ATOMIC_SUB(ra_memuse, size);
+    MemcapCreditDecr(MEMCAP_CREDIT_REASSEMBLY, size);
 
 #ifdef UNITTESTS
     if (RunmodeIsUnittests()) {
-        uint64_t postsize = SC_ATOMIC_GET(ra_memuse);
+        uint64_t postsize = StreamTcpReassembleMemuseGlobalCounter();
         BUG_ON(postsize > presize);
     }
 #endif
@@ -129,10 +132,14 @@ void StreamTcpReassembleDecrMemuse(uint64_t size)
     return;
 }
 
+/**
+ *  \brief Get the reassembly memuse
+ *
+ *  Includes the unused memcap credit held by the threads.
+ */
 uint64_t StreamTcpReassembleMemuseGlobalCounter(void)
 {
-    uint64_t smemuse = SC_ATOMIC_GET(ra_memuse);
-    return smemuse;
+    return MemcapCreditGetMemuse(MEMCAP_CREDIT_REASSEMBLY);
 }
 
 /**
@@ -147,7 +154,7 @@ int StreamTcpReassembleCheckMemcap(uint64_t size)
 {
     uint64_t memcapcopy = SC_ATOMIC_GET(stream_config.reassembly_memcap);
     if (memcapcopy == 0 ||
-        (uint64_t)((uint64_t)size + SC_ATOMIC_GET(ra_memuse)) <= memcapcopy)
+        MemcapCreditCheck(MEMCAP_CREDIT_REASSEMBLY, size, memcapcopy))
         return 1;
     return 0;
 }
@@ -159,7 +166,7 @@ int StreamTcpReassembleCheckMemcap(uint64_t size)
  */
 int StreamTcpReassembleSetMemcap(uint64_t size)
 {
-    if (size == 0 || (uint64_t)SC_ATOMIC_GET(ra_memuse) < size) {
+    if (size == 0 || (uint64_t)StreamTcpReassembleMemuseGlobalCounter() < size) {
         SC_ATOMIC_SET(stream_config.reassembly_memcap, size);
         return 1;
     }
@@ -238,6 +245,138 @@ static void ReassembleFree(void *ptr, size_t size)
     StreamTcpReassembleDecrMemuse(size);
 }
 
+/** \internal
+ *  \brief alloc w/o memcap check, for restoring compressed data that was
+ *         already accounted for before it was compressed. */
+static void *ReassembleMallocNoMemcap(size_t size)
+{
+    void *ptr = SCMalloc(size);
+    if (ptr == NULL)
+        return NULL;
+    StreamTcpReassembleIncrMemuse(size);
+    return ptr;
+}
+
+static uint64_t StreamTcpReassembleCompressedCounter(void)
+{
+    return SC_ATOMIC_GET(ra_compressed_bytes);
+}
+
+static uint64_t StreamTcpReassembleUncompressedCounter(void)
+{
+    return SC_ATOMIC_GET(ra_uncompressed_bytes);
+}
+
+/** \internal
+ *  \brief compression ratio of the compressed retained data, times 100 */
+static uint64_t StreamTcpReassembleCompressionRatioCounter(void)
+{
+    const uint64_t compressed = SC_ATOMIC_GET(ra_compressed_bytes);
+    if (compressed == 0)
+        return 0;
+    return SC_ATOMIC_GET(ra_uncompressed_bytes) * 100 / compressed;
+}
+
+/**
+ *  \brief check if the retained data of idle sessions should be compressed
+ *
+ *  \retval true compression is enabled and the reassembly memuse is above
+ *               the configured part of the memcap
+ */
+bool StreamTcpReassembleCompressNeeded(void)
+{
+    if (!stream_config.reassembly_compress)
+        return false;
+
+    const uint64_t memcap = SC_ATOMIC_GET(stream_config.reassembly_memcap);
+    if (memcap == 0)
+        return false;
+
+    return StreamTcpReassembleMemuseGlobalCounter() >=
+        (memcap / 100) * stream_config.reassembly_compress_pct;
+}
+
+static uint64_t StreamTcpReassembleCompressStream(TcpStream *stream)
+{
+    if (stream->flags & STREAMTCP_STREAM_FLAG_COMPRESSED)
+        return 0;
+    /* set even if we don't compress, so we don't retry until the
+     * next packet updates the stream */
+    stream->flags |= STREAMTCP_STREAM_FLAG_COMPRESSED;
+
+    const uint32_t size = stream->sb.buf_size;
+    const uint32_t data_len = stream->sb.buf_offset;
+    const int len = StreamingBufferCompress(&stream->sb);
+    if (len <= 0)
+        return 0;
+
+    SC_ATOMIC_ADD(ra_compressed_bytes, (uint64_t)len);
+    SC_ATOMIC_ADD(ra_uncompressed_bytes, data_len);
+    return size - (uint32_t)len;
+}
+
+/**
+ *  \brief compress the retained data of an idle session
+ *
+ *  The data is restored by StreamTcpReassembleDecompressSession() when
+ *  the next packet for the flow is processed.
+ *
+ *  \param ssn session of a locked flow that is not in use by a packet
+ *
+ *  \retval saved number of bytes of memuse released
+ */
+uint64_t StreamTcpReassembleCompressSession(TcpSession *ssn)
+{
+    return StreamTcpReassembleCompressStream(&ssn->client) +
+        StreamTcpReassembleCompressStream(&ssn->server);
+}
+
+/**
+ *  \brief update the compression counters for a stream that is freed
+ */
+void StreamTcpReassembleCompressedFree(TcpStream *stream)
+{
+    if (StreamingBufferIsCompressed(&stream->sb)) {
+        SC_ATOMIC_SUB(ra_compressed_bytes, stream->sb.buf_compressed_len);
+        SC_ATOMIC_SUB(ra_uncompressed_bytes, stream->sb.buf_offset);
+    }
+}
+
+static void StreamTcpReassembleDecompressStream(TcpStream *stream)
+{
+    if (!(stream->flags & STREAMTCP_STREAM_FLAG_COMPRESSED))
+        return;
+    stream->flags &= ~STREAMTCP_STREAM_FLAG_COMPRESSED;
+
+    if (!StreamingBufferIsCompressed(&stream->sb))
+        return;
+
+    const uint32_t len = stream->sb.buf_compressed_len;
+    const uint32_t data_len = stream->sb.buf_offset;
+    if (StreamingBufferDecompress(&stream->sb, ReassembleMallocNoMemcap) != 0) {
+        /* data is lost, handle it like reaching the depth */
+        SCLogDebug("stream %p: failed to restore compressed data", stream);
+        StreamTcpReassembleCompressedFree(stream);
+        stream->flags |= STREAMTCP_STREAM_FLAG_NOREASSEMBLY;
+        StreamTcpReturnStreamSegments(stream);
+        StreamingBufferClear(&stream->sb);
+        return;
+    }
+    SC_ATOMIC_SUB(ra_compressed_bytes, len);
+    SC_ATOMIC_SUB(ra_uncompressed_bytes, data_len);
+}
+
+/**
+ *  \brief restore the retained data compressed while the flow was idle
+ *
+ *  Must be called before the session's stream data is accessed.
+ */
+void StreamTcpReassembleDecompressSession(TcpSession *ssn)
+{
+    StreamTcpReassembleDecompressStream(&ssn->client);
+    StreamTcpReassembleDecompressStream(&ssn->server);
+}
+
 /** \brief alloc a tcp segment pool entry */
 static void *TcpSegmentPoolAlloc(void)
 {
@@ -393,6 +532,43 @@ static int StreamTcpReassemblyConfig(char quiet)
     stream_config.sbcnf.Realloc = ReassembleRealloc;
     stream_config.sbcnf.Free = ReassembleFree;
 
+    int compress = 0;
+    (void)ConfGetBool("stream.reassembly.compression.enabled", &compress);
+    stream_config.reassembly_compress = compress != 0;
+#ifndef HAVE_LIBLZ4
+    if (stream_config.reassembly_compress) {
+        SCLogWarning(SC_ERR_NOT_SUPPORTED, "stream.reassembly.compression "
+                "requires liblz4, disabling");
+        stream_config.reassembly_compress = false;
+    }
+#endif
+    stream_config.reassembly_compress_idle = 10;
+    stream_config.reassembly_compress_pct = 75;
+    if (stream_config.reassembly_compress) {
+        intmax_t value = 0;
+        if (ConfGetInt("stream.reassembly.compression.idle-time", &value) == 1) {
+            if (value < 0 || value > UINT32_MAX) {
+                SCLogError(SC_ERR_INVALID_ARGUMENT, "stream.reassembly."
+                        "compression.idle-time %"PRIdMAX" is invalid", value);
+                return -1;
+            }
+            stream_config.reassembly_compress_idle = (uint32_t)value;
+        }
+        if (ConfGetInt("stream.reassembly.compression.memcap-threshold", &value) == 1) {
+            if (value < 0 || value > 100) {
+                SCLogError(SC_ERR_INVALID_ARGUMENT, "stream.reassembly."
+                        "compression.memcap-threshold %"PRIdMAX" is invalid, "
+                        "expected a percentage", value);
+                return -1;
+            }
+            stream_config.reassembly_compress_pct = (uint32_t)value;
+        }
+        if (!quiet)
+            SCLogConfig("stream.reassembly \"compression\": idle-time %us, "
+                    "memcap-threshold %u%%", stream_config.reassembly_compress_idle,
+                    stream_config.reassembly_compress_pct);
+    }
+
     return 0;
 }
 
@@ -409,6 +585,17 @@ int StreamTcpReassembleInit(char quiet)
 #endif
     StatsRegisterGlobalCounter("tcp.reassembly_memuse",
             StreamTcpReassembleMemuseGlobalCounter);
+
+    SC_ATOMIC_INIT(ra_compressed_bytes);
+    SC_ATOMIC_INIT(ra_uncompressed_bytes);
+    if (stream_config.reassembly_compress) {
+        StatsRegisterGlobalCounter("tcp.reassembly_compressed",
+                StreamTcpReassembleCompressedCounter);
+        StatsRegisterGlobalCounter("tcp.reassembly_uncompressed",
+                StreamTcpReassembleUncompressedCounter);
+        StatsRegisterGlobalCounter("tcp.reassembly_compression_ratio",
+                StreamTcpReassembleCompressionRatioCounter);
+    }
     return 0;
 }
 
@@ -1557,7 +1744,7 @@ static int StreamReassembleRawInline(TcpSession *ssn, const Packet *p,
     }
 
     /* run the callback */
-    r = Callback(cb_data, mydata, mydata_len);
+    r = Callback(cb_data, mydata, mydata_len, mydata_offset);
     BUG_ON(r < 0);
 
     if (return_progress) {
@@ -1600,6 +1787,9 @@ static int StreamReassembleRawInline(TcpSession *ssn, const Packet *p,
  *  contains gaps. It will then be run for each block of data that is
  *  continuous.
  *
+ *  The callback gets the absolute stream offset of the data it is
+ *  passed.
+ *
  *  The callback should give on of 2 return values:
  *  - 0 ok
  *  - 1 done
@@ -1719,7 +1909,7 @@ static int StreamReassembleRawDo(TcpSession *ssn, TcpStream *stream,
         SCLogDebug("data %p len %u", mydata, mydata_len);
 
         /* we have data. */
-        r = Callback(cb_data, mydata, mydata_len);
+        r = Callback(cb_data, mydata, mydata_len, mydata_offset);
         BUG_ON(r < 0);
 
         if (mydata_offset == progress) {
@@ -2952,15 +3142,15 @@ static int StreamTcpReassembleTest40 (void)
 static int StreamTcpReassembleTest44(void)
 {
     StreamTcpInitConfig(TRUE);
-    uint32_t memuse = SC_ATOMIC_GET(ra_memuse);
+    uint32_t memuse = StreamTcpReassembleMemuseGlobalCounter();
     StreamTcpReassembleIncrMemuse(500);
-    FAIL_IF(SC_ATOMIC_GET(ra_memuse) != (memuse+500));
+    FAIL_IF(StreamTcpReassembleMemuseGlobalCounter() != (memuse+500));
     StreamTcpReassembleDecrMemuse(500);
-    FAIL_IF(SC_ATOMIC_GET(ra_memuse) != memuse);
+    FAIL_IF(StreamTcpReassembleMemuseGlobalCounter() != memuse);
     FAIL_IF(StreamTcpReassembleCheckMemcap(500) != 1);
     FAIL_IF(StreamTcpReassembleCheckMemcap((1 + memuse + SC_ATOMIC_GET(stream_config.reassembly_memcap))) != 0);
     StreamTcpFreeConfig(TRUE);
-    FAIL_IF(SC_ATOMIC_GET(ra_memuse) != 0);
+    FAIL_IF(StreamTcpReassembleMemuseGlobalCounter() != 0);
     PASS;
 }
 
@@ -120,6 +120,11 @@ uint64_t StreamTcpReassembleGetMemcap(void);
 int StreamTcpReassembleCheckMemcap(uint64_t size);
 uint64_t StreamTcpReassembleMemuseGlobalCounter(void);
 
+bool StreamTcpReassembleCompressNeeded(void);
+uint64_t StreamTcpReassembleCompressSession(TcpSession *ssn);
+void StreamTcpReassembleDecompressSession(TcpSession *ssn);
+void StreamTcpReassembleCompressedFree(TcpStream *stream);
+
 void StreamTcpDisableAppLayer(Flow *f);
 int StreamTcpAppLayerIsDisabled(Flow *f);
 
@@ -35,6 +35,7 @@
 
 #include "flow.h"
 #include "flow-util.h"
+#include "flow-embryonic.h"
 
 #include "conf.h"
 #include "conf-yaml-loader.h"
@@ -71,9 +72,11 @@
 #include "util-privs.h"
 #include "util-profiling.h"
 #include "util-misc.h"
+#include "util-cpu.h"
 #include "util-validate.h"
 #include "util-runmodes.h"
 #include "util-random.h"
+#include "util-memcap-credit.h"
 
 #include "source-pcap-file.h"
 
@@ -118,16 +121,15 @@ static uint64_t ssn_pool_cnt = 0; /** counts ssns, protected by ssn_pool_mutex *
 
 TcpStreamCnf stream_config;
 uint64_t StreamTcpReassembleMemuseGlobalCounter(void);
-SC_ATOMIC_DECLARE(uint64_t, st_memuse);
 
 void StreamTcpInitMemuse(void)
 {
-    SC_ATOMIC_INIT(st_memuse);
+    MemcapCreditInit(MEMCAP_CREDIT_STREAM);
 }
 
 void StreamTcpIncrMemuse(uint64_t size)
 {
-    (void) SC_ATOMIC_ADD(st_memuse, size);
+    MemcapCreditIncr(MEMCAP_CREDIT_STREAM, size);
     SCLogDebug("STREAM %"PRIu64", incr %"PRIu64, StreamTcpMemuseCounter(), size);
     return;
 }
@@ -135,17 +137,17 @@ void StreamTcpIncrMemuse(uint64_t size)
 void StreamTcpDecrMemuse(uint64_t size)
 {
 #ifdef DEBUG_VALIDATION
-    uint64_t presize = SC_ATOMIC_GET(st_memuse);
+    uint64_t presize = MemcapCreditGetMemuse(MEMCAP_CREDIT_STREAM);
     if (RunmodeIsUnittests()) {
         BUG_ON(presize > UINT_MAX);
     }
 #endif
 
-    (void) SC_ATOMIC_SUB(st_memuse, size);
+    MemcapCreditDecr(MEMCAP_CREDIT_STREAM, size);
 
 #ifdef DEBUG_VALIDATION
     if (RunmodeIsUnittests()) {
-        uint64_t postsize = SC_ATOMIC_GET(st_memuse);
+        uint64_t postsize = MemcapCreditGetMemuse(MEMCAP_CREDIT_STREAM);
         BUG_ON(postsize > presize);
     }
 #endif
@@ -153,10 +155,14 @@ void StreamTcpDecrMemuse(uint64_t size)
     return;
 }
 
+/**
+ *  \brief Get the stream memuse
+ *
+ *  Includes the unused memcap credit held by the threads.
+ */
 uint64_t StreamTcpMemuseCounter(void)
 {
-    uint64_t memusecopy = SC_ATOMIC_GET(st_memuse);
-    return memusecopy;
+    return MemcapCreditGetMemuse(MEMCAP_CREDIT_STREAM);
 }
 
 /**
@@ -168,7 +174,7 @@ uint64_t StreamTcpMemuseCounter(void)
 int StreamTcpCheckMemcap(uint64_t size)
 {
     uint64_t memcapcopy = SC_ATOMIC_GET(stream_config.memcap);
-    if (memcapcopy == 0 || size + SC_ATOMIC_GET(st_memuse) <= memcapcopy)
+    if (memcapcopy == 0 || MemcapCreditCheck(MEMCAP_CREDIT_STREAM, size, memcapcopy))
         return 1;
     return 0;
 }
@@ -180,7 +186,7 @@ int StreamTcpCheckMemcap(uint64_t size)
  */
 int StreamTcpSetMemcap(uint64_t size)
 {
-    if (size == 0 || (uint64_t)SC_ATOMIC_GET(st_memuse) < size) {
+    if (size == 0 || StreamTcpMemuseCounter() < size) {
         SC_ATOMIC_SET(stream_config.memcap, size);
         return 1;
     }
@@ -204,6 +210,7 @@ void StreamTcpStreamCleanup(TcpStream *stream)
     if (stream != NULL) {
         StreamTcpSackFreeList(stream);
         StreamTcpReturnStreamSegments(stream);
+        StreamTcpReassembleCompressedFree(stream);
         StreamingBufferClear(&stream->sb);
     }
 }
@@ -890,6 +897,77 @@ static int StreamTcpPacketIsRetransmission(TcpStream *stream, Packet *p)
     SCReturnInt(0);
 }
 
+/**
+ *  \internal
+ *  \brief  Set up a session for a flow that was promoted from the embryonic
+ *          flow table, as if its SYN had been processed by
+ *          StreamTcpPacketStateNone().
+ *
+ *  If the packet travels in the opposite direction of the SYN, packet and
+ *  flow are swapped so the SYN sender is the client.
+ *
+ *  \retval ssn session in TCP_SYN_SENT state or NULL if there was no
+ *              embryonic entry for this packet
+ */
+static TcpSession *StreamTcpEmbryonicPromote(ThreadVars *tv, Packet *p,
+        StreamTcpThread *stt)
+{
+    FlowEmbryonicSyn syn;
+    bool reversed = false;
+
+    if (FlowEmbryonicTake(p, &syn, &reversed) == 0)
+        return NULL;
+
+    TcpSession *ssn = StreamTcpNewSession(p, stt->ssn_pool_id);
+    if (ssn == NULL) {
+        StatsIncr(tv, stt->counter_tcp_ssn_memcap);
+        return NULL;
+    }
+    StatsIncr(tv, stt->counter_tcp_sessions);
+
+    if (reversed) {
+        SCLogDebug("embryonic SYN was sent by packet destination, reversing "
+                "flow and packet");
+        PacketSwap(p);
+        FlowSwap(p->flow);
+    }
+
+    StreamTcpPacketSetState(p, ssn, TCP_SYN_SENT);
+    SCLogDebug("ssn %p: =~ embryonic ssn state is now TCP_SYN_SENT", ssn);
+
+    if (stream_config.async_oneside) {
+        SCLogDebug("ssn %p: =~ ASYNC", ssn);
+        ssn->flags |= STREAMTCP_FLAG_ASYNC;
+    }
+
+    ssn->tcp_packet_flags |= TH_SYN;
+    ssn->client.tcp_flags |= TH_SYN;
+
+    ssn->client.isn = syn.seq;
+    STREAMTCP_SET_RA_BASE_SEQ(&ssn->client, ssn->client.isn);
+    ssn->client.next_seq = ssn->client.isn + 1;
+
+    if (syn.flags & FLOW_EMBRYONIC_HAS_TS) {
+        ssn->client.last_ts = syn.tsval;
+        if (ssn->client.last_ts == 0)
+            ssn->client.flags |= STREAMTCP_STREAM_FLAG_ZERO_TIMESTAMP;
+        ssn->client.last_pkt_ts = syn.ts;
+        ssn->client.flags |= STREAMTCP_STREAM_FLAG_TIMESTAMP;
+    }
+
+    ssn->server.window = syn.win;
+    if (syn.flags & FLOW_EMBRYONIC_HAS_WSCALE) {
+        ssn->flags |= STREAMTCP_FLAG_SERVER_WSCALE;
+        ssn->server.wscale = syn.wscale;
+    }
+
+    if (syn.flags & FLOW_EMBRYONIC_SACKOK) {
+        ssn->flags |= STREAMTCP_FLAG_CLIENT_SACKOK;
+    }
+
+    return ssn;
+}
+
 /**
  *  \internal
  *  \brief  Function to handle the TCP_CLOSED or NONE state. The function handles
@@ -4648,6 +4726,109 @@ static int StreamTcpPacketIsBadWindowUpdate(TcpSession *ssn, Packet *p)
     return 0;
 }
 
+/** \internal
+ *  \brief check if a packet can take the established fast path
+ *
+ *  The fast path covers the common case of an in order, in window data or
+ *  ACK packet in the ESTABLISHED state. Anything that could be a keep
+ *  alive, (bad) window update, zero window probe, retransmission or that
+ *  needs the async/midstream handling is left to the full state machine.
+ *
+ *  \retval true packet is handled by StreamTcpPacketFastPath()
+ */
+static inline bool StreamTcpPacketIsFastPath(const TcpSession *ssn, const Packet *p)
+{
+    if (ssn->state != TCP_ESTABLISHED)
+        return false;
+
+    /* only ACK, optionally with PSH */
+    if ((p->tcph->th_flags & ~TH_PUSH) != TH_ACK)
+        return false;
+
+    if (ssn->flags & (STREAMTCP_FLAG_ASYNC|STREAMTCP_FLAG_MIDSTREAM_ESTABLISHED))
+        return false;
+
+    const TcpStream *stream, *ostream;
+    if (PKT_IS_TOSERVER(p)) {
+        stream = &ssn->client;
+        ostream = &ssn->server;
+    } else {
+        stream = &ssn->server;
+        ostream = &ssn->client;
+    }
+
+    /* keep alive (ACK) tracking needs the slow path to clear it */
+    if ((stream->flags | ostream->flags) & STREAMTCP_STREAM_FLAG_KEEPALIVE)
+        return false;
+
+    const uint32_t seq = TCP_GET_SEQ(p);
+    const uint32_t ack = TCP_GET_ACK(p);
+
+    /* expected packet */
+    if (seq != stream->next_seq)
+        return false;
+    /* zero window probe */
+    if (stream->window == 0)
+        return false;
+    /* before last_ack or out of window */
+    if (!SEQ_GEQ(seq + p->payload_len, stream->last_ack) ||
+        !SEQ_LEQ(seq + p->payload_len, stream->next_win))
+        return false;
+    /* same checks as the fast track in StreamTcpValidateAck() */
+    if (!(SEQ_EQ(ack, ostream->last_ack) ||
+          (SEQ_GT(ack, ostream->last_ack) && SEQ_LEQ(ack, ostream->next_win))))
+        return false;
+
+    return true;
+}
+
+/** \internal
+ *  \brief handle an in order, in window packet in the ESTABLISHED state
+ *
+ *  Performs the same updates as StreamTcpPacketStateEstablished() and
+ *  HandleEstablishedPacketToServer()/HandleEstablishedPacketToClient() do
+ *  for packets accepted by StreamTcpPacketIsFastPath().
+ *
+ *  \retval 0 ok
+ *  \retval -1 invalid timestamp
+ */
+static int StreamTcpPacketFastPath(ThreadVars *tv, StreamTcpThread *stt,
+        TcpSession *ssn, Packet *p, PacketQueueNoLock *pq)
+{
+    if (ssn->flags & STREAMTCP_FLAG_TIMESTAMP) {
+        if (!StreamTcpValidateTimestamp(ssn, p))
+            return -1;
+    }
+
+    TcpStream *stream, *ostream;
+    if (PKT_IS_TOSERVER(p)) {
+        stream = &ssn->client;
+        ostream = &ssn->server;
+    } else {
+        stream = &ssn->server;
+        ostream = &ssn->client;
+        ssn->flags |= STREAMTCP_FLAG_3WHS_CONFIRMED;
+    }
+    SCLogDebug("ssn %p: fast path pkt (%" PRIu32 "): SEQ %" PRIu32 ", ACK %" PRIu32,
+            ssn, p->payload_len, TCP_GET_SEQ(p), TCP_GET_ACK(p));
+
+    StreamTcpUpdateNextSeq(ssn, stream, (stream->next_seq + p->payload_len));
+
+    ostream->window = TCP_GET_WINDOW(p) << ostream->wscale;
+    StreamTcpUpdateLastAck(ssn, ostream, TCP_GET_ACK(p));
+
+    if (ssn->flags & STREAMTCP_FLAG_TIMESTAMP) {
+        StreamTcpHandleTimestamp(ssn, p);
+    }
+
+    StreamTcpSackUpdatePacket(ostream, p);
+
+    StreamTcpUpdateNextWin(ssn, ostream, (ostream->last_ack + ostream->window));
+
+    StreamTcpReassembleHandleSegment(tv, stt->ra_ctx, ssn, stream, p, pq);
+    return 0;
+}
+
 /** \internal
  *  \brief call packet handling function for 'state'
  *  \param state current TCP state
@@ -4758,6 +4939,11 @@ int StreamTcpPacket (ThreadVars *tv, Packet *p, StreamTcpThread *stt,
 
     TcpSession *ssn = (TcpSession *)p->flow->protoctx;
 
+    /* first packet of a flow whose SYN went into the embryonic table */
+    if (ssn == NULL && flow_embryonic_enabled) {
+        ssn = StreamTcpEmbryonicPromote(tv, p, stt);
+    }
+
     /* track TCP flags */
     if (ssn != NULL) {
         ssn->tcp_packet_flags |= p->tcph->th_flags;
@@ -4838,6 +5024,14 @@ int StreamTcpPacket (ThreadVars *tv, Packet *p, StreamTcpThread *stt,
             p->flags |= PKT_STREAM_NO_EVENTS;
         }
 
+        /* common case: in order data or ACK on an established session */
+        if (likely(StreamTcpPacketIsFastPath(ssn, p))) {
+            StatsIncr(tv, stt->counter_tcp_fastpath);
+            if (StreamTcpPacketFastPath(tv, stt, ssn, p, &stt->pseudo_queue) < 0)
+                goto error;
+            goto skip;
+        }
+
         if (StreamTcpPacketIsKeepAlive(ssn, p) == 1) {
             goto skip;
         }
@@ -5177,6 +5371,13 @@ TmEcode StreamTcp (ThreadVars *tv, Packet *p, void *data, PacketQueueNoLock *pq)
 
     /* only TCP packets with a flow from here */
 
+    /* restore data compressed by the flow manager while the flow was idle */
+    TcpSession *ssn = (TcpSession *)p->flow->protoctx;
+    if (ssn != NULL && unlikely((ssn->client.flags | ssn->server.flags) &
+                STREAMTCP_STREAM_FLAG_COMPRESSED)) {
+        StreamTcpReassembleDecompressSession(ssn);
+    }
+
     if (!(p->flags & PKT_PSEUDO_STREAM_END)) {
         if (stream_config.flags & STREAMTCP_INIT_FLAG_CHECKSUM_VALIDATION) {
             if (StreamTcpValidateChecksum(p) == 0) {
@@ -5218,6 +5419,7 @@ TmEcode StreamTcpThreadInit(ThreadVars *tv, void *initdata, void **data)
     stt->counter_tcp_rst = StatsRegisterCounter("tcp.rst", tv);
     stt->counter_tcp_midstream_pickups = StatsRegisterCounter("tcp.midstream_pickups", tv);
     stt->counter_tcp_wrong_thread = StatsRegisterCounter("tcp.pkt_on_wrong_thread", tv);
+    stt->counter_tcp_fastpath = StatsRegisterCounter("tcp.fastpath", tv);
 
     /* init reassembly ctx */
     stt->ra_ctx = StreamTcpReassembleInitThreadCtx(tv);
@@ -8632,7 +8834,7 @@ static int StreamTcpTest23(void)
     SCFree(p);
     FLOW_DESTROY(&f);
     StreamTcpUTDeinit(stt.ra_ctx);
-    FAIL_IF(SC_ATOMIC_GET(st_memuse) > 0);
+    FAIL_IF(StreamTcpMemuseCounter() > 0);
     PASS;
 }
 
@@ -8698,7 +8900,7 @@ static int StreamTcpTest24(void)
     SCFree(p);
     FLOW_DESTROY(&f);
     StreamTcpUTDeinit(stt.ra_ctx);
-    FAIL_IF(SC_ATOMIC_GET(st_memuse) > 0);
+    FAIL_IF(StreamTcpMemuseCounter() > 0);
     PASS;
 }
 
@@ -8989,13 +9191,13 @@ static int StreamTcpTest28(void)
     StreamTcpThread stt;
     StreamTcpUTInit(&stt.ra_ctx);
 
-    uint32_t memuse = SC_ATOMIC_GET(st_memuse);
+    uint32_t memuse = StreamTcpMemuseCounter();
 
     StreamTcpIncrMemuse(500);
-    FAIL_IF(SC_ATOMIC_GET(st_memuse) != (memuse+500));
+    FAIL_IF(StreamTcpMemuseCounter() != (memuse+500));
 
     StreamTcpDecrMemuse(500);
-    FAIL_IF(SC_ATOMIC_GET(st_memuse) != memuse);
+    FAIL_IF(StreamTcpMemuseCounter() != memuse);
 
     FAIL_IF(StreamTcpCheckMemcap(500) != 1);
 
@@ -9003,7 +9205,7 @@ static int StreamTcpTest28(void)
 
     StreamTcpUTDeinit(stt.ra_ctx);
 
-    FAIL_IF(SC_ATOMIC_GET(st_memuse) != 0);
+    FAIL_IF(StreamTcpMemuseCounter() != 0);
     PASS;
 }
 
@@ -10649,6 +10851,193 @@ end:
     return ret;
 }
 
+/** \internal
+ *  \brief set up an established session with a 3whs for the fast path tests
+ */
+static TcpSession *StreamTcpFastPathSetup(ThreadVars *tv, StreamTcpThread *stt,
+        Packet *p, PacketQueueNoLock *pq)
+{
+    p->tcph->th_win = htons(5480);
+    p->tcph->th_flags = TH_SYN;
+    p->tcph->th_seq = htonl(100);
+    p->flowflags = FLOW_PKT_TOSERVER;
+    if (StreamTcpPacket(tv, p, stt, pq) == -1)
+        return NULL;
+
+    p->tcph->th_seq = htonl(500);
+    p->tcph->th_ack = htonl(101);
+    p->tcph->th_flags = TH_SYN | TH_ACK;
+    p->flowflags = FLOW_PKT_TOCLIENT;
+    if (StreamTcpPacket(tv, p, stt, pq) == -1)
+        return NULL;
+
+    p->tcph->th_seq = htonl(101);
+    p->tcph->th_ack = htonl(501);
+    p->tcph->th_flags = TH_ACK;
+    p->flowflags = FLOW_PKT_TOSERVER;
+    if (StreamTcpPacket(tv, p, stt, pq) == -1)
+        return NULL;
+
+    TcpSession *ssn = p->flow->protoctx;
+    if (ssn == NULL || ssn->state != TCP_ESTABLISHED)
+        return NULL;
+    return ssn;
+}
+
+/**
+ *  \test  in order data and ACKs take the fast path and update the
+ *         session the same way the state machine does.
+ */
+static int StreamTcpTest46 (void)
+{
+    Flow f;
+    ThreadVars tv;
+    StreamTcpThread stt;
+    TCPHdr tcph;
+    PacketQueueNoLock pq;
+    uint8_t payload[4];
+    Packet *p = SCMalloc(SIZE_OF_PACKET);
+    FAIL_IF_NULL(p);
+    memset(p, 0, SIZE_OF_PACKET);
+    memset(&pq, 0, sizeof(pq));
+    memset(&f, 0, sizeof(Flow));
+    memset(&tv, 0, sizeof(ThreadVars));
+    memset(&stt, 0, sizeof(StreamTcpThread));
+    memset(&tcph, 0, sizeof(TCPHdr));
+
+    StreamTcpUTInit(&stt.ra_ctx);
+    FLOW_INITIALIZE(&f);
+    p->flow = &f;
+    p->tcph = &tcph;
+
+    TcpSession *ssn = StreamTcpFastPathSetup(&tv, &stt, p, &pq);
+    FAIL_IF_NULL(ssn);
+
+    /* in order data to server */
+    p->tcph->th_seq = htonl(101);
+    p->tcph->th_ack = htonl(501);
+    p->tcph->th_flags = TH_PUSH | TH_ACK;
+    p->flowflags = FLOW_PKT_TOSERVER;
+    StreamTcpCreateTestPacket(payload, 0x41, 3, 4); /*AAA*/
+    p->payload = payload;
+    p->payload_len = 3;
+    FAIL_IF_NOT(StreamTcpPacketIsFastPath(ssn, p));
+    FAIL_IF(StreamTcpPacket(&tv, p, &stt, &pq) == -1);
+    FAIL_IF_NOT(ssn->client.next_seq == 104);
+
+    /* ACK from the server */
+    p->tcph->th_seq = htonl(501);
+    p->tcph->th_ack = htonl(104);
+    p->tcph->th_flags = TH_ACK;
+    p->flowflags = FLOW_PKT_TOCLIENT;
+    p->payload = NULL;
+    p->payload_len = 0;
+    FAIL_IF_NOT(StreamTcpPacketIsFastPath(ssn, p));
+    FAIL_IF(StreamTcpPacket(&tv, p, &stt, &pq) == -1);
+    FAIL_IF_NOT(ssn->client.last_ack == 104);
+    FAIL_IF_NOT(ssn->flags & STREAMTCP_FLAG_3WHS_CONFIRMED);
+
+    /* retransmission is left to the state machine */
+    p->tcph->th_seq = htonl(101);
+    p->tcph->th_ack = htonl(501);
+    p->tcph->th_flags = TH_PUSH | TH_ACK;
+    p->flowflags = FLOW_PKT_TOSERVER;
+    p->payload = payload;
+    p->payload_len = 3;
+    FAIL_IF(StreamTcpPacketIsFastPath(ssn, p));
+
+    /* as is a packet with an ack beyond what was sent */
+    p->tcph->th_seq = htonl(104);
+    p->tcph->th_ack = htonl(100000);
+    FAIL_IF(StreamTcpPacketIsFastPath(ssn, p));
+
+    /* and a FIN */
+    p->tcph->th_ack = htonl(501);
+    p->tcph->th_flags = TH_FIN | TH_ACK;
+    FAIL_IF(StreamTcpPacketIsFastPath(ssn, p));
+
+    StreamTcpSessionClear(p->flow->protoctx);
+    SCFree(p);
+    FLOW_DESTROY(&f);
+    StreamTcpUTDeinit(stt.ra_ctx);
+    PASS;
+}
+
+/**
+ *  \test  benchmark the fast path against the full state machine for
+ *         in order ACKs on an established session.
+ */
+static int StreamTcpTest47 (void)
+{
+    Flow f;
+    ThreadVars tv;
+    StreamTcpThread stt;
+    TCPHdr tcph;
+    PacketQueueNoLock pq;
+    Packet *p = SCMalloc(SIZE_OF_PACKET);
+    FAIL_IF_NULL(p);
+    memset(p, 0, SIZE_OF_PACKET);
+    memset(&pq, 0, sizeof(pq));
+    memset(&f, 0, sizeof(Flow));
+    memset(&tv, 0, sizeof(ThreadVars));
+    memset(&stt, 0, sizeof(StreamTcpThread));
+    memset(&tcph, 0, sizeof(TCPHdr));
+
+    StreamTcpUTInit(&stt.ra_ctx);
+    FLOW_INITIALIZE(&f);
+    p->flow = &f;
+    p->tcph = &tcph;
+
+    TcpSession *ssn = StreamTcpFastPathSetup(&tv, &stt, p, &pq);
+    FAIL_IF_NULL(ssn);
+
+    const int loops = 1000000;
+    p->tcph->th_flags = TH_ACK;
+
+    uint64_t ticks_start = UtilCpuGetTicks();
+    for (int i = 0; i < loops; i++) {
+        if (i & 1) {
+            p->tcph->th_seq = htonl(501);
+            p->tcph->th_ack = htonl(101);
+            p->flowflags = FLOW_PKT_TOCLIENT;
+        } else {
+            p->tcph->th_seq = htonl(101);
+            p->tcph->th_ack = htonl(501);
+            p->flowflags = FLOW_PKT_TOSERVER;
+        }
+        FAIL_IF(StreamTcpStateDispatch(&tv, p, &stt, ssn, &stt.pseudo_queue, ssn->state) < 0);
+    }
+    uint64_t ticks_slow = UtilCpuGetTicks() - ticks_start;
+
+    ticks_start = UtilCpuGetTicks();
+    for (int i = 0; i < loops; i++) {
+        if (i & 1) {
+            p->tcph->th_seq = htonl(501);
+            p->tcph->th_ack = htonl(101);
+            p->flowflags = FLOW_PKT_TOCLIENT;
+        } else {
+            p->tcph->th_seq = htonl(101);
+            p->tcph->th_ack = htonl(501);
+            p->flowflags = FLOW_PKT_TOSERVER;
+        }
+        FAIL_IF_NOT(StreamTcpPacketIsFastPath(ssn, p));
+        FAIL_IF(StreamTcpPacketFastPath(&tv, &stt, ssn, p, &stt.pseudo_queue) < 0);
+    }
+    uint64_t ticks_fast = UtilCpuGetTicks() - ticks_start;
+
+    SCLogInfo("%d ACKs: state machine %"PRIu64" ticks/pkt, fast path %"PRIu64" ticks/pkt",
+            loops, ticks_slow / loops, ticks_fast / loops);
+
+    FAIL_IF_NOT(ssn->client.next_seq == 101);
+    FAIL_IF_NOT(ssn->server.next_seq == 501);
+
+    StreamTcpSessionClear(p->flow->protoctx);
+    SCFree(p);
+    FLOW_DESTROY(&f);
+    StreamTcpUTDeinit(stt.ra_ctx);
+    PASS;
+}
+
 #endif /* UNITTESTS */
 
 void StreamTcpRegisterTests (void)
@@ -10722,6 +11111,9 @@ void StreamTcpRegisterTests (void)
     UtRegisterTest("StreamTcpTest43 -- SYN/ACK queue", StreamTcpTest43);
     UtRegisterTest("StreamTcpTest44 -- SYN/ACK queue", StreamTcpTest44);
     UtRegisterTest("StreamTcpTest45 -- SYN/ACK queue", StreamTcpTest45);
+    UtRegisterTest("StreamTcpTest46 -- established fast path", StreamTcpTest46);
+    UtRegisterTest("StreamTcpTest47 -- established fast path benchmark",
+                   StreamTcpTest47);
 
     /* set up the reassembly tests as well */
     StreamTcpReassembleRegisterTests();
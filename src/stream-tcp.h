@@ -64,6 +64,10 @@ typedef struct TcpStreamCnf_ {
 
     bool streaming_log_api;
 
+    bool reassembly_compress;           /**< compress retained data of idle flows */
+    uint32_t reassembly_compress_idle;  /**< idle time in seconds before compressing */
+    uint32_t reassembly_compress_pct;   /**< reassembly memcap percentage before compressing */
+
     StreamingBufferConfig sbcnf;
 } TcpStreamCnf;
 
@@ -98,6 +102,8 @@ typedef struct StreamTcpThread_ {
     uint16_t counter_tcp_midstream_pickups;
     /** wrong thread */
     uint16_t counter_tcp_wrong_thread;
+    /** established in order packets handled by the fast path */
+    uint16_t counter_tcp_fastpath;
 
     /** tcp reassembly thread data */
     TcpReassemblyThreadCtx *ra_ctx;
@@ -127,7 +133,8 @@ int StreamTcpSegmentForEach(const Packet *p, uint8_t flag,
 void StreamTcpReassembleConfigEnableOverlapCheck(void);
 void TcpSessionSetReassemblyDepth(TcpSession *ssn, uint32_t size);
 
-typedef int (*StreamReassembleRawFunc)(void *data, const uint8_t *input, const uint32_t input_len);
+typedef int (*StreamReassembleRawFunc)(
+        void *data, const uint8_t *input, const uint32_t input_len, const uint64_t offset);
 
 int StreamReassembleLog(TcpSession *ssn, TcpStream *stream,
         StreamReassembleRawFunc Callback, void *cb_data,
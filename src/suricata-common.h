@@ -483,6 +483,7 @@ typedef enum {
     LOGGER_TCP_DATA,
     LOGGER_JSON_FLOW,
     LOGGER_JSON_NETFLOW,
+    LOGGER_JSON_TX_SUMMARY,
     LOGGER_STATS,
     LOGGER_JSON_STATS,
     LOGGER_PRELUDE,
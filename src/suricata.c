@@ -107,6 +107,8 @@
 #include "flow-bypass.h"
 #include "flow-var.h"
 #include "flow-bit.h"
+#include "flow-cpu-cost.h"
+#include "output-json-tx-summary.h"
 #include "pkt-var.h"
 #include "host-bit.h"
 
@@ -168,6 +170,7 @@
 #include "util-proto-name.h"
 #include "util-mpm-hs.h"
 #include "util-storage.h"
+#include "util-memcap-credit.h"
 #include "host-storage.h"
 
 #include "util-lua.h"
@@ -2061,6 +2064,11 @@ void PostRunDeinit(const int runmode, struct timeval *start_time)
     SCPrintElapsedTime(start_time);
     FlowDisableFlowRecyclerThread();
 
+    /* the packet threads returned their memcap credit on exit, return the
+     * credit the main thread reserved during setup before the final stats
+     * are dumped */
+    MemcapCreditThreadRelease();
+
     /* kill the stats threads */
     TmThreadKillThreadsFamily(TVT_MGMT);
     TmThreadClearThreadsFamily(TVT_MGMT);
@@ -2081,6 +2089,8 @@ void PostRunDeinit(const int runmode, struct timeval *start_time)
     HostCleanup();
     StreamTcpFreeConfig(STREAM_VERBOSE);
     DefragDestroy();
+    /* freeing the flows and sessions above credited the main thread */
+    MemcapCreditThreadRelease();
 
     TmqResetQueues();
 #ifdef PROFILING
@@ -2490,6 +2500,11 @@ int PostConfLoadedSetup(SCInstance *suri)
     RegisterFlowBypassInfo();
 
     MacSetRegisterFlowStorage();
+    FlowCpuCostRegister();
+    OutputTxSummaryRegister();
+    SRepFlowStorageRegister();
+
+    MemcapCreditInitConfig();
 
     AppLayerSetup();
 
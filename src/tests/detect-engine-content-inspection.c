@@ -263,6 +263,56 @@ static int DetectEngineContentInspectionTest13(void) {
     TEST_FOOTER;
 }
 
+/** \test compiled programs */
+static int DetectEngineContentInspectionTest14(void) {
+    DetectEngineCtx *de_ctx = DetectEngineCtxInit();
+    FAIL_IF_NULL(de_ctx);
+
+    Signature *s = DetectEngineAppendSig(de_ctx, "alert tcp any any -> any any "
+            "(content:\"a\"; content:\"b\"; distance:0; sid:1;)");
+    FAIL_IF_NULL(s);
+    Signature *s2 = DetectEngineAppendSig(de_ctx, "alert tcp any any -> any any "
+            "(content:\"a\"; pcre:\"/b/R\"; content:!\"c\"; content:\"d\"; sid:2;)");
+    FAIL_IF_NULL(s2);
+    SigGroupBuild(de_ctx);
+
+    const SigMatchData *smd = s->sm_arrays[DETECT_SM_LIST_PMATCH];
+    FAIL_IF_NOT(smd[0].ci_op == DETECT_CI_OP_CONTENT);
+    FAIL_IF_NOT(smd[1].ci_op == DETECT_CI_OP_CONTENT_REL);
+
+    /* only the tail after the pcre and the negated content is compiled */
+    smd = s2->sm_arrays[DETECT_SM_LIST_PMATCH];
+    FAIL_IF_NOT(smd[0].ci_op == DETECT_CI_OP_NONE);
+    FAIL_IF_NOT(smd[1].ci_op == DETECT_CI_OP_NONE);
+    FAIL_IF_NOT(smd[2].ci_op == DETECT_CI_OP_NONE);
+    FAIL_IF_NOT(smd[3].ci_op == DETECT_CI_OP_CONTENT);
+
+    DetectEngineCtxFree(de_ctx);
+    PASS;
+}
+
+/** \test program longer than DETECT_CI_PROG_MAX */
+static int DetectEngineContentInspectionTest15(void) {
+    TEST_HEADER;
+    TEST_RUN("abcdefghijklmnopqrs", 19,
+            "content:\"a\"; content:\"b\"; distance:0; content:\"c\"; distance:0; "
+            "content:\"d\"; distance:0; content:\"e\"; distance:0; content:\"f\"; distance:0; "
+            "content:\"g\"; distance:0; content:\"h\"; distance:0; content:\"i\"; distance:0; "
+            "content:\"j\"; distance:0; content:\"k\"; distance:0; content:\"l\"; distance:0; "
+            "content:\"m\"; distance:0; content:\"n\"; distance:0; content:\"o\"; distance:0; "
+            "content:\"p\"; distance:0; content:\"q\"; distance:0; content:\"r\"; distance:0; "
+            "content:\"s\"; distance:0;", true, 19);
+    TEST_RUN("abcdefghijklmnopqrsabcdefghijklmnopqrs", 38,
+            "content:\"a\"; content:\"b\"; distance:0; content:\"c\"; distance:0; "
+            "content:\"d\"; distance:0; content:\"e\"; distance:0; content:\"f\"; distance:0; "
+            "content:\"g\"; distance:0; content:\"h\"; distance:0; content:\"i\"; distance:0; "
+            "content:\"j\"; distance:0; content:\"k\"; distance:0; content:\"l\"; distance:0; "
+            "content:\"m\"; distance:0; content:\"n\"; distance:0; content:\"o\"; distance:0; "
+            "content:\"p\"; distance:0; content:\"q\"; distance:0; content:\"r\"; distance:0; "
+            "content:\"s\"; within:1; distance:0; content:\"x\"; distance:0;", false, 20);
+    TEST_FOOTER;
+}
+
 void DetectEngineContentInspectionRegisterTests(void)
 {
     UtRegisterTest("DetectEngineContentInspectionTest01",
@@ -291,6 +341,10 @@ void DetectEngineContentInspectionRegisterTests(void)
                    DetectEngineContentInspectionTest12);
     UtRegisterTest("DetectEngineContentInspectionTest13 mix startswith/endswith",
                    DetectEngineContentInspectionTest13);
+    UtRegisterTest("DetectEngineContentInspectionTest14 compile",
+                   DetectEngineContentInspectionTest14);
+    UtRegisterTest("DetectEngineContentInspectionTest15 long program",
+                   DetectEngineContentInspectionTest15);
 }
 
 #undef TEST_HEADER
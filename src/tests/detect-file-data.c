@@ -509,6 +509,55 @@ static int DetectFiledataIsdataatParseTest2(void)
     PASS;
 }
 
+static int DetectFiledataMaxDepthTest01(void)
+{
+    DetectEngineCtx *de_ctx = DetectEngineCtxInit();
+    FAIL_IF_NULL(de_ctx);
+    de_ctx->flags |= DE_QUIET;
+
+    Signature *s = DetectEngineAppendSig(de_ctx,
+            "alert http any any -> any any ("
+            "file_data; content:\"abc\"; depth:10; "
+            "content:\"def\"; distance:2; within:6; sid:1;)");
+    FAIL_IF_NULL(s);
+    s = DetectEngineAppendSig(de_ctx,
+            "alert http any any -> any any ("
+            "file_data; content:\"ghi\"; offset:4; depth:3; sid:2;)");
+    FAIL_IF_NULL(s);
+    DetectFiledataSetupMaxDepth(de_ctx);
+    FAIL_IF_NOT(de_ctx->filedata_max_depth == 18);
+
+    /* unbounded content */
+    s = DetectEngineAppendSig(de_ctx,
+            "alert http any any -> any any ("
+            "file_data; content:\"jkl\"; sid:3;)");
+    FAIL_IF_NULL(s);
+    DetectFiledataSetupMaxDepth(de_ctx);
+    FAIL_IF_NOT(de_ctx->filedata_max_depth == 0);
+
+    DetectEngineCtxFree(de_ctx);
+    PASS;
+}
+
+static int DetectFiledataMaxDepthTest02(void)
+{
+    DetectEngineCtx *de_ctx = DetectEngineCtxInit();
+    FAIL_IF_NULL(de_ctx);
+    de_ctx->flags |= DE_QUIET;
+
+    /* other keywords may look at the whole buffer */
+    Signature *s = DetectEngineAppendSig(de_ctx,
+            "alert http any any -> any any ("
+            "file_data; content:\"abc\"; depth:10; "
+            "isdataat:100,relative; sid:1;)");
+    FAIL_IF_NULL(s);
+    DetectFiledataSetupMaxDepth(de_ctx);
+    FAIL_IF_NOT(de_ctx->filedata_max_depth == 0);
+
+    DetectEngineCtxFree(de_ctx);
+    PASS;
+}
+
 void DetectFiledataRegisterTests(void)
 {
     UtRegisterTest("DetectEngineSMTPFiledataTest01",
@@ -528,6 +577,9 @@ void DetectFiledataRegisterTests(void)
             DetectFiledataIsdataatParseTest1);
     UtRegisterTest("DetectFiledataIsdataatParseTest2",
             DetectFiledataIsdataatParseTest2);
+
+    UtRegisterTest("DetectFiledataMaxDepthTest01", DetectFiledataMaxDepthTest01);
+    UtRegisterTest("DetectFiledataMaxDepthTest02", DetectFiledataMaxDepthTest02);
 }
 
 #endif
@@ -84,6 +84,9 @@ typedef struct OutputCtx_ {
     void (*DeInit)(struct OutputCtx_ *);
 
     TAILQ_HEAD(, OutputModule_) submodules;
+
+    /** Optional rate limit / sampling of the output's events. */
+    struct OutputLimit_ *limit;
 } OutputCtx;
 
 TmModule *TmModuleGetByName(const char *name);
@@ -34,6 +34,7 @@
 #include "tm-queuehandlers.h"
 #include "tm-threads.h"
 #include "tmqh-packetpool.h"
+#include "flow-timeout.h"
 #include "threads.h"
 #include "util-debug.h"
 #include "util-privs.h"
@@ -41,6 +42,7 @@
 #include "util-optimize.h"
 #include "util-profiling.h"
 #include "util-signal.h"
+#include "util-memcap-credit.h"
 #include "queue.h"
 
 #ifdef PROFILE_LOCKING
@@ -181,6 +183,10 @@ static int TmThreadTimeoutLoop(ThreadVars *tv, TmSlot *s)
                 }
             }
         } else {
+            /* help the main thread walk the flow hash at shutdown */
+            if (FlowForceReassemblyDrainChunk() > 0) {
+                continue;
+            }
             if (TmThreadsCheckFlag(tv, THV_KILL)) {
                 break;
             }
@@ -348,6 +354,8 @@ static void *TmThreadsSlotPktAcqLoop(void *td)
         }
     }
 
+    MemcapCreditThreadRelease();
+
     tv->stream_pq = NULL;
     SCLogDebug("%s ending", tv->name);
     TmThreadsSetFlag(tv, THV_CLOSED);
@@ -490,6 +498,8 @@ static void *TmThreadsSlotVar(void *td)
         }
     }
 
+    MemcapCreditThreadRelease();
+
     SCLogDebug("%s ending", tv->name);
     tv->stream_pq = NULL;
     TmThreadsSetFlag(tv, THV_CLOSED);
@@ -564,6 +574,8 @@ static void *TmThreadsManagement(void *td)
         }
     }
 
+    MemcapCreditThreadRelease();
+
     TmThreadsSetFlag(tv, THV_CLOSED);
     pthread_exit((void *) 0);
     return NULL;
@@ -34,6 +34,7 @@
 #include "util-file-swf-decompression.h"
 #include "util-misc.h"
 #include "util-print.h"
+#include "util-cpu.h"
 
 #define SWF_ZLIB_MIN_VERSION    0x06
 #define SWF_LZMA_MIN_VERSION    0x0D
@@ -61,6 +62,7 @@ int FileIsSwfFile(const uint8_t *buffer, uint32_t buffer_len)
  * \param buffer_len compressed buffer length
  * \param decompressed_buffer buffer that store decompressed data
  * \param decompressed_buffer_len decompressesd data length
+ * \param ctx per thread decompression workspace, or NULL
  * \param swf_type decompression algorithm to use
  * \param decompress_depth how much decompressed data we want to store
  * \param compress_depth how much compressed data we want to decompress
@@ -70,6 +72,7 @@ int FileIsSwfFile(const uint8_t *buffer, uint32_t buffer_len)
  */
 int FileSwfDecompression(const uint8_t *buffer, uint32_t buffer_len,
                          DetectEngineThreadCtx *det_ctx,
+                         FileSwfDecompressCtx *ctx,
                          InspectionBuffer *out_buffer,
                          int swf_type,
                          uint32_t decompress_depth,
@@ -104,6 +107,7 @@ int FileSwfDecompression(const uint8_t *buffer, uint32_t buffer_len,
     } else if (compress_depth > 0 && compress_depth > buffer_len) {
         compressed_data_len = buffer_len;
     }
+    compressed_data_len = MIN(compressed_data_len, buffer_len - offset);
 
     /* get swf version */
     uint8_t swf_version = FileGetSwfVersion(buffer, buffer_len);
@@ -148,7 +152,9 @@ int FileSwfDecompression(const uint8_t *buffer, uint32_t buffer_len,
     out_buffer->buf[2] = 'S';
     out_buffer->buf[3] = swf_version;
     memcpy(out_buffer->buf + 4, &decompressed_swf_len, 4);
-    memset(out_buffer->buf + 8, 0, decompressed_data_len - 8);
+
+    uint32_t produced = 0;
+    const uint64_t ticks_start = UtilCpuGetTicks();
 
     if ((swf_type == HTTP_SWF_COMPRESSION_ZLIB || swf_type == HTTP_SWF_COMPRESSION_BOTH) &&
             compression_type == FILE_SWF_ZLIB_COMPRESSION)
@@ -156,41 +162,33 @@ int FileSwfDecompression(const uint8_t *buffer, uint32_t buffer_len,
         /* the first 8 bytes represents the fws header, see 'FWS format' above.
          * data will start from 8th bytes
          */
-        r = FileSwfZlibDecompression(det_ctx,
+        r = FileSwfZlibDecompression(det_ctx, ctx,
                                      (uint8_t *)buffer + offset, compressed_data_len,
-                                     out_buffer->buf + 8, out_buffer->len - 8);
-        if (r == 0)
-            goto error;
-
+                                     out_buffer->buf + 8, out_buffer->len - 8, &produced);
     } else if ((swf_type == HTTP_SWF_COMPRESSION_LZMA || swf_type == HTTP_SWF_COMPRESSION_BOTH) &&
                compression_type == FILE_SWF_LZMA_COMPRESSION)
     {
-        /* we need to setup the lzma header */
-        /*
-         * | 5 bytes         | 8 bytes             | n bytes         |
-         * | LZMA properties | Uncompressed length | Compressed data |
-         */
-        compressed_data_len += 13;
-        uint8_t compressed_data[compressed_data_len];
-        /* put lzma properties */
-        memcpy(compressed_data, buffer + 12, 5);
-        /* put lzma end marker */
-        memset(compressed_data + 5, 0xFF, 8);
-        /* put compressed data */
-        memcpy(compressed_data + 13, buffer + offset, compressed_data_len - 13);
-
-        /* the first 8 bytes represents the fws header, see 'FWS format' above.
-         * data will start from 8th bytes
-         */
-        r = FileSwfLzmaDecompression(det_ctx,
-                                     compressed_data, compressed_data_len,
-                                     out_buffer->buf + 8, out_buffer->len - 8);
-        if (r == 0)
-            goto error;
+        /* the lzma properties are at offset 12, the compressed data
+         * follows at offset 17. The decoder takes both separately
+         * so no lzma header needs to be set up. The first 8 bytes of
+         * the output represent the fws header, see 'FWS format' above. */
+        r = FileSwfLzmaDecompression(det_ctx, ctx, buffer + 12,
+                                     (uint8_t *)buffer + offset, compressed_data_len,
+                                     out_buffer->buf + 8, out_buffer->len - 8, &produced);
     } else {
         goto error;
     }
 
+    StatsAddUI64(det_ctx->tv, det_ctx->counter_swf_decompress_bytes_in, compressed_data_len);
+    StatsAddUI64(det_ctx->tv, det_ctx->counter_swf_decompress_bytes_out, produced);
+    StatsAddUI64(det_ctx->tv, det_ctx->counter_swf_decompress_ticks,
+            UtilCpuGetTicks() - ticks_start);
+    if (r == 0)
+        goto error;
+
+    /* only the part of the buffer the decoder didn't write needs clearing */
+    memset(out_buffer->buf + 8 + produced, 0, decompressed_data_len - 8 - produced);
+
     /* all went well so switch the buffer's inspect pointer/size
      * to use the new data. */
     out_buffer->inspect = out_buffer->buf;
@@ -26,6 +26,7 @@
 #define __UTIL_FILE_DECOMPRESSION_H__
 
 #include "detect.h"
+#include "util-file-swf-decompression.h"
 
 enum {
     FILE_IS_NOT_SWF = 0,
@@ -37,6 +38,7 @@ enum {
 int FileIsSwfFile(const uint8_t *buffer, uint32_t buffer_len);
 int FileSwfDecompression(const uint8_t *buffer, uint32_t buffer_len,
                          DetectEngineThreadCtx *det_ctx,
+                         FileSwfDecompressCtx *ctx,
                          InspectionBuffer *out_buffer,
                          int swf_type,
                          uint32_t decompress_depth, uint32_t compress_depth);
@@ -74,28 +74,88 @@ uint8_t FileGetSwfVersion(const uint8_t *buffer, const uint32_t buffer_len)
     return 0;
 }
 
+/** per thread decompression state, kept between files so the zlib and
+ *  lzma decoder state is set up only once per thread */
+struct FileSwfDecompressCtx_ {
+    z_stream zlib;
+    bool zlib_init;
+    CLzmaDec lzma;
+};
+
+static void *SzAlloc(ISzAllocPtr p, size_t size) { return malloc(size); }
+static void SzFree(ISzAllocPtr p, void *address) { free(address); }
+static const ISzAlloc suri_lzma_Alloc = { SzAlloc, SzFree };
+
+/* lzma dictionaries larger than this are not kept between files */
+#define SWF_LZMA_KEEP_DICT_SIZE (1 << 20)
+
+FileSwfDecompressCtx *FileSwfDecompressCtxNew(void)
+{
+    FileSwfDecompressCtx *ctx = SCCalloc(1, sizeof(*ctx));
+    if (unlikely(ctx == NULL))
+        return NULL;
+    LzmaDec_Construct(&ctx->lzma);
+    return ctx;
+}
+
+static void FileSwfDecompressCtxCleanup(FileSwfDecompressCtx *ctx)
+{
+    if (ctx->zlib_init) {
+        inflateEnd(&ctx->zlib);
+        ctx->zlib_init = false;
+    }
+    LzmaDec_Free(&ctx->lzma, &suri_lzma_Alloc);
+}
+
+void FileSwfDecompressCtxFree(FileSwfDecompressCtx *ctx)
+{
+    if (ctx == NULL)
+        return;
+    FileSwfDecompressCtxCleanup(ctx);
+    SCFree(ctx);
+}
+
 /* CWS format */
 /*
  * | 4 bytes         | 4 bytes    | n bytes         |
  * | 'CWS' + version | script len | compressed data |
  */
-int FileSwfZlibDecompression(DetectEngineThreadCtx *det_ctx,
+int FileSwfZlibDecompression(DetectEngineThreadCtx *det_ctx, FileSwfDecompressCtx *ctx,
                              uint8_t *compressed_data, uint32_t compressed_data_len,
-                             uint8_t *decompressed_data, uint32_t decompressed_data_len)
+                             uint8_t *decompressed_data, uint32_t decompressed_data_len,
+                             uint32_t *produced)
 {
     int ret = 1;
-    z_stream infstream;
-    infstream.zalloc = Z_NULL;
-    infstream.zfree = Z_NULL;
-    infstream.opaque = Z_NULL;
-
-    infstream.avail_in = (uInt)compressed_data_len;
-    infstream.next_in = (Bytef *)compressed_data;
-    infstream.avail_out = (uInt)decompressed_data_len;
-    infstream.next_out = (Bytef *)decompressed_data;
-
-    inflateInit(&infstream);
-    int result = inflate(&infstream, Z_NO_FLUSH);
+    FileSwfDecompressCtx local;
+
+    if (ctx == NULL) {
+        memset(&local, 0, sizeof(local));
+        LzmaDec_Construct(&local.lzma);
+        ctx = &local;
+    }
+
+    z_stream *infstream = &ctx->zlib;
+    if (!ctx->zlib_init) {
+        infstream->zalloc = Z_NULL;
+        infstream->zfree = Z_NULL;
+        infstream->opaque = Z_NULL;
+        infstream->avail_in = 0;
+        infstream->next_in = Z_NULL;
+        if (inflateInit(infstream) != Z_OK) {
+            DetectEngineSetEvent(det_ctx, FILE_DECODER_EVENT_NO_MEM);
+            return 0;
+        }
+        ctx->zlib_init = true;
+    } else {
+        inflateReset(infstream);
+    }
+
+    infstream->avail_in = (uInt)compressed_data_len;
+    infstream->next_in = (Bytef *)compressed_data;
+    infstream->avail_out = (uInt)decompressed_data_len;
+    infstream->next_out = (Bytef *)decompressed_data;
+
+    int result = inflate(infstream, Z_NO_FLUSH);
     switch(result) {
         case Z_STREAM_END:
             break;
@@ -118,46 +178,49 @@ int FileSwfZlibDecompression(DetectEngineThreadCtx *det_ctx,
             ret = 0;
             break;
     }
-    inflateEnd(&infstream);
+    *produced = decompressed_data_len - infstream->avail_out;
 
+    if (ctx == &local)
+        FileSwfDecompressCtxCleanup(&local);
     return ret;
 }
 
-static void *SzAlloc(ISzAllocPtr p, size_t size) { return malloc(size); }
-static void SzFree(ISzAllocPtr p, void *address) { free(address); }
-static const ISzAlloc suri_lzma_Alloc = { SzAlloc, SzFree };
-
 /* ZWS format */
 /*
  * | 4 bytes         | 4 bytes    | 4 bytes        | 5 bytes    | n bytes   | 6 bytes         |
  * | 'ZWS' + version | script len | compressed len | LZMA props | LZMA data | LZMA end marker |
+ *
+ * The props and the data are passed in separately, so the data can be
+ * decoded in place.
  */
-int FileSwfLzmaDecompression(DetectEngineThreadCtx *det_ctx,
+int FileSwfLzmaDecompression(DetectEngineThreadCtx *det_ctx, FileSwfDecompressCtx *ctx,
+                             const uint8_t *props,
                              uint8_t *compressed_data, uint32_t compressed_data_len,
-                             uint8_t *decompressed_data, uint32_t decompressed_data_len)
+                             uint8_t *decompressed_data, uint32_t decompressed_data_len,
+                             uint32_t *produced)
 {
     int ret = 0;
-
-    CLzmaDec strm;
-    LzmaDec_Construct(&strm);
+    FileSwfDecompressCtx local;
     ELzmaStatus status;
 
-    if (compressed_data_len < LZMA_PROPS_SIZE + 8) {
-        DetectEngineSetEvent(det_ctx, FILE_DECODER_EVENT_LZMA_FORMAT_ERROR);
-        return 0;
+    if (ctx == NULL) {
+        memset(&local, 0, sizeof(local));
+        LzmaDec_Construct(&local.lzma);
+        ctx = &local;
     }
-    ret = LzmaDec_Allocate(&strm, compressed_data, LZMA_PROPS_SIZE, &suri_lzma_Alloc);
+
+    /* reuses the probs and dictionary if the props didn't change */
+    ret = LzmaDec_Allocate(&ctx->lzma, props, LZMA_PROPS_SIZE, &suri_lzma_Alloc);
     if (ret != SZ_OK) {
         DetectEngineSetEvent(det_ctx, FILE_DECODER_EVENT_LZMA_DECODER_ERROR);
+        LzmaDec_Free(&ctx->lzma, &suri_lzma_Alloc);
         return 0;
     }
-    LzmaDec_Init(&strm);
-    compressed_data += LZMA_PROPS_SIZE + 8;
-    compressed_data_len -= LZMA_PROPS_SIZE + 8;
+    LzmaDec_Init(&ctx->lzma);
     size_t inprocessed = compressed_data_len;
     size_t outprocessed = decompressed_data_len;
 
-    ret = LzmaDec_DecodeToBuf(&strm, decompressed_data, &outprocessed,
+    ret = LzmaDec_DecodeToBuf(&ctx->lzma, decompressed_data, &outprocessed,
                              compressed_data, &inprocessed, LZMA_FINISH_ANY, &status, MAX_SWF_DECOMPRESSED_LEN);
 
     switch(ret) {
@@ -185,7 +248,9 @@ int FileSwfLzmaDecompression(DetectEngineThreadCtx *det_ctx,
             ret = 0;
             break;
     }
+    *produced = (uint32_t)outprocessed;
 
-    LzmaDec_Free(&strm, &suri_lzma_Alloc);
+    if (ctx == &local || ctx->lzma.dicBufSize > SWF_LZMA_KEEP_DICT_SIZE)
+        LzmaDec_Free(&ctx->lzma, &suri_lzma_Alloc);
     return ret;
 }
@@ -30,13 +30,22 @@
  */
 #define MIN_SWF_LEN    2920
 
+/** per thread decompression workspace */
+typedef struct FileSwfDecompressCtx_ FileSwfDecompressCtx;
+
+FileSwfDecompressCtx *FileSwfDecompressCtxNew(void);
+void FileSwfDecompressCtxFree(FileSwfDecompressCtx *ctx);
+
 uint8_t FileGetSwfVersion(const uint8_t *buffer, const uint32_t buffer_len);
 uint32_t FileGetSwfDecompressedLen(const uint8_t *buffer, uint32_t buffr_len);
-int FileSwfZlibDecompression(DetectEngineThreadCtx *det_ctx,
+int FileSwfZlibDecompression(DetectEngineThreadCtx *det_ctx, FileSwfDecompressCtx *ctx,
                              uint8_t *compressed_data, uint32_t compressed_data_len,
-                             uint8_t *decompressed_data, uint32_t decompressed_data_len);
-int FileSwfLzmaDecompression(DetectEngineThreadCtx *det_ctx,
+                             uint8_t *decompressed_data, uint32_t decompressed_data_len,
+                             uint32_t *produced);
+int FileSwfLzmaDecompression(DetectEngineThreadCtx *det_ctx, FileSwfDecompressCtx *ctx,
+                             const uint8_t *props,
                              uint8_t *compressed_data, uint32_t compressed_data_len,
-                             uint8_t *decompressed_data, uint32_t decompressed_data_len);
+                             uint8_t *decompressed_data, uint32_t decompressed_data_len,
+                             uint32_t *produced);
 
 #endif /* __UTIL_FILE_SWF_DECOMPRESSION_H__ */
@@ -61,6 +61,62 @@ SCEnumCharMap sc_hinfo_os_policy_map[ ] = {
 /** Radix tree that holds the host OS information */
 static SCRadixTree *sc_hinfo_tree = NULL;
 
+/** policy value in the IPv4 table for a /16 that holds longer prefixes,
+ *  so the radix tree has to be consulted */
+#define SC_HINFO_IPV4_USE_TREE  -2
+
+/**
+ * Direct lookup table for IPv4, indexed by the first 16 bits of the
+ * address. Each /16 holds the policy of its longest covering prefix, as
+ * long as no prefix longer than /16 falls inside it. Built along with the
+ * radix tree, so that the per session lookup is a single array access for
+ * most addresses.
+ */
+typedef struct SCHInfoIPv4Table_ {
+    int8_t policy[65536];   /**< policy, -1 for none */
+    uint8_t len[65536];     /**< prefix length + 1 the policy was set by,
+                                 0 if not set */
+} SCHInfoIPv4Table;
+
+static SCHInfoIPv4Table *sc_hinfo_ipv4_table = NULL;
+
+/**
+ * \brief Adds an IPv4 netblock to the direct lookup table
+ *
+ * \param ipv4_addr masked raw ipv4 address
+ * \param netmask   netblock size, 32 for a host
+ * \param policy    the OS policy of the netblock
+ * \initonly
+ */
+static void SCHInfoIPv4TableAdd(const uint8_t *ipv4_addr, const int netmask,
+        const int policy)
+{
+    if (sc_hinfo_ipv4_table == NULL) {
+        sc_hinfo_ipv4_table = SCMalloc(sizeof(*sc_hinfo_ipv4_table));
+        if (sc_hinfo_ipv4_table == NULL) {
+            FatalError(SC_ERR_FATAL, "Error allocating memory. Exiting");
+        }
+        memset(sc_hinfo_ipv4_table->policy, -1, sizeof(sc_hinfo_ipv4_table->policy));
+        memset(sc_hinfo_ipv4_table->len, 0, sizeof(sc_hinfo_ipv4_table->len));
+    }
+
+    const uint32_t first = ((uint32_t)ipv4_addr[0] << 8) | ipv4_addr[1];
+    if (netmask > 16) {
+        sc_hinfo_ipv4_table->policy[first] = SC_HINFO_IPV4_USE_TREE;
+        return;
+    }
+
+    const uint32_t cnt = 1U << (16 - netmask);
+    for (uint32_t i = first; i < first + cnt; i++) {
+        /* like the radix tree, the first of duplicate netblocks wins */
+        if (sc_hinfo_ipv4_table->policy[i] == SC_HINFO_IPV4_USE_TREE ||
+                sc_hinfo_ipv4_table->len[i] > netmask)
+            continue;
+        sc_hinfo_ipv4_table->policy[i] = (int8_t)policy;
+        sc_hinfo_ipv4_table->len[i] = (uint8_t)(netmask + 1);
+    }
+}
+
 
 /**
  * \brief Allocates the host_os flavour wrapped in user_data variable to be sent
@@ -184,6 +240,7 @@ int SCHInfoAddHostOSInfo(const char *host_os, const char *host_os_ip_range, int
         if (netmask_str == NULL) {
             SCRadixAddKeyIPV4((uint8_t *)ipv4_addr, sc_hinfo_tree,
                               (void *)user_data);
+            SCHInfoIPv4TableAdd((uint8_t *)ipv4_addr, 32, *user_data);
         } else {
             if (StringParseI32RangeCheck(&netmask_value, 10, 0, (const char *)netmask_str, 0, 32) < 0) {
                 SCLogError(SC_ERR_INVALID_IP_NETBLOCK, "Invalid IPV4 Netblock");
@@ -196,6 +253,7 @@ int SCHInfoAddHostOSInfo(const char *host_os, const char *host_os_ip_range, int
             MaskIPNetblock((uint8_t *)ipv4_addr, netmask_value, 32);
             SCRadixAddKeyIPV4Netblock((uint8_t *)ipv4_addr, sc_hinfo_tree,
                                       (void *)user_data, netmask_value);
+            SCHInfoIPv4TableAdd((uint8_t *)ipv4_addr, netmask_value, *user_data);
         }
     } else {
         /* if we are here, we have an IPV6 address */
@@ -289,6 +347,13 @@ int SCHInfoGetHostOSFlavour(const char *ip_addr_str)
  */
 int SCHInfoGetIPv4HostOSFlavour(uint8_t *ipv4_addr)
 {
+    if (sc_hinfo_ipv4_table == NULL)
+        return -1;
+
+    const int policy = sc_hinfo_ipv4_table->policy[(ipv4_addr[0] << 8) | ipv4_addr[1]];
+    if (policy != SC_HINFO_IPV4_USE_TREE)
+        return policy;
+
     void *user_data = NULL;
     (void)SCRadixFindKeyIPV4BestMatch(ipv4_addr, sc_hinfo_tree, &user_data);
     if (user_data == NULL)
@@ -321,6 +386,10 @@ void SCHInfoCleanResources(void)
         SCRadixReleaseRadixTree(sc_hinfo_tree);
         sc_hinfo_tree = NULL;
     }
+    if (sc_hinfo_ipv4_table != NULL) {
+        SCFree(sc_hinfo_ipv4_table);
+        sc_hinfo_ipv4_table = NULL;
+    }
 
     return;
 }
@@ -357,11 +426,14 @@ void SCHInfoLoadFromConfig(void)
 
 #ifdef UNITTESTS
 static SCRadixTree *sc_hinfo_tree_backup = NULL;
+static SCHInfoIPv4Table *sc_hinfo_ipv4_table_backup = NULL;
 
 static void SCHInfoCreateContextBackup(void)
 {
     sc_hinfo_tree_backup = sc_hinfo_tree;
     sc_hinfo_tree = NULL;
+    sc_hinfo_ipv4_table_backup = sc_hinfo_ipv4_table;
+    sc_hinfo_ipv4_table = NULL;
 
     return;
 }
@@ -370,6 +442,8 @@ static void SCHInfoRestoreContextBackup(void)
 {
     sc_hinfo_tree = sc_hinfo_tree_backup;
     sc_hinfo_tree_backup = NULL;
+    sc_hinfo_ipv4_table = sc_hinfo_ipv4_table_backup;
+    sc_hinfo_ipv4_table_backup = NULL;
 
     return;
 }
@@ -1597,6 +1671,46 @@ host-os-policy:\n\
     PASS;
 }
 
+/**
+ * \test Check that the IPv4 direct lookup table returns the same policies
+ *       as the radix tree for overlapping netblocks and hosts
+ */
+static int SCHInfoTestIPv4Table10(void)
+{
+    SCHInfoCreateContextBackup();
+
+    FAIL_IF(SCHInfoAddHostOSInfo("linux", "0.0.0.0/0", SC_HINFO_IS_IPV4) == -1);
+    FAIL_IF(SCHInfoAddHostOSInfo("windows", "10.0.0.0/8", SC_HINFO_IS_IPV4) == -1);
+    FAIL_IF(SCHInfoAddHostOSInfo("solaris", "10.1.0.0/16", SC_HINFO_IS_IPV4) == -1);
+    FAIL_IF(SCHInfoAddHostOSInfo("macos", "10.1.0.0/16", SC_HINFO_IS_IPV4) == -1);
+    FAIL_IF(SCHInfoAddHostOSInfo("bsd", "10.2.3.0/24", SC_HINFO_IS_IPV4) == -1);
+    FAIL_IF(SCHInfoAddHostOSInfo("irix", "10.2.3.4", SC_HINFO_IS_IPV4) == -1);
+    FAIL_IF_NULL(sc_hinfo_ipv4_table);
+
+    const char *addrs[] = { "1.2.3.4", "10.0.0.1", "10.1.2.3", "10.1.255.255",
+        "10.2.0.1", "10.2.3.1", "10.2.3.4", "10.255.0.1", "11.0.0.1", NULL };
+    for (int i = 0; addrs[i] != NULL; i++) {
+        struct in_addr *a = ValidateIPV4Address(addrs[i]);
+        FAIL_IF_NULL(a);
+        const int policy = SCHInfoGetIPv4HostOSFlavour((uint8_t *)a);
+        SCFree(a);
+        FAIL_IF(policy != SCHInfoGetHostOSFlavour(addrs[i]));
+    }
+
+    struct in_addr *a = ValidateIPV4Address("10.1.2.3");
+    FAIL_IF_NULL(a);
+    FAIL_IF(SCHInfoGetIPv4HostOSFlavour((uint8_t *)a) != OS_POLICY_SOLARIS);
+    SCFree(a);
+    a = ValidateIPV4Address("10.2.3.4");
+    FAIL_IF_NULL(a);
+    FAIL_IF(SCHInfoGetIPv4HostOSFlavour((uint8_t *)a) != OS_POLICY_IRIX);
+    SCFree(a);
+
+    SCHInfoCleanResources();
+    SCHInfoRestoreContextBackup();
+    PASS;
+}
+
 #endif /* UNITTESTS */
 
 void SCHInfoRegisterTests(void)
@@ -1622,6 +1736,7 @@ void SCHInfoRegisterTests(void)
                    SCHInfoTestValidIPV6Address08);
     UtRegisterTest("SCHInfoTestValidIPV4Address09",
                    SCHInfoTestValidIPV4Address09);
+    UtRegisterTest("SCHInfoTestIPv4Table10", SCHInfoTestIPv4Table10);
 
     UtRegisterTest("SCHInfoTestLoadFromConfig01", SCHInfoTestLoadFromConfig01);
     UtRegisterTest("SCHInfoTestLoadFromConfig02", SCHInfoTestLoadFromConfig02);
@@ -49,6 +49,7 @@ typedef struct SyslogSetup_ {
 } SyslogSetup;
 
 struct LogFileCtx_;
+struct OutputJsonSink_;
 typedef struct LogThreadedFileCtx_ {
     int slot_count;
     SCMutex mutex;
@@ -150,6 +151,10 @@ typedef struct LogFileCtx_ {
     uint64_t dropped;
 
     uint64_t output_errors;
+
+    /** eve: additional outputs that are written the same serialized
+     *  records, owned by the parent ctx */
+    struct OutputJsonSink_ *sinks;
 } LogFileCtx;
 
 /* Min time (msecs) before trying to reconnect a Unix domain socket */
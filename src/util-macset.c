@@ -98,7 +98,7 @@ MacSet *MacSetInit(int size)
         SCLogError(SC_ERR_MEM_ALLOC, "Unable to allocate MacSet memory");
         return NULL;
     }
-    (void) SC_ATOMIC_ADD(flow_memuse, (sizeof(*ms)));
+    MemcapCreditIncr(MEMCAP_CREDIT_FLOW, (sizeof(*ms)));
     ms->state[MAC_SET_SRC] = ms->state[MAC_SET_DST] = EMPTY_SET;
     if (size < 3) {
         /* we want to make sure we have at space for at least 3 items to
@@ -137,7 +137,7 @@ static inline void MacUpdateEntry(MacSet *ms, uint8_t *addr, int side, ThreadVar
                                                      "MacSet memory");
                         return;
                     }
-                    (void) SC_ATOMIC_ADD(flow_memuse, (ms->size * sizeof(MacAddr)));
+                    MemcapCreditIncr(MEMCAP_CREDIT_FLOW, (ms->size * sizeof(MacAddr)));
                 }
                 memcpy(ms->buf[side], ms->singles[side], sizeof(MacAddr));
                 memcpy(ms->buf[side] + 1, addr, sizeof(MacAddr));
@@ -282,7 +282,7 @@ void MacSetFree(MacSet *ms)
     }
     SCFree(ms);
     total_free += sizeof(*ms);
-    (void) SC_ATOMIC_SUB(flow_memuse, total_free);
+    MemcapCreditDecr(MEMCAP_CREDIT_FLOW, total_free);
 }
 
 #ifdef UNITTESTS
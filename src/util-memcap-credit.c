@@ -0,0 +1,299 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Per thread memcap credit.
+ *
+ * Each memcap protected subsystem (stream, reassembly, flow, http) has a
+ * global 'reserved' counter. A thread that needs memory reserves its
+ * shortfall plus a chunk of extra credit from it in one atomic operation.
+ * Following allocations are taken from the thread local credit until it
+ * runs out. Frees add to the local credit; once it exceeds two chunks the
+ * surplus is returned to the global counter.
+ *
+ * The global counter therefore overestimates the real memory use by at most
+ * 'number of threads * 2 * chunk' bytes. A chunk size of 0 disables the
+ * credit logic and turns every update into a global atomic operation.
+ */
+
+#include "suricata-common.h"
+#include "conf.h"
+#include "util-misc.h"
+#include "util-unittest.h"
+#include "util-memcap-credit.h"
+
+#define MEMCAP_CREDIT_DEFAULT_CHUNK (64 * 1024)
+
+typedef struct MemcapCreditPool_ {
+    /** bytes handed out to threads: in use or held as local credit */
+    SC_ATOMIC_DECLARE(uint64_t, reserved);
+} __attribute__((aligned(CLS))) MemcapCreditPool;
+
+static MemcapCreditPool memcap_credit_pools[MEMCAP_CREDIT_MAX];
+
+/** chunk size, 0 means credit disabled. Not set in unittest mode. */
+static uint64_t memcap_credit_chunk = 0;
+
+/** per thread credit: reserved from the pool but not in use */
+static thread_local uint64_t memcap_credit_local[MEMCAP_CREDIT_MAX];
+
+/**
+ *  \brief parse the 'memcap-credit' setting
+ */
+void MemcapCreditInitConfig(void)
+{
+    const char *conf_val;
+    uint64_t chunk = MEMCAP_CREDIT_DEFAULT_CHUNK;
+
+    if ((ConfGet("memcap-credit", &conf_val)) == 1 && conf_val != NULL) {
+        if (ParseSizeStringU64(conf_val, &chunk) < 0) {
+            SCLogError(SC_ERR_SIZE_PARSE, "Error parsing memcap-credit "
+                       "from conf file - %s.  Killing engine",
+                       conf_val);
+            exit(EXIT_FAILURE);
+        }
+    }
+    memcap_credit_chunk = chunk;
+    SCLogConfig("memcap credit chunk size: %"PRIu64, memcap_credit_chunk);
+}
+
+uint64_t MemcapCreditGetChunkSize(void)
+{
+    return memcap_credit_chunk;
+}
+
+void MemcapCreditInit(MemcapCreditId id)
+{
+    SC_ATOMIC_INIT(memcap_credit_pools[id].reserved);
+}
+
+/**
+ *  \brief Check if alloc'ing "size" would mean we're over memcap
+ *
+ *  Allocations covered by the local credit always fit. Otherwise the
+ *  shortfall is checked against the global reservations.
+ *
+ *  \retval true if in bounds
+ *  \retval false if not in bounds
+ */
+bool MemcapCreditCheck(MemcapCreditId id, uint64_t size, uint64_t memcap)
+{
+    const uint64_t credit = memcap_credit_local[id];
+    if (credit >= size)
+        return true;
+    return (SC_ATOMIC_GET(memcap_credit_pools[id].reserved) + (size - credit) <= memcap);
+}
+
+void MemcapCreditIncr(MemcapCreditId id, uint64_t size)
+{
+    uint64_t *credit = &memcap_credit_local[id];
+    if (likely(*credit >= size)) {
+        *credit -= size;
+        return;
+    }
+
+    /* reserve the shortfall plus a new chunk of credit */
+    const uint64_t chunk = memcap_credit_chunk;
+    (void) SC_ATOMIC_ADD(memcap_credit_pools[id].reserved, (size - *credit) + chunk);
+    *credit = chunk;
+}
+
+void MemcapCreditDecr(MemcapCreditId id, uint64_t size)
+{
+    uint64_t *credit = &memcap_credit_local[id];
+    *credit += size;
+
+    /* keep one chunk around, return the rest */
+    const uint64_t chunk = memcap_credit_chunk;
+    if (*credit > chunk * 2 || chunk == 0) {
+        (void) SC_ATOMIC_SUB(memcap_credit_pools[id].reserved, *credit - chunk);
+        *credit = chunk;
+    }
+}
+
+/**
+ *  \brief get the global memuse, including the local credit of all threads
+ */
+uint64_t MemcapCreditGetMemuse(MemcapCreditId id)
+{
+    uint64_t memusecopy = SC_ATOMIC_GET(memcap_credit_pools[id].reserved);
+    return memusecopy;
+}
+
+/**
+ *  \brief return all local credit of the calling thread to the pools
+ *
+ *  Called by threads on exit.
+ */
+void MemcapCreditThreadRelease(void)
+{
+    for (int id = 0; id < MEMCAP_CREDIT_MAX; id++) {
+        if (memcap_credit_local[id] > 0) {
+            (void) SC_ATOMIC_SUB(memcap_credit_pools[id].reserved, memcap_credit_local[id]);
+            memcap_credit_local[id] = 0;
+        }
+    }
+}
+
+#ifdef UNITTESTS
+#include "util-cpu.h"
+
+static int MemcapCreditTest01(void)
+{
+    memcap_credit_chunk = 4096;
+    MemcapCreditInit(MEMCAP_CREDIT_STREAM);
+
+    FAIL_IF_NOT(MemcapCreditCheck(MEMCAP_CREDIT_STREAM, 100, 8192));
+    MemcapCreditIncr(MEMCAP_CREDIT_STREAM, 100);
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_STREAM) == 4196);
+    /* served from local credit, global not touched */
+    MemcapCreditIncr(MEMCAP_CREDIT_STREAM, 1000);
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_STREAM) == 4196);
+    /* local credit covers it even though we're close to the memcap */
+    FAIL_IF_NOT(MemcapCreditCheck(MEMCAP_CREDIT_STREAM, 3000, 4196));
+    FAIL_IF(MemcapCreditCheck(MEMCAP_CREDIT_STREAM, 4000, 4196));
+
+    MemcapCreditDecr(MEMCAP_CREDIT_STREAM, 1100);
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_STREAM) == 4196);
+
+    MemcapCreditThreadRelease();
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_STREAM) == 0);
+
+    memcap_credit_chunk = 0;
+    PASS;
+}
+
+/** \test surplus credit is returned after large frees */
+static int MemcapCreditTest02(void)
+{
+    memcap_credit_chunk = 1024;
+    MemcapCreditInit(MEMCAP_CREDIT_FLOW);
+
+    MemcapCreditIncr(MEMCAP_CREDIT_FLOW, 10000);
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_FLOW) == 11024);
+    MemcapCreditDecr(MEMCAP_CREDIT_FLOW, 10000);
+    /* only a single chunk is kept */
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_FLOW) == 1024);
+
+    MemcapCreditThreadRelease();
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_FLOW) == 0);
+
+    memcap_credit_chunk = 0;
+    PASS;
+}
+
+/** \test chunk size 0 keeps the global counter exact */
+static int MemcapCreditTest03(void)
+{
+    memcap_credit_chunk = 0;
+    MemcapCreditInit(MEMCAP_CREDIT_HTP);
+
+    MemcapCreditIncr(MEMCAP_CREDIT_HTP, 500);
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_HTP) == 500);
+    FAIL_IF(MemcapCreditCheck(MEMCAP_CREDIT_HTP, 1, 500));
+    MemcapCreditDecr(MEMCAP_CREDIT_HTP, 200);
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_HTP) == 300);
+    MemcapCreditDecr(MEMCAP_CREDIT_HTP, 300);
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_HTP) == 0);
+    PASS;
+}
+
+#define MEMCAP_CREDIT_TEST_THREADS  64
+#define MEMCAP_CREDIT_TEST_LOOPS    20000
+
+static void *MemcapCreditTestThread(void *arg)
+{
+    uint64_t *max_seen = arg;
+    uint64_t sizes[4] = { 64, 1500, 300, 2048 };
+
+    for (int i = 0; i < MEMCAP_CREDIT_TEST_LOOPS; i++) {
+        uint64_t size = sizes[i % 4];
+        if (MemcapCreditCheck(MEMCAP_CREDIT_REASSEMBLY, size, UINT64_MAX - size)) {
+            MemcapCreditIncr(MEMCAP_CREDIT_REASSEMBLY, size);
+            uint64_t m = MemcapCreditGetMemuse(MEMCAP_CREDIT_REASSEMBLY);
+            if (m > *max_seen)
+                *max_seen = m;
+            MemcapCreditDecr(MEMCAP_CREDIT_REASSEMBLY, size);
+        }
+    }
+    MemcapCreditThreadRelease();
+    return NULL;
+}
+
+static uint64_t MemcapCreditTestRun(uint64_t chunk, uint64_t *max_seen)
+{
+    pthread_t threads[MEMCAP_CREDIT_TEST_THREADS];
+    uint64_t max_seen_thread[MEMCAP_CREDIT_TEST_THREADS];
+
+    memcap_credit_chunk = chunk;
+    MemcapCreditInit(MEMCAP_CREDIT_REASSEMBLY);
+
+    uint64_t ticks_start = UtilCpuGetTicks();
+    for (int i = 0; i < MEMCAP_CREDIT_TEST_THREADS; i++) {
+        max_seen_thread[i] = 0;
+        if (pthread_create(&threads[i], NULL, MemcapCreditTestThread, &max_seen_thread[i]) != 0)
+            return 0;
+    }
+    *max_seen = 0;
+    for (int i = 0; i < MEMCAP_CREDIT_TEST_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        if (max_seen_thread[i] > *max_seen)
+            *max_seen = max_seen_thread[i];
+    }
+    uint64_t ticks_end = UtilCpuGetTicks();
+
+    memcap_credit_chunk = 0;
+    return ticks_end - ticks_start;
+}
+
+/** \test contention between 64 threads, global vs credit based */
+static int MemcapCreditTest04(void)
+{
+    uint64_t max_global = 0, max_credit = 0;
+    const uint64_t chunk = MEMCAP_CREDIT_DEFAULT_CHUNK;
+
+    uint64_t ticks_global = MemcapCreditTestRun(0, &max_global);
+    FAIL_IF(ticks_global == 0);
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_REASSEMBLY) == 0);
+
+    uint64_t ticks_credit = MemcapCreditTestRun(chunk, &max_credit);
+    FAIL_IF(ticks_credit == 0);
+    FAIL_IF_NOT(MemcapCreditGetMemuse(MEMCAP_CREDIT_REASSEMBLY) == 0);
+
+    /* slack is bounded by 'threads * (2 * chunk + largest alloc)' */
+    FAIL_IF(max_credit > MEMCAP_CREDIT_TEST_THREADS * (2 * chunk + 2048));
+
+    SCLogInfo("%d threads, %d alloc/free each: global %"PRIu64" ticks, "
+            "credit %"PRIu64" ticks (max memuse %"PRIu64" vs %"PRIu64")",
+            MEMCAP_CREDIT_TEST_THREADS, MEMCAP_CREDIT_TEST_LOOPS,
+            ticks_global, ticks_credit, max_global, max_credit);
+    PASS;
+}
+#endif /* UNITTESTS */
+
+void MemcapCreditRegisterTests(void)
+{
+#ifdef UNITTESTS
+    UtRegisterTest("MemcapCreditTest01", MemcapCreditTest01);
+    UtRegisterTest("MemcapCreditTest02", MemcapCreditTest02);
+    UtRegisterTest("MemcapCreditTest03", MemcapCreditTest03);
+    UtRegisterTest("MemcapCreditTest04 -- 64 thread contention",
+            MemcapCreditTest04);
+#endif
+}
@@ -0,0 +1,50 @@
+/* Copyright (C) 2020 Open Information Security Foundation
+ *
+ * You can copy, redistribute or modify this Program under the terms of
+ * the GNU General Public License version 2 as published by the Free
+ * Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * version 2 along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/**
+ * \file
+ *
+ * Per thread memcap credit. Threads reserve memcap from a global counter
+ * in chunks and serve allocations from their local credit, so the global
+ * counter is only updated once per chunk instead of for every allocation.
+ */
+
+#ifndef __UTIL_MEMCAP_CREDIT_H__
+#define __UTIL_MEMCAP_CREDIT_H__
+
+typedef enum MemcapCreditId_ {
+    MEMCAP_CREDIT_STREAM = 0,
+    MEMCAP_CREDIT_REASSEMBLY,
+    MEMCAP_CREDIT_FLOW,
+    MEMCAP_CREDIT_HTP,
+
+    MEMCAP_CREDIT_MAX,
+} MemcapCreditId;
+
+void MemcapCreditInitConfig(void);
+uint64_t MemcapCreditGetChunkSize(void);
+
+void MemcapCreditInit(MemcapCreditId id);
+bool MemcapCreditCheck(MemcapCreditId id, uint64_t size, uint64_t memcap);
+void MemcapCreditIncr(MemcapCreditId id, uint64_t size);
+void MemcapCreditDecr(MemcapCreditId id, uint64_t size);
+uint64_t MemcapCreditGetMemuse(MemcapCreditId id);
+void MemcapCreditThreadRelease(void);
+
+void MemcapCreditRegisterTests(void);
+
+#endif /* __UTIL_MEMCAP_CREDIT_H__ */
@@ -1330,6 +1330,7 @@ const char * PacketProfileLoggertIdToString(LoggerId id)
         CASE_CODE (LOGGER_TCP_DATA);
         CASE_CODE (LOGGER_JSON_FLOW);
         CASE_CODE (LOGGER_JSON_NETFLOW);
+        CASE_CODE (LOGGER_JSON_TX_SUMMARY);
         CASE_CODE (LOGGER_STATS);
         CASE_CODE (LOGGER_JSON_STATS);
         CASE_CODE (LOGGER_PRELUDE);
@@ -21,6 +21,10 @@
 #include "util-print.h"
 #include "util-validate.h"
 
+#ifdef HAVE_LIBLZ4
+#include <lz4.h>
+#endif
+
 /**
  * \file
  *
@@ -136,7 +140,12 @@ void StreamingBufferClear(StreamingBuffer *sb)
 
         SBBFree(sb);
         if (sb->buf != NULL) {
-            FREE(sb->cfg, sb->buf, sb->buf_size);
+            if (StreamingBufferIsCompressed(sb)) {
+                FREE(sb->cfg, sb->buf, sb->buf_compressed_len);
+                sb->buf_compressed_len = 0;
+            } else {
+                FREE(sb->cfg, sb->buf, sb->buf_size);
+            }
             sb->buf = NULL;
         }
     }
@@ -506,6 +515,7 @@ static int WARN_UNUSED Grow(StreamingBuffer *sb)
  */
 void StreamingBufferSlideToOffset(StreamingBuffer *sb, uint64_t offset)
 {
+    DEBUG_VALIDATE_BUG_ON(StreamingBufferIsCompressed(sb));
     if (offset > sb->stream_offset &&
         offset <= sb->stream_offset + sb->buf_offset)
     {
@@ -521,6 +531,7 @@ void StreamingBufferSlideToOffset(StreamingBuffer *sb, uint64_t offset)
 
 void StreamingBufferSlide(StreamingBuffer *sb, uint32_t slide)
 {
+    DEBUG_VALIDATE_BUG_ON(StreamingBufferIsCompressed(sb));
     uint32_t size = sb->buf_offset - slide;
     SCLogDebug("sliding %u forward, size of original buffer left after slide %u", slide, size);
     memmove(sb->buf, sb->buf+slide, size);
@@ -534,6 +545,7 @@ void StreamingBufferSlide(StreamingBuffer *sb, uint32_t slide)
 
 StreamingBufferSegment *StreamingBufferAppendRaw(StreamingBuffer *sb, const uint8_t *data, uint32_t data_len)
 {
+    DEBUG_VALIDATE_BUG_ON(StreamingBufferIsCompressed(sb));
     if (sb->buf == NULL) {
         if (InitBuffer(sb) == -1)
             return NULL;
@@ -576,6 +588,7 @@ StreamingBufferSegment *StreamingBufferAppendRaw(StreamingBuffer *sb, const uint
 int StreamingBufferAppend(StreamingBuffer *sb, StreamingBufferSegment *seg,
                           const uint8_t *data, uint32_t data_len)
 {
+    DEBUG_VALIDATE_BUG_ON(StreamingBufferIsCompressed(sb));
     BUG_ON(seg == NULL);
 
     if (sb->buf == NULL) {
@@ -619,6 +632,7 @@ int StreamingBufferAppend(StreamingBuffer *sb, StreamingBufferSegment *seg,
 int StreamingBufferAppendNoTrack(StreamingBuffer *sb,
                                  const uint8_t *data, uint32_t data_len)
 {
+    DEBUG_VALIDATE_BUG_ON(StreamingBufferIsCompressed(sb));
     if (sb->buf == NULL) {
         if (InitBuffer(sb) == -1)
             return -1;
@@ -662,6 +676,7 @@ int StreamingBufferInsertAt(StreamingBuffer *sb, StreamingBufferSegment *seg,
                             const uint8_t *data, uint32_t data_len,
                             uint64_t offset)
 {
+    DEBUG_VALIDATE_BUG_ON(StreamingBufferIsCompressed(sb));
     BUG_ON(seg == NULL);
 
     if (offset < sb->stream_offset)
@@ -803,6 +818,7 @@ void StreamingBufferSegmentGetData(const StreamingBuffer *sb,
                                    const StreamingBufferSegment *seg,
                                    const uint8_t **data, uint32_t *data_len)
 {
+    DEBUG_VALIDATE_BUG_ON(sb != NULL && StreamingBufferIsCompressed(sb));
     if (likely(sb->buf)) {
         if (seg->stream_offset >= sb->stream_offset) {
             uint64_t offset = seg->stream_offset - sb->stream_offset;
@@ -850,6 +866,7 @@ int StreamingBufferGetData(const StreamingBuffer *sb,
         const uint8_t **data, uint32_t *data_len,
         uint64_t *stream_offset)
 {
+    DEBUG_VALIDATE_BUG_ON(sb != NULL && StreamingBufferIsCompressed(sb));
     if (sb != NULL && sb->buf != NULL) {
         *data = sb->buf;
         *data_len = sb->buf_offset;
@@ -867,6 +884,7 @@ int StreamingBufferGetDataAtOffset (const StreamingBuffer *sb,
         const uint8_t **data, uint32_t *data_len,
         uint64_t offset)
 {
+    DEBUG_VALIDATE_BUG_ON(sb != NULL && StreamingBufferIsCompressed(sb));
     if (sb != NULL && sb->buf != NULL &&
             offset >= sb->stream_offset &&
             offset < (sb->stream_offset + sb->buf_offset))
@@ -908,6 +926,92 @@ int StreamingBufferCompareRawData(const StreamingBuffer *sb,
     return 0;
 }
 
+/**
+ *  \brief compress the data in the buffer
+ *
+ *  Replaces the memory block by a LZ4 compressed copy of the data up to
+ *  buf_offset. Offsets and blocks are untouched, but the data can't be
+ *  used or modified until StreamingBufferDecompress() is called.
+ *
+ *  \retval size compressed size
+ *  \retval 0 not compressed: no data, already compressed or no gain
+ *  \retval -1 error, buffer unchanged
+ */
+int StreamingBufferCompress(StreamingBuffer *sb)
+{
+#ifdef HAVE_LIBLZ4
+    if (sb->buf == NULL || sb->buf_offset == 0 || StreamingBufferIsCompressed(sb))
+        return 0;
+
+    const int bound = LZ4_compressBound((int)sb->buf_offset);
+    if (bound <= 0)
+        return -1;
+    char *tmp = SCMalloc(bound);
+    if (tmp == NULL)
+        return -1;
+
+    const int len = LZ4_compress_default((const char *)sb->buf, tmp,
+            (int)sb->buf_offset, bound);
+    if (len <= 0 || (uint32_t)len >= sb->buf_size) {
+        SCFree(tmp);
+        return 0;
+    }
+
+    uint8_t *cbuf = MALLOC(sb->cfg, len);
+    if (cbuf == NULL) {
+        SCFree(tmp);
+        return -1;
+    }
+    memcpy(cbuf, tmp, len);
+    SCFree(tmp);
+
+    SCLogDebug("compressed %u bytes (buffer size %u) to %d", sb->buf_offset,
+            sb->buf_size, len);
+    FREE(sb->cfg, sb->buf, sb->buf_size);
+    sb->buf = cbuf;
+    sb->buf_compressed_len = (uint32_t)len;
+    return len;
+#else
+    return -1;
+#endif
+}
+
+/**
+ *  \brief restore a buffer compressed by StreamingBufferCompress()
+ *
+ *  \param Malloc optional allocator for the restored memory block. Must
+ *                account memory the same way as the configured Free.
+ *                If NULL the configured Malloc is used.
+ *
+ *  \retval 0 ok, buffer is uncompressed
+ *  \retval -1 error, buffer unchanged
+ */
+int StreamingBufferDecompress(StreamingBuffer *sb, void *(*Malloc)(size_t size))
+{
+    if (!StreamingBufferIsCompressed(sb))
+        return 0;
+#ifdef HAVE_LIBLZ4
+    uint8_t *buf = Malloc ? Malloc(sb->buf_size) : MALLOC(sb->cfg, sb->buf_size);
+    if (buf == NULL)
+        return -1;
+
+    const int len = LZ4_decompress_safe((const char *)sb->buf, (char *)buf,
+            (int)sb->buf_compressed_len, (int)sb->buf_size);
+    if (len < 0 || (uint32_t)len != sb->buf_offset) {
+        FREE(sb->cfg, buf, sb->buf_size);
+        return -1;
+    }
+    memset(buf + len, 0, sb->buf_size - len);
+
+    FREE(sb->cfg, sb->buf, sb->buf_compressed_len);
+    sb->buf = buf;
+    sb->buf_compressed_len = 0;
+    return 0;
+#else
+    return -1;
+#endif
+}
+
 #ifdef UNITTESTS
 static void Dump(StreamingBuffer *sb)
 {
@@ -1472,6 +1576,54 @@ static int StreamingBufferTest10(void)
     PASS;
 }
 
+#ifdef HAVE_LIBLZ4
+/** \test compress and restore a buffer with a gap */
+static int StreamingBufferTest11(void)
+{
+    StreamingBufferConfig cfg = { 0, 8, 1024, NULL, NULL, NULL, NULL };
+    StreamingBuffer *sb = StreamingBufferInit(&cfg);
+    FAIL_IF(sb == NULL);
+
+    uint8_t data[600];
+    for (int i = 0; i < (int)sizeof(data); i++)
+        data[i] = 'A' + (i % 4);
+
+    StreamingBufferSegment seg1;
+    FAIL_IF(StreamingBufferInsertAt(sb, &seg1, data, sizeof(data), 0) != 0);
+    StreamingBufferSegment seg2;
+    FAIL_IF(StreamingBufferInsertAt(sb, &seg2, data, 100, 700) != 0);
+    FAIL_IF(sb->buf_offset != 800);
+
+    FAIL_IF(StreamingBufferCompress(sb) <= 0);
+    FAIL_IF_NOT(StreamingBufferIsCompressed(sb));
+    FAIL_IF(sb->buf_compressed_len >= sb->buf_size);
+    /* second call is a noop */
+    FAIL_IF(StreamingBufferCompress(sb) != 0);
+
+    FAIL_IF(StreamingBufferDecompress(sb, NULL) != 0);
+    FAIL_IF(StreamingBufferIsCompressed(sb));
+    FAIL_IF(sb->buf_offset != 800);
+    FAIL_IF_NOT(StreamingBufferSegmentCompareRawData(sb, &seg1, data, sizeof(data)));
+    FAIL_IF_NOT(StreamingBufferSegmentCompareRawData(sb, &seg2, data, 100));
+
+    StreamingBufferBlock *sbb1 = RB_MIN(SBB, &sb->sbb_tree);
+    FAIL_IF_NULL(sbb1);
+    FAIL_IF(sbb1->offset != 0);
+    FAIL_IF(sbb1->len != 600);
+
+    /* data can be added after restoring */
+    StreamingBufferSegment seg3;
+    FAIL_IF(StreamingBufferInsertAt(sb, &seg3, data, 100, 600) != 0);
+    FAIL_IF_NOT(StreamingBufferSegmentCompareRawData(sb, &seg3, data, 100));
+    FAIL_IF_NOT(StreamingBufferSegmentCompareRawData(sb, &seg2, data, 100));
+
+    /* free while compressed */
+    FAIL_IF(StreamingBufferCompress(sb) <= 0);
+    StreamingBufferFree(sb);
+    PASS;
+}
+#endif
+
 #endif
 
 void StreamingBufferRegisterTests(void)
@@ -1487,5 +1639,8 @@ void StreamingBufferRegisterTests(void)
     UtRegisterTest("StreamingBufferTest08", StreamingBufferTest08);
     UtRegisterTest("StreamingBufferTest09", StreamingBufferTest09);
     UtRegisterTest("StreamingBufferTest10", StreamingBufferTest10);
+#ifdef HAVE_LIBLZ4
+    UtRegisterTest("StreamingBufferTest11", StreamingBufferTest11);
+#endif
 #endif
 }
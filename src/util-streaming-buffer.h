@@ -99,6 +99,8 @@ typedef struct StreamingBuffer_ {
     uint8_t *buf;           /**< memory block for reassembly */
     uint32_t buf_size;      /**< size of memory block */
     uint32_t buf_offset;    /**< how far we are in buf_size */
+    uint32_t buf_compressed_len; /**< if non-zero, buf holds this many bytes
+                                  *   of compressed data */
 
     struct SBB sbb_tree;    /**< red black tree of Stream Buffer Blocks */
     StreamingBufferBlock *head; /**< head, should always be the same as RB_MIN */
@@ -108,9 +110,9 @@ typedef struct StreamingBuffer_ {
 } StreamingBuffer;
 
 #ifndef DEBUG
-#define STREAMING_BUFFER_INITIALIZER(cfg) { (cfg), 0, NULL, 0, 0, { NULL }, NULL, };
+#define STREAMING_BUFFER_INITIALIZER(cfg) { (cfg), 0, NULL, 0, 0, 0, { NULL }, NULL, };
 #else
-#define STREAMING_BUFFER_INITIALIZER(cfg) { (cfg), 0, NULL, 0, 0, { NULL }, NULL, 0 };
+#define STREAMING_BUFFER_INITIALIZER(cfg) { (cfg), 0, NULL, 0, 0, 0, { NULL }, NULL, 0 };
 #endif
 
 typedef struct StreamingBufferSegment_ {
@@ -165,6 +167,11 @@ int StreamingBufferGetDataAtOffset (const StreamingBuffer *sb,
 int StreamingBufferSegmentIsBeforeWindow(const StreamingBuffer *sb,
                                          const StreamingBufferSegment *seg);
 
+#define StreamingBufferIsCompressed(sb) ((sb)->buf_compressed_len != 0)
+
+int StreamingBufferCompress(StreamingBuffer *sb);
+int StreamingBufferDecompress(StreamingBuffer *sb, void *(*Malloc)(size_t size));
+
 void StreamingBufferRegisterTests(void);
 
 #endif /* __UTIL_STREAMING_BUFFER_H__ */
@@ -176,6 +176,32 @@ void TimeGet(struct timeval *tv)
                (uintmax_t)tv->tv_sec, (uintmax_t)tv->tv_usec);
 }
 
+/** \brief get the current time with a resolution of a few milliseconds
+ *
+ *  For callers that don't need precise time, like timeout handling and
+ *  once per second housekeeping. In live mode this uses the coarse
+ *  realtime clock, which is read from memory shared with the kernel
+ *  instead of requiring a timer read like gettimeofday. In offline mode
+ *  it's the same as TimeGet.
+ */
+void TimeGetCoarse(struct timeval *tv)
+{
+    if (tv == NULL)
+        return;
+
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_REALTIME_COARSE)
+    if (live_time_tracking) {
+        struct timespec ts;
+        if (likely(clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0)) {
+            tv->tv_sec = ts.tv_sec;
+            tv->tv_usec = ts.tv_nsec / 1000;
+            return;
+        }
+    }
+#endif
+    TimeGet(tv);
+}
+
 #ifdef UNITTESTS
 /** \brief increment the time in the engine
  *  \param tv_sec seconds to increment the time with */
@@ -191,43 +217,20 @@ void TimeSetIncrementTime(uint32_t tv_sec)
 }
 #endif
 
-#ifdef OS_WIN32
 /** \internal
- *  \brief wrapper around strftime on Windows to provide output
- *         compatible with posix %z
+ *  \brief format the UTC offset of a broken down time like posix %z
  */
-static inline void WinStrftime(const struct timeval *ts, const struct tm *t, char *str, size_t size)
+static void CreateTimeZoneString(const struct tm *t, char *str, size_t size)
 {
-    char time_fmt[64] = { 0 };
-    char tz[6] = { 0 };
+#ifdef OS_WIN32
+    /* strftime on Windows doesn't provide output compatible with posix %z */
     const long int tzdiff = -_timezone;
     const int h = abs(_timezone) / 3600 + _daylight;
     const int m = (abs(_timezone) % 3600) / 60;
-    snprintf(tz, sizeof(tz), "%c%02d%02d", tzdiff < 0 ? '-' : '+', h, m);
-    strftime(time_fmt, sizeof(time_fmt), "%Y-%m-%dT%H:%M:%S.%%06u", t);
-    snprintf(str, size, time_fmt, ts->tv_usec);
-    strlcat(str, tz, size); // append our timezone
-}
-#endif
-
-void CreateIsoTimeString (const struct timeval *ts, char *str, size_t size)
-{
-    time_t time = ts->tv_sec;
-    struct tm local_tm;
-    memset(&local_tm, 0, sizeof(local_tm));
-    struct tm *t = (struct tm*)SCLocalTime(time, &local_tm);
-
-    if (likely(t != NULL)) {
-#ifdef OS_WIN32
-        WinStrftime(ts, t, str, size);
+    snprintf(str, size, "%c%02d%02d", tzdiff < 0 ? '-' : '+', h, m);
 #else
-        char time_fmt[64] = { 0 };
-        strftime(time_fmt, sizeof(time_fmt), "%Y-%m-%dT%H:%M:%S.%%06u%z", t);
-        snprintf(str, size, time_fmt, ts->tv_usec);
+    strftime(str, size, "%z", t);
 #endif
-    } else {
-        snprintf(str, size, "ts-error");
-    }
 }
 
 void CreateUtcIsoTimeString (const struct timeval *ts, char *str, size_t size)
@@ -264,33 +267,7 @@ struct tm *SCUtcTime(time_t timep, struct tm *result)
  * Time Caching code
  */
 
-#ifndef TLS
-/* OpenBSD does not support thread_local, so don't use time caching on BSD
- */
-struct tm *SCLocalTime(time_t timep, struct tm *result)
-{
-    return localtime_r(&timep, result);
-}
-
-void CreateTimeString (const struct timeval *ts, char *str, size_t size)
-{
-    time_t time = ts->tv_sec;
-    struct tm local_tm;
-    struct tm *t = (struct tm*)SCLocalTime(time, &local_tm);
-
-    if (likely(t != NULL)) {
-        snprintf(str, size, "%02d/%02d/%02d-%02d:%02d:%02d.%06u",
-                t->tm_mon + 1, t->tm_mday, t->tm_year + 1900, t->tm_hour,
-                t->tm_min, t->tm_sec, (uint32_t) ts->tv_usec);
-    } else {
-        snprintf(str, size, "ts-error");
-    }
-}
-
-#else
-
-/* On systems supporting thread_local, use Per-thread values for caching
- * in CreateTimeString */
+/* Per-thread values for caching in CreateTimeString */
 
 /* The maximum possible length of the time string.
  * "%02d/%02d/%02d-%02d:%02d:%02d.%06u"
@@ -433,7 +410,98 @@ void CreateTimeString (const struct timeval *ts, char *str, size_t size)
              seconds, (uint32_t) ts->tv_usec);
 }
 
-#endif /* defined(__OpenBSD__) */
+/* Per-thread values for caching in CreateIsoTimeString. The date and time
+ * up to the seconds are cached per second, the UTC offset for as long as
+ * the zone offset and DST flag of the local time don't change. */
+
+/* "2013-01-01T15:42:21" is 19, round up to 32. */
+#define MAX_ISO_TIME_STRING 32
+/* "+0100" is 5, round up to 8. */
+#define MAX_ISO_TZ_STRING 8
+
+static thread_local int mru_iso_slot; /* Most recently used cached value */
+static thread_local time_t cached_iso_second[2];
+static thread_local short int cached_iso_time_len[2];
+static thread_local char cached_iso_time[2][MAX_ISO_TIME_STRING];
+static thread_local char cached_iso_tz[2][MAX_ISO_TZ_STRING];
+
+static thread_local bool cached_tz_valid = false;
+static thread_local long int cached_tz_gmtoff;
+static thread_local int cached_tz_isdst;
+static thread_local char cached_tz[MAX_ISO_TZ_STRING];
+
+/* Update the cached ISO time string in cache index N for this second. */
+static int UpdateCachedIsoTime(int n, time_t time)
+{
+    struct tm local_tm;
+    struct tm *t = (struct tm *)SCLocalTime(time, &local_tm);
+    if (unlikely(t == NULL))
+        return -1;
+
+    /* not keyed on the hour, as DST may change at a half hour in UTC */
+#ifdef OS_WIN32
+    const long int gmtoff = 0;
+#else
+    const long int gmtoff = t->tm_gmtoff;
+#endif
+    if (!cached_tz_valid || gmtoff != cached_tz_gmtoff ||
+            t->tm_isdst != cached_tz_isdst) {
+        CreateTimeZoneString(t, cached_tz, sizeof(cached_tz));
+        cached_tz_gmtoff = gmtoff;
+        cached_tz_isdst = t->tm_isdst;
+        cached_tz_valid = true;
+    }
+
+    cached_iso_time_len[n] = (short int)strftime(cached_iso_time[n],
+            MAX_ISO_TIME_STRING, "%Y-%m-%dT%H:%M:%S", t);
+    strlcpy(cached_iso_tz[n], cached_tz, MAX_ISO_TZ_STRING);
+    cached_iso_second[n] = time;
+    mru_iso_slot = n;
+    return 0;
+}
+
+/** \brief Return a ISO 8601 formatted string for the provided time.
+ *
+ * "2013-01-01T15:42:21.123456+0100"
+ *
+ * The part up to the seconds is cached for the two most recently used
+ * seconds, so that alternating between e.g. a flow's start and end time
+ * doesn't thrash the cache. Only the microseconds are printed per call.
+ */
+void CreateIsoTimeString (const struct timeval *ts, char *str, size_t size)
+{
+    const time_t time = ts->tv_sec;
+    int slot = mru_iso_slot;
+
+    if (cached_iso_second[slot] != time || cached_iso_time_len[slot] == 0) {
+        slot = 1 - slot;
+        if (cached_iso_second[slot] == time && cached_iso_time_len[slot] != 0) {
+            /* Use least-recently cached time. Change this slot to Most-recent */
+            mru_iso_slot = slot;
+        } else if (UpdateCachedIsoTime(slot, time) != 0) {
+            snprintf(str, size, "ts-error");
+            return;
+        }
+    }
+
+    /* "." + 6 digits + tz + NUL */
+    const size_t len = cached_iso_time_len[slot];
+    if (unlikely(len + 7 + MAX_ISO_TZ_STRING > size)) {
+        snprintf(str, size, "%s.%06u%s", cached_iso_time[slot],
+                (uint32_t)ts->tv_usec, cached_iso_tz[slot]);
+        return;
+    }
+    memcpy(str, cached_iso_time[slot], len);
+    char *usec_str = str + len;
+    *usec_str++ = '.';
+    uint32_t usec = (uint32_t)ts->tv_usec;
+    for (int i = 5; i >= 0; i--) {
+        usec_str[i] = '0' + (usec % 10);
+        usec /= 10;
+    }
+    usec_str += 6;
+    strlcpy(usec_str, cached_iso_tz[slot], MAX_ISO_TZ_STRING);
+}
 
 /**
  * \brief Convert broken-down time to seconds since Unix epoch.
@@ -646,3 +714,202 @@ uint64_t SCTimespecAsEpochMillis(const struct timespec* ts)
 {
     return ts->tv_sec * 1000L + ts->tv_nsec / 1000000L;
 }
+
+#ifdef UNITTESTS
+#include "util-unittest.h"
+#include "util-cpu.h"
+
+/** \internal
+ *  \brief uncached reference implementation of CreateIsoTimeString */
+static void CreateIsoTimeStringUncached(const struct timeval *ts, char *str, size_t size)
+{
+    time_t time = ts->tv_sec;
+    struct tm local_tm;
+    memset(&local_tm, 0, sizeof(local_tm));
+    struct tm *t = localtime_r(&time, &local_tm);
+    if (t == NULL) {
+        snprintf(str, size, "ts-error");
+        return;
+    }
+    char time_fmt[64] = { 0 };
+    char tz[MAX_ISO_TZ_STRING];
+    strftime(time_fmt, sizeof(time_fmt), "%Y-%m-%dT%H:%M:%S.%%06u", t);
+    CreateTimeZoneString(t, tz, sizeof(tz));
+    snprintf(str, size, time_fmt, (uint32_t)ts->tv_usec);
+    strlcat(str, tz, size);
+}
+
+/** \internal
+ *  \brief drop this thread's cached local times, e.g. after a TZ change */
+static void UtilTimeResetCache(void)
+{
+    for (int i = 0; i < 2; i++) {
+        cached_minute_start[i] = 0;
+        cached_iso_time_len[i] = 0;
+    }
+    cached_tz_valid = false;
+}
+
+/** \internal
+ *  \brief compare cached and uncached ISO time strings for about 36
+ *         hours starting at \a start, with the local zone set to \a tz
+ *         (a POSIX TZ string so it doesn't depend on the tz database)
+ */
+static int UtilTimeIsoTestZone(const char *tz, time_t start,
+        const char *offset_start, const char *offset_end)
+{
+    char cached[64];
+    char uncached[64];
+    struct timeval ts = { start, 0 };
+
+    setenv("TZ", tz, 1);
+    tzset();
+    UtilTimeResetCache();
+
+    CreateIsoTimeString(&ts, cached, sizeof(cached));
+    FAIL_IF(strstr(cached, offset_start) == NULL);
+
+    for (int i = 0; i < 10000; i++) {
+        struct timeval start_ts = { ts.tv_sec, (i * 7919) % 1000000 };
+        struct timeval end_ts = { ts.tv_sec + (i % 7) * 59, (i * 104729) % 1000000 };
+
+        CreateIsoTimeString(&start_ts, cached, sizeof(cached));
+        CreateIsoTimeStringUncached(&start_ts, uncached, sizeof(uncached));
+        FAIL_IF(strcmp(cached, uncached) != 0);
+
+        CreateIsoTimeString(&end_ts, cached, sizeof(cached));
+        CreateIsoTimeStringUncached(&end_ts, uncached, sizeof(uncached));
+        FAIL_IF(strcmp(cached, uncached) != 0);
+
+        ts.tv_sec += 13;
+    }
+    CreateIsoTimeString(&ts, cached, sizeof(cached));
+    FAIL_IF(strstr(cached, offset_end) == NULL);
+    PASS;
+}
+
+/** \test cached iso time strings match the uncached output, also when
+ *        alternating between seconds, minutes and hours and across DST
+ *        changes that happen at a half hour in UTC */
+static int UtilTimeIsoTest01(void)
+{
+    const char *prev_tz = getenv("TZ");
+    char *saved_tz = prev_tz ? SCStrdup(prev_tz) : NULL;
+    FAIL_IF(prev_tz != NULL && saved_tz == NULL);
+
+    /* central european time, DST starts 2020-03-29 01:00:00 UTC */
+    FAIL_IF_NOT(UtilTimeIsoTestZone("CET-1CEST,M3.5.0,M10.5.0/3",
+                1585436400, "+0100", "+0200"));
+    /* St. John's, DST starts 2020-03-08 05:30:00 UTC */
+    FAIL_IF_NOT(UtilTimeIsoTestZone("NST3:30NDT,M3.2.0,M11.1.0",
+                1583644200, "-0330", "-0230"));
+    /* Lord Howe Island, DST starts 2020-10-03 15:30:00 UTC and moves
+     * the clock by only half an hour */
+    FAIL_IF_NOT(UtilTimeIsoTestZone("<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+                1601737800, "+1030", "+1100"));
+
+    if (saved_tz != NULL) {
+        setenv("TZ", saved_tz, 1);
+        SCFree(saved_tz);
+    } else {
+        unsetenv("TZ");
+    }
+    tzset();
+    UtilTimeResetCache();
+    PASS;
+}
+
+/** \test output is truncated safely for small buffers */
+static int UtilTimeIsoTest02(void)
+{
+    char cached[16];
+    char uncached[16];
+    struct timeval ts = { 1577880000, 123456 };
+
+    CreateIsoTimeString(&ts, cached, sizeof(cached));
+    CreateIsoTimeStringUncached(&ts, uncached, sizeof(uncached));
+    FAIL_IF(strcmp(cached, uncached) != 0);
+    PASS;
+}
+
+/** \test formatting benchmark: cached vs uncached */
+static int UtilTimeIsoTest03(void)
+{
+    char buf[64];
+    const int rounds = 300000;
+    struct timeval ts = { 1577880000, 0 };
+
+    uint64_t ticks_start = UtilCpuGetTicks();
+    for (int i = 0; i < rounds; i++) {
+        ts.tv_sec = 1577880000 + i / 100000;
+        ts.tv_usec = i % 1000000;
+        CreateIsoTimeStringUncached(&ts, buf, sizeof(buf));
+    }
+    uint64_t ticks_uncached = UtilCpuGetTicks() - ticks_start;
+
+    ticks_start = UtilCpuGetTicks();
+    for (int i = 0; i < rounds; i++) {
+        ts.tv_sec = 1577880000 + i / 100000;
+        ts.tv_usec = i % 1000000;
+        CreateIsoTimeString(&ts, buf, sizeof(buf));
+    }
+    uint64_t ticks_cached = UtilCpuGetTicks() - ticks_start;
+
+    SCLogInfo("%d iso time strings: uncached %"PRIu64" ticks, cached %"PRIu64" ticks",
+            rounds, ticks_uncached, ticks_cached);
+    PASS;
+}
+
+/** \test coarse clock stays close to the precise clock in live mode */
+static int UtilTimeCoarseTest01(void)
+{
+    const bool live = live_time_tracking;
+    live_time_tracking = true;
+
+    struct timeval precise, coarse;
+    TimeGet(&precise);
+    TimeGetCoarse(&coarse);
+    live_time_tracking = live;
+
+    /* resolution is a jiffy, so allow for a generous 1s difference */
+    FAIL_IF(TIMEVAL_DIFF_SEC(precise, coarse) > 1 && TIMEVAL_DIFF_SEC(coarse, precise) > 1);
+    PASS;
+}
+
+/** \test timestamp calls per packet benchmark: precise vs coarse clock */
+static int UtilTimeCoarseTest02(void)
+{
+    const bool live = live_time_tracking;
+    live_time_tracking = true;
+
+    const int packets = 1000000;
+    struct timeval tv;
+    uint64_t ticks_start = UtilCpuGetTicks();
+    for (int i = 0; i < packets; i++) {
+        TimeGet(&tv);
+    }
+    uint64_t ticks_precise = UtilCpuGetTicks() - ticks_start;
+
+    ticks_start = UtilCpuGetTicks();
+    for (int i = 0; i < packets; i++) {
+        TimeGetCoarse(&tv);
+    }
+    uint64_t ticks_coarse = UtilCpuGetTicks() - ticks_start;
+    live_time_tracking = live;
+
+    SCLogInfo("%d timestamp calls: TimeGet %"PRIu64" ticks, TimeGetCoarse %"PRIu64" ticks",
+            packets, ticks_precise, ticks_coarse);
+    PASS;
+}
+#endif /* UNITTESTS */
+
+void UtilTimeRegisterTests(void)
+{
+#ifdef UNITTESTS
+    UtRegisterTest("UtilTimeIsoTest01", UtilTimeIsoTest01);
+    UtRegisterTest("UtilTimeIsoTest02", UtilTimeIsoTest02);
+    UtRegisterTest("UtilTimeIsoTest03 -- benchmark", UtilTimeIsoTest03);
+    UtRegisterTest("UtilTimeCoarseTest01", UtilTimeCoarseTest01);
+    UtRegisterTest("UtilTimeCoarseTest02 -- benchmark", UtilTimeCoarseTest02);
+#endif
+}
@@ -29,6 +29,7 @@ void TimeDeinit(void);
 
 void TimeSetByThread(const int thread_id, const struct timeval *tv);
 void TimeGet(struct timeval *);
+void TimeGetCoarse(struct timeval *);
 
 /** \brief intialize a 'struct timespec' from a 'struct timeval'. */
 #define FROM_TIMEVAL(timev) { .tv_sec = (timev).tv_sec, .tv_nsec = (timev).tv_usec * 1000 }
@@ -69,5 +70,7 @@ uint64_t SCParseTimeSizeString (const char *str);
 uint64_t SCGetSecondsUntil (const char *str, time_t epoch);
 uint64_t SCTimespecAsEpochMillis(const struct timespec *ts);
 
+void UtilTimeRegisterTests(void);
+
 #endif /* __UTIL_TIME_H__ */
 